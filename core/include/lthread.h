@@ -0,0 +1,127 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    core_lthread Light Threads
+ * @ingroup     core
+ * @brief       Run-to-completion threads sharing a stack
+ *
+ * Many applications have service threads that are idle most of the time and
+ * only do a short piece of work whenever an event occurs. Each of them needs a
+ * stack large enough for its deepest call path, and these stacks quickly
+ * dominate the RAM usage.
+ *
+ * A light thread is a thread that runs a function to completion each time it
+ * is posted with @ref lthread_post(), instead of looping and blocking for
+ * events. Light threads have a PID, are scheduled by their priority from the
+ * same run queues as regular threads, and can be preempted by threads and
+ * light threads of higher priority. As a light thread never blocks in the
+ * middle of its function, no other light thread of the same priority can run
+ * before it has completed. Hence, **all light threads of the same priority can
+ * share a single stack**, and the stack usage of an application only grows with
+ * the number of priorities in use.
+ *
+ * The stack frame of a light thread is set up on the shared stack when the
+ * scheduler first selects it after it has been posted. When the function
+ * returns, the frame is discarded and the light thread sleeps until it is
+ * posted again.
+ *
+ * @warning A light thread must never block, e.g. by calling
+ *          `mutex_lock()`, `msg_receive()`, `ztimer_sleep()` or
+ *          `thread_yield()`, as this would allow another light thread to
+ *          overwrite its stack frame. Use the non-blocking variants instead.
+ *          Light threads of different priorities must not share a stack.
+ *
+ * This API is optional and must be enabled by adding "core_lthread" to
+ * USEMODULE. It cannot be used together with `sched_round_robin`.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Light thread API
+ */
+
+#include <stdbool.h>
+
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Light thread function type
+ *
+ * @param[in]   arg     argument given to @ref lthread_create()
+ */
+typedef void (*lthread_func_t)(void *arg);
+
+/**
+ * @brief   Light thread structure. Must never be modified by the user.
+ */
+typedef struct lthread {
+    thread_t thread;            /**< thread control block */
+    lthread_func_t func;        /**< function to run when posted */
+    void *arg;                  /**< argument of @ref lthread_t::func */
+    char *stack;                /**< start of the shared stack */
+    int stacksize;              /**< usable size of the shared stack */
+    bool rerun;                 /**< posted again while running */
+    struct lthread *next;       /**< next registered light thread */
+} lthread_t;
+
+/**
+ * @brief   Creates a new light thread
+ *
+ * The light thread is created sleeping and runs @p func once for each call
+ * to @ref lthread_post(). Unlike thread_create(), the thread control block is
+ * not placed on the stack but in @p lthread.
+ *
+ * @param[out]  lthread     light thread to create, must be kept allocated
+ *                          for the lifetime of the application
+ * @param[in]   stack       stack to use, shared by all light threads of
+ *                          @p priority
+ * @param[in]   stacksize   size of @p stack in bytes
+ * @param[in]   priority    priority of the light thread
+ * @param[in]   func        function to run when posted
+ * @param[in]   arg         argument to @p func
+ * @param[in]   name        name of the light thread
+ *
+ * @return  the PID of the light thread
+ * @retval  -EINVAL     @p priority is invalid or @p stack is too small
+ * @retval  -EOVERFLOW  too many threads
+ */
+kernel_pid_t lthread_create(lthread_t *lthread, char *stack, int stacksize,
+                            uint8_t priority, lthread_func_t func, void *arg,
+                            const char *name);
+
+/**
+ * @brief   Requests a light thread to run its function
+ *
+ * If the light thread is sleeping, it is made runnable. If it is currently
+ * running (or preempted), it runs once more after its function has returned.
+ * If it has been posted but not started yet, nothing happens.
+ *
+ * May be called from ISRs.
+ *
+ * @param[in,out]   lthread light thread to post
+ */
+void lthread_post(lthread_t *lthread);
+
+/**
+ * @brief   Sets up the initial stack frame of a posted light thread
+ *
+ * @internal    Called by the scheduler for threads with `sp == NULL`
+ *
+ * @param[in,out]   thread  thread control block of a light thread
+ */
+void lthread_prepare(thread_t *thread);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
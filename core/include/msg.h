@@ -114,6 +114,11 @@
  * If the queue is full and the sending thread has a higher priority than the
  * receiving thread the send-behavior is equivalent to synchronous mode.
  *
+ * If a queue only ever receives messages from one thread or one ISR, it can
+ * be initialized with @ref msg_init_queue_spsc() instead (module
+ * `core_msg_spsc`). Sending to and receiving from such a queue does not
+ * disable interrupts unless the receiver has to be woken up.
+ *
  * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
  * #include <inttypes.h>
  * #include <stdio.h>
@@ -366,6 +371,27 @@ int msg_reply(msg_t *m, msg_t *reply);
  */
 int msg_reply_int(msg_t *m, msg_t *reply);
 
+/**
+ * @brief Receive all queued messages, up to a maximum, at once.
+ *
+ * Copies up to @p max messages from the current thread's message queue to
+ * @p out within a single critical section, instead of paying for one per
+ * message as with repeated calls to @ref msg_receive(). Blocked senders
+ * waiting for space in the queue are handled as with @ref msg_receive().
+ *
+ * If no message is queued, this blocks like @ref msg_receive() until a single
+ * message arrives.
+ *
+ * Messages are returned in the order they were sent. Messages sent with
+ * @ref msg_send_receive() can be replied to as usual.
+ *
+ * @param[out] out  Array to store the received messages in, must not be NULL.
+ * @param[in] max   Number of elements in @p out, must be larger than zero.
+ *
+ * @return  Number of messages received, at least 1.
+ */
+unsigned msg_receive_batch(msg_t *out, unsigned max);
+
 /**
  * @brief Check how many messages are available (waiting) in the message queue
  *        of a specific thread
@@ -415,6 +441,32 @@ unsigned msg_queue_capacity(kernel_pid_t pid);
 ACCESS(write_only, 1, 2)
 void msg_init_queue(msg_t *array, int num);
 
+/**
+ * @brief Initialize the current thread's message queue for a single producer.
+ *
+ * Works like @ref msg_init_queue(), but messages are sent to and received
+ * from the queue without disabling interrupts, as long as the queue is
+ * neither empty (for the receiver) nor full (for the sender). Only if the
+ * receiving thread has to be woken up or the sender has to block, the regular
+ * locked code path is taken.
+ *
+ * This is only safe if there is a single producer for the queue, i.e. the
+ * messages are sent either from exactly one thread or from exactly one ISR
+ * (which must not be interrupted by another ISR sending to the same queue).
+ * Replies via @ref msg_reply() do not pass the queue and are not affected.
+ *
+ * @note    Only available with module `core_msg_spsc`.
+ *
+ * @pre @p num **MUST BE A POWER OF TWO!** and larger than zero
+ *
+ * @param[in] array Pointer to preallocated array of ``msg_t`` structures, must
+ *                  not be NULL.
+ * @param[in] num   Number of ``msg_t`` structures in array.
+ *                  **MUST BE POWER OF TWO!**
+ */
+ACCESS(write_only, 1, 2)
+void msg_init_queue_spsc(msg_t *array, int num);
+
 /**
  * @brief Number of messages to be maximally printed through @ref msg_queue_print
  */
@@ -40,6 +40,21 @@ typedef struct {
      * @internal
      */
     list_node_t queue;
+#if defined(DOXYGEN) || defined(MODULE_CORE_MUTEX_PRIO_QUEUE)
+    /**
+     * @brief   Bitmap of the priorities of the threads waiting in @ref queue
+     * @note    Only available if module core_mutex_prio_queue is used.
+     * @internal
+     */
+    unsigned waiters_bitcache;
+    /**
+     * @brief   Last thread waiting in @ref queue for each priority in
+     *          @ref waiters_bitcache
+     * @note    Only available if module core_mutex_prio_queue is used.
+     * @internal
+     */
+    list_node_t *waiters_tail[SCHED_PRIO_LEVELS];
+#endif
 #if defined(DOXYGEN) || defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) \
     || defined(MODULE_CORE_MUTEX_DEBUG)
     /**
@@ -141,6 +156,9 @@ typedef struct {
 static inline void mutex_init(mutex_t *mutex)
 {
     mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIO_QUEUE
+    mutex->waiters_bitcache = 0;
+#endif
 }
 
 /**
@@ -0,0 +1,197 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    core_sync_rwlock Reader-Writer Lock
+ * @ingroup     core_sync
+ * @brief       Reader-writer lock for thread synchronization
+ *
+ * A reader-writer lock can be held by any number of readers at the same
+ * time, or by a single writer. This suits data that is read far more often
+ * than it is modified, such as routing tables or registries.
+ *
+ * Policy
+ * ======
+ *
+ * The lock prefers writers: as soon as a writer waits for the lock, new
+ * readers block as well, so a steady stream of readers cannot starve writers.
+ * When the lock is released and writers are waiting, it is handed over to
+ * the writer with the highest priority. Otherwise, all waiting readers get
+ * the lock at once.
+ *
+ * Waiting threads are kept in two lists, one for readers and one for
+ * writers, both sorted by priority just like the waiters of a @ref mutex_t.
+ *
+ * Priority inheritance
+ * ====================
+ *
+ * When a thread blocks on a lock, the threads holding it inherit the
+ * priority of the blocked thread if it is higher than their own, until they
+ * release the lock. For a lock held for writing this is the writer. For a
+ * lock held for reading these are the readers, which are tracked in a table
+ * of @ref CONFIG_RWLOCK_READER_OWNERS entries per lock. Readers beyond that
+ * number still get the lock, but are not tracked and therefore don't inherit
+ * priorities. Because of the writer preference, a writer only ever waits for
+ * the readers that already held the lock when it started waiting.
+ *
+ * This API is optional and must be enabled by adding "core_rwlock" to
+ * USEMODULE.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Reader-writer lock for thread synchronization
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "list.h"
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of readers per lock that are tracked for priority
+ *          inheritance
+ */
+#ifndef CONFIG_RWLOCK_READER_OWNERS
+#define CONFIG_RWLOCK_READER_OWNERS     (4U)
+#endif
+
+/**
+ * @brief   A thread holding a reader-writer lock for reading
+ * @internal
+ */
+typedef struct {
+    kernel_pid_t pid;           /**< PID of the reader, or
+                                     @ref KERNEL_PID_UNDEF if unused */
+    uint8_t original_priority;  /**< priority of the reader before it
+                                     inherited a higher one */
+} rwlock_reader_t;
+
+/**
+ * @brief   Reader-writer lock structure. Must never be modified by the user.
+ */
+typedef struct {
+    /**
+     * @brief   Readers waiting for the lock, sorted by priority
+     * @internal
+     */
+    list_node_t readers_queue;
+    /**
+     * @brief   Writers waiting for the lock, sorted by priority
+     * @internal
+     */
+    list_node_t writers_queue;
+    /**
+     * @brief   Number of readers holding the lock
+     * @internal
+     */
+    uint16_t readers;
+    /**
+     * @brief   Writer holding the lock, or @ref KERNEL_PID_UNDEF
+     * @internal
+     */
+    kernel_pid_t writer;
+    /**
+     * @brief   Priority of @ref rwlock_t::writer before it inherited a
+     *          higher one
+     * @internal
+     */
+    uint8_t writer_original_priority;
+    /**
+     * @brief   Readers holding the lock that inherit priorities
+     * @internal
+     */
+    rwlock_reader_t reader_owners[CONFIG_RWLOCK_READER_OWNERS];
+} rwlock_t;
+
+/**
+ * @brief   Static initializer for @ref rwlock_t
+ */
+#define RWLOCK_INIT { .writer = KERNEL_PID_UNDEF }
+
+/**
+ * @brief   Initializes a reader-writer lock
+ *
+ * @details For initialization of variables use @ref RWLOCK_INIT instead.
+ *          Only use the function call for dynamically allocated locks.
+ *
+ * @param[out]  rwlock  lock to initialize, must not be NULL
+ */
+static inline void rwlock_init(rwlock_t *rwlock)
+{
+    *rwlock = (rwlock_t)RWLOCK_INIT;
+}
+
+/**
+ * @brief   Acquires the lock for reading, blocking
+ *
+ * Blocks while the lock is held or waited for by a writer.
+ *
+ * @param[in,out]   rwlock  lock to acquire
+ *
+ * @pre     Must be called in thread context
+ */
+void rwlock_rdlock(rwlock_t *rwlock);
+
+/**
+ * @brief   Tries to acquire the lock for reading, non-blocking
+ *
+ * @param[in,out]   rwlock  lock to acquire
+ *
+ * @retval  true    the lock is now held for reading by the caller
+ * @retval  false   the lock is held or waited for by a writer
+ *
+ * @pre     Must be called in thread context
+ */
+bool rwlock_tryrdlock(rwlock_t *rwlock);
+
+/**
+ * @brief   Releases a lock held for reading
+ *
+ * @param[in,out]   rwlock  lock to release, held for reading by the caller
+ */
+void rwlock_rdunlock(rwlock_t *rwlock);
+
+/**
+ * @brief   Acquires the lock for writing, blocking
+ *
+ * @param[in,out]   rwlock  lock to acquire
+ *
+ * @pre     Must be called in thread context
+ * @pre     The lock is not already held by the calling thread
+ */
+void rwlock_wrlock(rwlock_t *rwlock);
+
+/**
+ * @brief   Tries to acquire the lock for writing, non-blocking
+ *
+ * @param[in,out]   rwlock  lock to acquire
+ *
+ * @retval  true    the lock is now held for writing by the caller
+ * @retval  false   the lock is held by another thread
+ *
+ * @pre     Must be called in thread context
+ */
+bool rwlock_trywrlock(rwlock_t *rwlock);
+
+/**
+ * @brief   Releases a lock held for writing
+ *
+ * @param[in,out]   rwlock  lock to release, held for writing by the caller
+ */
+void rwlock_wrunlock(rwlock_t *rwlock);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,132 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    core_softirq Deferred Work (Soft IRQs)
+ * @ingroup     core
+ * @brief       Run work deferred from ISRs before returning to thread context
+ *
+ * Interrupt handlers should be short, but often some work has to be done
+ * after an interrupt before any thread can make use of it, e.g. reading out a
+ * received frame from a network device. Posting an event to a thread for that
+ * costs a dedicated thread and stack per handler and two context switches.
+ *
+ * A soft IRQ instead is a handler that an ISR marks as pending with
+ * @ref softirq_raise(). All pending soft IRQs are run by the scheduler the
+ * next time it is invoked, i.e. when the last ISR exits or when a thread
+ * yields, before any thread is scheduled again. They run in the context of the
+ * scheduler, which on most platforms is interrupt context on the ISR stack, so
+ * no additional stack is needed.
+ *
+ * Soft IRQs are grouped in priority classes. Pending soft IRQs of a higher
+ * class always run before those of a lower one; within a class they run in
+ * the order they were raised. A soft IRQ that is raised again while pending
+ * runs only once.
+ *
+ * On Cortex-M, the scheduler runs in the lowest priority exception, so
+ * interrupts stay enabled while a soft IRQ handler runs. Elsewhere, handlers
+ * run with interrupts disabled, but still after the interrupt that raised
+ * them has been acknowledged and handled.
+ *
+ * @warning Soft IRQ handlers delay all threads, regardless of their priority.
+ *          Like ISRs, they must not block and should not do lengthy work.
+ *
+ * This API is optional and must be enabled by adding "core_softirq" to
+ * USEMODULE.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Soft IRQ API
+ */
+
+#include <stdbool.h>
+
+#include "clist.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Soft IRQ priority classes, from highest to lowest
+ */
+typedef enum {
+    SOFTIRQ_PRIO_HIGHEST,           /**< e.g. timer follow-up work */
+    SOFTIRQ_PRIO_MEDIUM,            /**< e.g. network device events */
+    SOFTIRQ_PRIO_LOWEST,            /**< everything else */
+    SOFTIRQ_PRIO_NUMOF,             /**< number of priority classes */
+} softirq_prio_t;
+
+/**
+ * @brief   Soft IRQ structure forward declaration
+ */
+typedef struct softirq softirq_t;
+
+/**
+ * @brief   Soft IRQ handler type
+ *
+ * @param[in]   softirq the soft IRQ that was raised, use `container_of()` to
+ *                      get a surrounding context structure
+ */
+typedef void (*softirq_handler_t)(softirq_t *softirq);
+
+/**
+ * @brief   Soft IRQ structure
+ */
+struct softirq {
+    clist_node_t list_node;         /**< pending list entry, NULL if idle */
+    softirq_handler_t handler;      /**< soft IRQ handler */
+};
+
+/**
+ * @brief   Initializes a soft IRQ
+ *
+ * @param[out]  softirq soft IRQ to initialize
+ * @param[in]   handler function to run when the soft IRQ was raised
+ */
+static inline void softirq_init(softirq_t *softirq, softirq_handler_t handler)
+{
+    softirq->list_node.next = NULL;
+    softirq->handler = handler;
+}
+
+/**
+ * @brief   Marks a soft IRQ as pending
+ *
+ * The handler runs before the next thread is scheduled. When called from
+ * thread context, it runs before this function returns.
+ *
+ * Does nothing if @p softirq is already pending.
+ *
+ * @param[in,out]   softirq soft IRQ to raise
+ * @param[in]       prio    priority class to run the handler in
+ */
+void softirq_raise(softirq_t *softirq, softirq_prio_t prio);
+
+/**
+ * @brief   Removes a pending soft IRQ
+ *
+ * @param[in,out]   softirq soft IRQ to cancel
+ *
+ * @retval  true    @p softirq was pending and will not run
+ * @retval  false   @p softirq was not pending
+ */
+bool softirq_cancel(softirq_t *softirq);
+
+/**
+ * @brief   Runs all pending soft IRQs
+ *
+ * @internal    Called by the scheduler with interrupts disabled
+ */
+void softirq_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -191,6 +191,10 @@ struct _thread {
     msg_t *msg_array;               /**< memory holding messages sent
                                          to this thread's message queue */
 #endif
+#if defined(MODULE_CORE_MSG_SPSC) || defined(DOXYGEN)
+    bool msg_queue_spsc;            /**< message queue was initialized with
+                                         msg_init_queue_spsc()          */
+#endif
 #if defined(DEVELHELP) || IS_ACTIVE(SCHED_TEST_STACK) \
     || defined(MODULE_MPU_STACK_GUARD) || defined(DOXYGEN)
     char *stack_start;              /**< thread's stack start address   */
@@ -483,6 +487,25 @@ char *thread_stack_init(thread_task_func_t task_func, void *arg,
  */
 void thread_add_to_list(list_node_t *list, thread_t *thread);
 
+/**
+ * @brief Assigns a PID to a thread control block and initializes it (internal)
+ *
+ * Used by thread_create() and by the @ref core_lthread implementation. The
+ * thread's stack related fields are left to the caller; its status is
+ * @ref STATUS_STOPPED.
+ *
+ * @note Must be called with interrupts disabled.
+ *
+ * @param[out] thread   thread control block to initialize
+ * @param[in]  priority priority of the thread
+ * @param[in]  name     name of the thread
+ *
+ * @return the PID of the thread
+ * @retval KERNEL_PID_UNDEF if there are already @ref MAXTHREADS threads
+ */
+kernel_pid_t thread_init_tcb(thread_t *thread, uint8_t priority,
+                             const char *name);
+
 /**
  * @brief Returns the name of a process
  *
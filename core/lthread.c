@@ -0,0 +1,200 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     core_lthread
+ * @{
+ *
+ * @file
+ * @brief       Light thread implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdalign.h>
+
+#include "assert.h"
+#include "irq.h"
+#include "lthread.h"
+#include "sched.h"
+
+#ifdef PICOLIBC_TLS
+#include <picotls.h>
+#endif
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#if IS_USED(MODULE_SCHED_ROUND_ROBIN)
+#  error "core_lthread cannot be used with sched_round_robin"
+#endif
+
+/* all light threads, used to find the ones sharing a stack */
+static lthread_t *_lthreads;
+
+static lthread_t *_find_stack(const char *stack)
+{
+    for (lthread_t *lt = _lthreads; lt; lt = lt->next) {
+        if (lt->stack == stack) {
+            return lt;
+        }
+    }
+
+    return NULL;
+}
+
+static NORETURN void _finish(lthread_t *lthread)
+{
+    thread_t *me = &lthread->thread;
+
+    irq_disable();
+    DEBUG("lthread: %" PRIkernel_pid " completed\n", me->pid);
+
+    /* discard the stack frame, lthread_prepare() sets up a new one */
+    me->sp = NULL;
+    sched_set_status(me, STATUS_SLEEPING);
+    if (lthread->rerun) {
+        lthread->rerun = false;
+        sched_set_status(me, STATUS_PENDING);
+    }
+
+    /* like an exiting thread, no context to save */
+    extern volatile thread_t *sched_active_thread;
+    sched_active_thread = NULL;
+    cpu_switch_context_exit();
+}
+
+static void *_entry(void *arg)
+{
+    lthread_t *lthread = arg;
+
+    lthread->func(lthread->arg);
+    _finish(lthread);
+
+    return NULL;
+}
+
+void lthread_prepare(thread_t *thread)
+{
+    lthread_t *lthread = container_of(thread, lthread_t, thread);
+
+    thread->sp = thread_stack_init(_entry, lthread, lthread->stack,
+                                   lthread->stacksize);
+}
+
+kernel_pid_t lthread_create(lthread_t *lthread, char *stack, int stacksize,
+                            uint8_t priority, lthread_func_t func, void *arg,
+                            const char *name)
+{
+    if (priority >= SCHED_PRIO_LEVELS) {
+        return -EINVAL;
+    }
+
+    /* align the stack on a 16/32bit boundary */
+    uintptr_t misalignment = (uintptr_t)stack % alignof(void *);
+    if (misalignment) {
+        misalignment = alignof(void *) - misalignment;
+        stack += misalignment;
+        stacksize -= misalignment;
+    }
+    stacksize -= stacksize % alignof(void *);
+
+    unsigned state = irq_disable();
+    lthread_t *sibling = _find_stack(stack);
+
+    if (sibling) {
+        /* light threads of different priorities would overwrite each
+         * other's stack frames */
+        assert(sibling->thread.priority == priority);
+        stacksize = sibling->stacksize;
+#ifdef PICOLIBC_TLS
+        lthread->thread.tls = sibling->thread.tls;
+#endif
+    }
+    else {
+#ifdef PICOLIBC_TLS
+        /* light threads sharing a stack share their thread local storage */
+        char *tls = stack + stacksize - _tls_size();
+        lthread->thread.tls = (void *)((uintptr_t)tls & ~(_tls_align() - 1));
+        stacksize = (char *)lthread->thread.tls - stack;
+#endif
+
+        if (stacksize <= 0) {
+            irq_restore(state);
+            DEBUG("lthread_create: stacksize is too small!\n");
+            return -EINVAL;
+        }
+
+#ifdef PICOLIBC_TLS
+        _init_tls(lthread->thread.tls);
+#endif
+#if defined(DEVELHELP) || defined(SCHED_TEST_STACK) \
+        || defined(MODULE_TEST_UTILS_PRINT_STACK_USAGE)
+        /* assign each int of the stack the value of it's address, once for
+         * all light threads using it. Alignment has been handled above, so
+         * silence -Wcast-align */
+        uintptr_t *stackmax = (uintptr_t *)(uintptr_t)(stack + stacksize);
+        uintptr_t *stackp = (uintptr_t *)(uintptr_t)stack;
+
+        while (stackp < stackmax) {
+            *stackp = (uintptr_t)stackp;
+            stackp++;
+        }
+#endif
+    }
+
+    kernel_pid_t pid = thread_init_tcb(&lthread->thread, priority, name);
+    if (pid == KERNEL_PID_UNDEF) {
+        irq_restore(state);
+        DEBUG("lthread_create(): too many threads!\n");
+        return -EOVERFLOW;
+    }
+
+    lthread->func = func;
+    lthread->arg = arg;
+    lthread->stack = stack;
+    lthread->stacksize = stacksize;
+    lthread->rerun = false;
+    lthread->next = _lthreads;
+    _lthreads = lthread;
+
+    /* no stack frame until it gets posted */
+    lthread->thread.sp = NULL;
+#if defined(DEVELHELP) || IS_ACTIVE(SCHED_TEST_STACK) || \
+    defined(MODULE_MPU_STACK_GUARD) || defined(MODULE_CORTEXM_STACK_LIMIT)
+    lthread->thread.stack_start = stack;
+#endif
+#ifdef DEVELHELP
+    lthread->thread.stack_size = stacksize;
+#endif
+
+    sched_set_status(&lthread->thread, STATUS_SLEEPING);
+    irq_restore(state);
+
+    DEBUG("Created light thread %s. PID: %" PRIkernel_pid ". Priority: %u.\n",
+          name, pid, priority);
+
+    return pid;
+}
+
+void lthread_post(lthread_t *lthread)
+{
+    unsigned state = irq_disable();
+    thread_t *thread = &lthread->thread;
+
+    if (thread->status == STATUS_SLEEPING) {
+        sched_set_status(thread, STATUS_PENDING);
+        irq_restore(state);
+        sched_switch(thread->priority);
+        return;
+    }
+
+    /* a light thread with a stack frame has already started */
+    if (thread->sp) {
+        lthread->rerun = true;
+    }
+    irq_restore(state);
+}
@@ -31,6 +31,7 @@
 #include "thread_flags.h"
 #endif
 #include "irq.h"
+#include "ktrace.h"
 #include "cib.h"
 
 #define ENABLE_DEBUG 0
@@ -40,6 +41,106 @@ static int _msg_receive(msg_t *m, int block);
 static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
                      unsigned state);
 
+#if MODULE_CORE_MSG_SPSC
+static inline bool _is_spsc(const thread_t *thread)
+{
+    return thread->msg_queue_spsc;
+}
+
+/* The producer of a single producer, single consumer queue only ever writes
+ * `write_count`, the consumer only `read_count`. Each side publishes its index
+ * only after it is done with the message slot. */
+static int _spsc_put(thread_t *target, const msg_t *m)
+{
+    cib_t *queue = &target->msg_queue;
+    unsigned write_count = queue->write_count;
+    unsigned read_count = __atomic_load_n(&queue->read_count, __ATOMIC_ACQUIRE);
+
+    if (write_count - read_count > queue->mask) {
+        return 0;
+    }
+
+    target->msg_array[write_count & queue->mask] = *m;
+    __atomic_store_n(&queue->write_count, write_count + 1, __ATOMIC_SEQ_CST);
+
+    return 1;
+}
+
+static int _spsc_get(thread_t *me, msg_t *m)
+{
+    cib_t *queue = &me->msg_queue;
+    unsigned read_count = queue->read_count;
+    unsigned write_count = __atomic_load_n(&queue->write_count,
+                                           __ATOMIC_ACQUIRE);
+
+    if (write_count == read_count) {
+        return 0;
+    }
+
+    *m = me->msg_array[read_count & queue->mask];
+    __atomic_store_n(&queue->read_count, read_count + 1, __ATOMIC_RELEASE);
+
+    return 1;
+}
+
+/* Must be called with interrupts disabled after a message has been queued for
+ * @p target. Returns true if @p target was woken up. */
+static bool _spsc_wake(thread_t *target)
+{
+    if (target->status == STATUS_RECEIVE_BLOCKED) {
+        sched_set_status(target, STATUS_PENDING);
+        return true;
+    }
+    return false;
+}
+
+/* lock-free fast path of msg_send() and msg_try_send() */
+static int _msg_send_spsc(msg_t *m, kernel_pid_t target_pid)
+{
+    thread_t *target = thread_get(target_pid);
+
+    if ((target == NULL) || !_is_spsc(target)) {
+        return 0;
+    }
+
+    m->sender_pid = thread_getpid();
+    if (!_spsc_put(target, m)) {
+        return 0;
+    }
+
+    /* The receiver checks for an empty queue and goes blocked within one
+     * critical section, so it either sees the message just published or we
+     * see it blocked here. */
+    if (IS_USED(MODULE_CORE_THREAD_FLAGS) ||
+        (__atomic_load_n(&target->status, __ATOMIC_SEQ_CST) ==
+         STATUS_RECEIVE_BLOCKED)) {
+        unsigned state = irq_disable();
+        bool yield = _spsc_wake(target);
+#if MODULE_CORE_THREAD_FLAGS
+        yield |= thread_flags_set_internal(target, THREAD_FLAG_MSG_WAITING);
+#endif
+        irq_restore(state);
+        if (yield) {
+            thread_yield_higher();
+        }
+    }
+
+    return 1;
+}
+#else
+static inline bool _is_spsc(const thread_t *thread)
+{
+    (void)thread;
+    return false;
+}
+
+static inline bool _spsc_wake(thread_t *target)
+{
+    (void)target;
+    return false;
+}
+#endif
+
 static int queue_msg(thread_t *target, const msg_t *m)
 {
     int n = cib_put(&(target->msg_queue));
@@ -68,6 +169,12 @@ int msg_send(msg_t *m, kernel_pid_t target_pid)
     if (thread_getpid() == target_pid) {
         return msg_send_to_self(m);
     }
+    ktrace_msg_send(target_pid, m->type);
+#if MODULE_CORE_MSG_SPSC
+    if (_msg_send_spsc(m, target_pid)) {
+        return 1;
+    }
+#endif
     return _msg_send(m, target_pid, true, irq_disable());
 }
 
@@ -79,6 +186,12 @@ int msg_try_send(msg_t *m, kernel_pid_t target_pid)
     if (thread_getpid() == target_pid) {
         return msg_send_to_self(m);
     }
+    ktrace_msg_send(target_pid, m->type);
+#if MODULE_CORE_MSG_SPSC
+    if (_msg_send_spsc(m, target_pid)) {
+        return 1;
+    }
+#endif
     return _msg_send(m, target_pid, false, irq_disable());
 }
 
@@ -102,7 +215,9 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
           __LINE__, thread_getpid(), target_pid,
           block, (int)me->status, (int)target->status);
 
-    if (target->status != STATUS_RECEIVE_BLOCKED) {
+    /* receivers with a single producer queue always take their messages
+     * from the queue */
+    if ((target->status != STATUS_RECEIVE_BLOCKED) || _is_spsc(target)) {
         DEBUG(
             "msg_send() %s:%i: Target %" PRIkernel_pid " is not RECEIVE_BLOCKED.\n",
             __FILE__, __LINE__, target_pid);
@@ -111,8 +226,9 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
             DEBUG("msg_send() %s:%i: Target %" PRIkernel_pid
                   " has a msg_queue. Queueing message.\n", __FILE__,
                   __LINE__, target_pid);
+            bool woken = _spsc_wake(target);
             irq_restore(state);
-            if (me->status == STATUS_REPLY_BLOCKED
+            if (me->status == STATUS_REPLY_BLOCKED || woken
                 || (IS_USED(MODULE_CORE_THREAD_FLAGS) &&
                     sched_context_switch_request)
                 ) {
@@ -176,6 +292,7 @@ int msg_send_to_self(msg_t *m)
 {
     unsigned state = irq_disable();
 
+    ktrace_msg_send(thread_getpid(), m->type);
     m->sender_pid = thread_getpid();
     int res = queue_msg(thread_get_active(), m);
 
@@ -192,7 +309,7 @@ static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid)
         return -1;
     }
 
-    if (target->status == STATUS_RECEIVE_BLOCKED) {
+    if ((target->status == STATUS_RECEIVE_BLOCKED) && !_is_spsc(target)) {
         DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
               PRIkernel_pid ".\n", __func__, thread_getpid(), target_pid);
 
@@ -210,7 +327,11 @@ static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid)
     }
     else {
         DEBUG("%s: Receiver not waiting.\n", __func__);
-        return (queue_msg(target, m));
+        int res = queue_msg(target, m);
+        if (res && _spsc_wake(target)) {
+            sched_context_switch_request = 1;
+        }
+        return res;
     }
 }
 
@@ -219,6 +340,7 @@ int msg_send_int(msg_t *m, kernel_pid_t target_pid)
     int res;
 
     m->sender_pid = KERNEL_PID_ISR;
+    ktrace_msg_send(target_pid, m->type);
 
     res = _msg_send_oneway(m, target_pid);
 
@@ -265,6 +387,8 @@ int msg_send_receive(msg_t *m, msg_t *reply, kernel_pid_t target_pid)
         return -1;
     }
 
+    ktrace_msg_send(target_pid, m->type);
+
     unsigned state = irq_disable();
     thread_t *me = thread_get_active();
 
@@ -290,6 +414,9 @@ int msg_send_receive(msg_t *m, msg_t *reply, kernel_pid_t target_pid)
 
         irq_restore(state);
     }
+    else {
+        ktrace_msg_recv(target_pid, reply->type);
+    }
 
     return res;
 }
@@ -312,6 +439,7 @@ int msg_reply(msg_t *m, msg_t *reply)
 
     DEBUG("msg_reply(): %" PRIkernel_pid ": Direct msg copy.\n",
           thread_getpid());
+    ktrace_msg_send(target->pid, reply->type);
     /* copy msg to target */
     msg_t *target_message = (msg_t *)target->wait_data;
 
@@ -339,6 +467,7 @@ int msg_reply_int(msg_t *m, msg_t *reply)
         return -1;
     }
 
+    ktrace_msg_send(target->pid, reply->type);
     msg_t *target_message = (msg_t *)target->wait_data;
 
     *target_message = *reply;
@@ -349,16 +478,85 @@ int msg_reply_int(msg_t *m, msg_t *reply)
 
 int msg_try_receive(msg_t *m)
 {
-    return _msg_receive(m, 0);
+    int res = _msg_receive(m, 0);
+
+    if (res == 1) {
+        ktrace_msg_recv(m->sender_pid, m->type);
+    }
+    return res;
 }
 
 int msg_receive(msg_t *m)
 {
-    return _msg_receive(m, 1);
+    int res = _msg_receive(m, 1);
+
+    ktrace_msg_recv(m->sender_pid, m->type);
+    return res;
+}
+
+unsigned msg_receive_batch(msg_t *out, unsigned max)
+{
+    assert(max > 0);
+
+    unsigned state = irq_disable();
+    thread_t *me = thread_get_active();
+    unsigned avail = thread_has_msg_queue(me) ? cib_avail(&me->msg_queue) : 0;
+
+    if (avail == 0) {
+        /* nothing queued: block for a single message the regular way */
+        irq_restore(state);
+        msg_receive(out);
+        return 1;
+    }
+
+    unsigned count = (avail < max) ? avail : max;
+
+    DEBUG("msg_receive_batch: %" PRIkernel_pid ": got %u queued messages.\n",
+          thread_getpid(), count);
+
+    for (unsigned i = 0; i < count; i++) {
+        out[i] = me->msg_array[cib_get_unsafe(&me->msg_queue)];
+        ktrace_msg_recv(out[i].sender_pid, out[i].type);
+    }
+
+    /* move the messages of blocked senders into the freed queue space */
+    uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+    for (unsigned i = 0; (i < count) && me->msg_waiters.next; i++) {
+        list_node_t *next = list_remove_head(&me->msg_waiters);
+        thread_t *sender = container_of((clist_node_t *)next, thread_t,
+                                        rq_entry);
+
+        me->msg_array[cib_put_unsafe(&me->msg_queue)] =
+            *((msg_t *)sender->wait_data);
+        if (sender->status != STATUS_REPLY_BLOCKED) {
+            sender->wait_data = NULL;
+            sched_set_status(sender, STATUS_PENDING);
+            if (sender->priority < sender_prio) {
+                sender_prio = sender->priority;
+            }
+        }
+    }
+
+    irq_restore(state);
+    if (sender_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(sender_prio);
+    }
+
+    return count;
 }
 
 static int _msg_receive(msg_t *m, int block)
 {
+#if MODULE_CORE_MSG_SPSC
+    thread_t *active = thread_get_active();
+
+    /* lock-free fast path: take the next message unless a sender is blocked
+     * on the full queue, which has to be handled with interrupts disabled */
+    if (_is_spsc(active) && !active->msg_waiters.next && _spsc_get(active, m)) {
+        return 1;
+    }
+#endif
+
     unsigned state = irq_disable();
 
     DEBUG("_msg_receive: %" PRIkernel_pid ": _msg_receive.\n",
@@ -403,6 +601,13 @@ static int _msg_receive(msg_t *m, int block)
 
             /* sender copied message */
             assert(thread_get_active()->status != STATUS_RECEIVE_BLOCKED);
+#if MODULE_CORE_MSG_SPSC
+            if (_is_spsc(me)) {
+                /* sender queued message */
+                MAYBE_UNUSED int res = _spsc_get(me, m);
+                assert(res);
+            }
+#endif
         }
         else {
             irq_restore(state);
@@ -507,8 +712,22 @@ void msg_init_queue(msg_t *array, int num)
 
     me->msg_array = array;
     cib_init(&(me->msg_queue), num);
+#if MODULE_CORE_MSG_SPSC
+    me->msg_queue_spsc = false;
+#endif
 }
 
+#if MODULE_CORE_MSG_SPSC
+void msg_init_queue_spsc(msg_t *array, int num)
+{
+    thread_t *me = thread_get_active();
+
+    assert(num > 0);
+    msg_init_queue(array, num);
+    me->msg_queue_spsc = true;
+}
+#endif
+
 void msg_queue_print(void)
 {
     unsigned state = irq_disable();
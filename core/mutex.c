@@ -17,15 +17,18 @@
  * @}
  */
 
+#include <assert.h>
 #include <errno.h>
 #include <inttypes.h>
 #include <stdio.h>
 
+#include "bitarithm.h"
 #include "cpu.h"
 #include "mutex.h"
 #include "thread.h"
 #include "sched.h"
 #include "irq.h"
+#include "ktrace.h"
 #include "list.h"
 
 #define ENABLE_DEBUG 0
@@ -33,6 +36,96 @@
 
 #if MAXTHREADS > 1
 
+#if IS_USED(MODULE_CORE_MUTEX_PRIO_QUEUE)
+static_assert(SCHED_PRIO_LEVELS <= 8 * sizeof(unsigned),
+              "SCHED_PRIO_LEVELS too large for core_mutex_prio_queue");
+
+/* The waiters are kept in a single list sorted by priority, just as without
+ * core_mutex_prio_queue. The bitcache tells which priorities are present and
+ * waiters_tail[] where each priority ends, so the insertion point is found
+ * without walking the list. */
+static void _queue_add(mutex_t *mutex, thread_t *thread)
+{
+    list_node_t *node = (list_node_t *)&thread->rq_entry;
+    unsigned prio = thread->priority;
+    unsigned higher = mutex->waiters_bitcache & ((1U << prio) - 1);
+    list_node_t *prev = &mutex->queue;
+
+    if (mutex->waiters_bitcache & (1U << prio)) {
+        prev = mutex->waiters_tail[prio];
+    }
+    else if (higher) {
+        prev = mutex->waiters_tail[bitarithm_msb(higher)];
+    }
+
+    node->next = prev->next;
+    prev->next = node;
+    mutex->waiters_tail[prio] = node;
+    mutex->waiters_bitcache |= 1U << prio;
+}
+
+static list_node_t *_queue_pop(mutex_t *mutex)
+{
+    list_node_t *head = list_remove_head(&mutex->queue);
+    /* the head always belongs to the highest priority present */
+    unsigned prio = bitarithm_lsb(mutex->waiters_bitcache);
+
+    if (mutex->waiters_tail[prio] == head) {
+        mutex->waiters_bitcache &= ~(1U << prio);
+    }
+
+    return head;
+}
+
+static bool _queue_remove(mutex_t *mutex, list_node_t *node)
+{
+    /* only used by mutex_cancel(), so a linear search is fine */
+    unsigned prios = mutex->waiters_bitcache;
+    unsigned prio = bitarithm_lsb(prios);
+    bool first = true;
+
+    for (list_node_t *prev = &mutex->queue; prev->next; prev = prev->next) {
+        list_node_t *cur = prev->next;
+
+        if (cur == node) {
+            prev->next = cur->next;
+            if (mutex->waiters_tail[prio] == cur) {
+                if (first) {
+                    mutex->waiters_bitcache &= ~(1U << prio);
+                }
+                else {
+                    mutex->waiters_tail[prio] = prev;
+                }
+            }
+            return true;
+        }
+
+        first = (mutex->waiters_tail[prio] == cur);
+        if (first) {
+            prios &= ~(1U << prio);
+            prio = prios ? bitarithm_lsb(prios) : 0;
+        }
+    }
+
+    return false;
+}
+#else
+static inline void _queue_add(mutex_t *mutex, thread_t *thread)
+{
+    thread_add_to_list(&mutex->queue, thread);
+}
+
+static inline list_node_t *_queue_pop(mutex_t *mutex)
+{
+    return list_remove_head(&mutex->queue);
+}
+
+static inline bool _queue_remove(mutex_t *mutex, list_node_t *node)
+{
+    return list_remove(&mutex->queue, node) != NULL;
+}
+#endif
+
 /**
  * @brief   Block waiting for a locked mutex
  * @pre     IRQs are disabled
@@ -64,14 +157,12 @@ void _block(mutex_t *mutex,
     assert(me != NULL);
     DEBUG("PID[%" PRIkernel_pid "] mutex_lock() Adding node to mutex queue: "
           "prio: %" PRIu32 "\n", thread_getpid(), (uint32_t)me->priority);
+    ktrace_mutex_block(mutex);
     sched_set_status(me, STATUS_MUTEX_BLOCKED);
     if (mutex->queue.next == MUTEX_LOCKED) {
-        mutex->queue.next = (list_node_t *)&me->rq_entry;
-        mutex->queue.next->next = NULL;
-    }
-    else {
-        thread_add_to_list(&mutex->queue, me);
+        mutex->queue.next = NULL;
     }
+    _queue_add(mutex, me);
 
 #ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
     thread_t *owner = thread_get(mutex->owner);
@@ -201,12 +292,13 @@ void mutex_unlock(mutex_t *mutex)
         return;
     }
 
-    list_node_t *next = list_remove_head(&mutex->queue);
+    list_node_t *next = _queue_pop(mutex);
 
     thread_t *process = container_of((clist_node_t *)next, thread_t, rq_entry);
 
     DEBUG("PID[%" PRIkernel_pid "] mutex_unlock(): waking up waiting thread %"
           PRIkernel_pid "\n", thread_getpid(),  process->pid);
+    ktrace_mutex_unblock(mutex, process->pid);
     sched_set_status(process, STATUS_PENDING);
 
     if (!mutex->queue.next) {
@@ -241,11 +333,12 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
             mutex->queue.next = NULL;
         }
         else {
-            list_node_t *next = list_remove_head(&mutex->queue);
+            list_node_t *next = _queue_pop(mutex);
             thread_t *process = container_of((clist_node_t *)next, thread_t,
                                              rq_entry);
             DEBUG("PID[%" PRIkernel_pid "] mutex_unlock_and_sleep(): waking up "
                   "waiter.\n", process->pid);
+            ktrace_mutex_unblock(mutex, process->pid);
             sched_set_status(process, STATUS_PENDING);
             if (!mutex->queue.next) {
                 mutex->queue.next = MUTEX_LOCKED;
@@ -278,7 +371,7 @@ void mutex_cancel(mutex_cancel_t *mc)
 
     if ((mutex->queue.next != MUTEX_LOCKED)
         && (mutex->queue.next != NULL)
-        && list_remove(&mutex->queue, (list_node_t *)&thread->rq_entry)) {
+        && _queue_remove(mutex, (list_node_t *)&thread->rq_entry)) {
         /* Thread was queued and removed from list, wake it up */
         if (mutex->queue.next == NULL) {
             mutex->queue.next = MUTEX_LOCKED;
@@ -0,0 +1,288 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     core_sync_rwlock
+ * @{
+ *
+ * @file
+ * @brief       Kernel reader-writer lock implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+
+#include "irq.h"
+#include "rwlock.h"
+#include "thread.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static inline thread_t *_head(list_node_t *queue)
+{
+    return container_of((clist_node_t *)queue->next, thread_t, rq_entry);
+}
+
+static void _boost(thread_t *owner, uint8_t priority)
+{
+    if ((owner) && (owner->priority > priority)) {
+        DEBUG("PID[%" PRIkernel_pid "] rwlock: prio of %" PRIkernel_pid
+              ": %u --> %u\n", thread_getpid(), owner->pid,
+              (unsigned)owner->priority, (unsigned)priority);
+        sched_change_priority(owner, priority);
+    }
+}
+
+/* Makes the threads holding the lock inherit the priority of the given
+ * thread, if higher */
+static void _inherit(rwlock_t *rwlock, uint8_t priority)
+{
+    if (rwlock->writer != KERNEL_PID_UNDEF) {
+        _boost(thread_get(rwlock->writer), priority);
+        return;
+    }
+
+    for (unsigned i = 0; i < CONFIG_RWLOCK_READER_OWNERS; i++) {
+        if (rwlock->reader_owners[i].pid != KERNEL_PID_UNDEF) {
+            _boost(thread_get(rwlock->reader_owners[i].pid), priority);
+        }
+    }
+}
+
+/* Adds a reader to the lock and tracks it, if there is room left */
+static void _add_reader(rwlock_t *rwlock, const thread_t *reader)
+{
+    rwlock->readers++;
+
+    for (unsigned i = 0; i < CONFIG_RWLOCK_READER_OWNERS; i++) {
+        if (rwlock->reader_owners[i].pid == KERNEL_PID_UNDEF) {
+            rwlock->reader_owners[i].pid = reader->pid;
+            rwlock->reader_owners[i].original_priority = reader->priority;
+            return;
+        }
+    }
+}
+
+/* Removes the calling reader from the lock. Returns the priority the reader
+ * has to drop back to, which is its current one unless it inherited a higher
+ * priority and doesn't hold the lock for reading a second time. */
+static uint8_t _remove_reader(rwlock_t *rwlock, const thread_t *me)
+{
+    rwlock_reader_t *entry = NULL;
+    bool still_owner = false;
+
+    assert(rwlock->readers > 0);
+    rwlock->readers--;
+
+    for (unsigned i = 0; i < CONFIG_RWLOCK_READER_OWNERS; i++) {
+        if (rwlock->reader_owners[i].pid != me->pid) {
+            continue;
+        }
+        if (entry) {
+            still_owner = true;
+        }
+        else {
+            entry = &rwlock->reader_owners[i];
+        }
+    }
+
+    if (!entry) {
+        /* an untracked reader */
+        return me->priority;
+    }
+
+    entry->pid = KERNEL_PID_UNDEF;
+    return still_owner ? me->priority : entry->original_priority;
+}
+
+/* Drops the inherited priority of the calling thread, yields if needed */
+static void _restore_priority(thread_t *me, uint8_t original_priority)
+{
+    if (me->priority != original_priority) {
+        DEBUG("PID[%" PRIkernel_pid "] rwlock: prio %u --> %u\n",
+              me->pid, (unsigned)me->priority, (unsigned)original_priority);
+        sched_change_priority(me, original_priority);
+    }
+}
+
+static void _block(rwlock_t *rwlock, list_node_t *queue, unsigned irq_state)
+{
+    thread_t *me = thread_get_active();
+
+    /* Fail visibly even if a blocking action is called from somewhere where
+     * it's subtly not allowed, eg. board_init */
+    assert(me != NULL);
+    DEBUG("PID[%" PRIkernel_pid "] rwlock: blocking as %s\n",
+          me->pid, (queue == &rwlock->writers_queue) ? "writer" : "reader");
+    sched_set_status(me, STATUS_MUTEX_BLOCKED);
+    thread_add_to_list(queue, me);
+    _inherit(rwlock, me->priority);
+
+    irq_restore(irq_state);
+    thread_yield_higher();
+    /* We were woken up by the releasing thread, which already made us an
+     * owner of the lock */
+}
+
+/* Passes a free lock on to the waiting threads, must be called with
+ * interrupts disabled. Returns the highest priority of the woken threads, or
+ * THREAD_PRIORITY_MIN + 1 if none was woken. */
+static uint16_t _wake(rwlock_t *rwlock)
+{
+    list_node_t *next;
+
+    if ((next = list_remove_head(&rwlock->writers_queue)) != NULL) {
+        thread_t *writer = container_of((clist_node_t *)next, thread_t,
+                                        rq_entry);
+        DEBUG("PID[%" PRIkernel_pid "] rwlock: handing over to writer %"
+              PRIkernel_pid "\n", thread_getpid(), writer->pid);
+        rwlock->writer = writer->pid;
+        rwlock->writer_original_priority = writer->priority;
+        sched_set_status(writer, STATUS_PENDING);
+
+        /* both queues are sorted, so their heads are the only candidates
+         * for inheritance */
+        if (rwlock->writers_queue.next) {
+            _inherit(rwlock, _head(&rwlock->writers_queue)->priority);
+        }
+        if (rwlock->readers_queue.next) {
+            _inherit(rwlock, _head(&rwlock->readers_queue)->priority);
+        }
+
+        return writer->priority;
+    }
+
+    uint16_t min_prio = THREAD_PRIORITY_MIN + 1;
+
+    while ((next = list_remove_head(&rwlock->readers_queue)) != NULL) {
+        thread_t *reader = container_of((clist_node_t *)next, thread_t,
+                                        rq_entry);
+        DEBUG("PID[%" PRIkernel_pid "] rwlock: waking reader %"
+              PRIkernel_pid "\n", thread_getpid(), reader->pid);
+        _add_reader(rwlock, reader);
+        sched_set_status(reader, STATUS_PENDING);
+        if (reader->priority < min_prio) {
+            min_prio = reader->priority;
+        }
+    }
+
+    return min_prio;
+}
+
+bool rwlock_tryrdlock(rwlock_t *rwlock)
+{
+    unsigned irq_state = irq_disable();
+
+    /* writers waiting for the lock take precedence over new readers */
+    if ((rwlock->writer != KERNEL_PID_UNDEF) || rwlock->writers_queue.next) {
+        irq_restore(irq_state);
+        return false;
+    }
+
+    _add_reader(rwlock, thread_get_active());
+    irq_restore(irq_state);
+    return true;
+}
+
+void rwlock_rdlock(rwlock_t *rwlock)
+{
+    unsigned irq_state = irq_disable();
+
+    DEBUG("PID[%" PRIkernel_pid "] rwlock_rdlock()\n", thread_getpid());
+
+    if ((rwlock->writer != KERNEL_PID_UNDEF) || rwlock->writers_queue.next) {
+        _block(rwlock, &rwlock->readers_queue, irq_state);
+        return;
+    }
+
+    _add_reader(rwlock, thread_get_active());
+    irq_restore(irq_state);
+}
+
+void rwlock_rdunlock(rwlock_t *rwlock)
+{
+    unsigned irq_state = irq_disable();
+
+    DEBUG("PID[%" PRIkernel_pid "] rwlock_rdunlock()\n", thread_getpid());
+
+    thread_t *me = thread_get_active();
+    uint8_t original_priority = _remove_reader(rwlock, me);
+    uint16_t min_prio = THREAD_PRIORITY_MIN + 1;
+
+    /* readers only ever wait while a writer holds or waits for the lock, so
+     * this hands the lock over to a writer, if any */
+    if (rwlock->readers == 0) {
+        min_prio = _wake(rwlock);
+    }
+
+    /* only after the lock is consistent again, as this may yield */
+    _restore_priority(me, original_priority);
+
+    irq_restore(irq_state);
+    if (min_prio <= THREAD_PRIORITY_MIN) {
+        sched_switch(min_prio);
+    }
+}
+
+bool rwlock_trywrlock(rwlock_t *rwlock)
+{
+    unsigned irq_state = irq_disable();
+
+    if ((rwlock->writer != KERNEL_PID_UNDEF) || (rwlock->readers > 0)) {
+        irq_restore(irq_state);
+        return false;
+    }
+
+    thread_t *me = thread_get_active();
+
+    rwlock->writer = me->pid;
+    rwlock->writer_original_priority = me->priority;
+    irq_restore(irq_state);
+    return true;
+}
+
+void rwlock_wrlock(rwlock_t *rwlock)
+{
+    unsigned irq_state = irq_disable();
+
+    DEBUG("PID[%" PRIkernel_pid "] rwlock_wrlock()\n", thread_getpid());
+
+    if ((rwlock->writer != KERNEL_PID_UNDEF) || (rwlock->readers > 0)) {
+        assert(rwlock->writer != thread_getpid());
+        _block(rwlock, &rwlock->writers_queue, irq_state);
+        return;
+    }
+
+    thread_t *me = thread_get_active();
+
+    rwlock->writer = me->pid;
+    rwlock->writer_original_priority = me->priority;
+    irq_restore(irq_state);
+}
+
+void rwlock_wrunlock(rwlock_t *rwlock)
+{
+    unsigned irq_state = irq_disable();
+
+    DEBUG("PID[%" PRIkernel_pid "] rwlock_wrunlock()\n", thread_getpid());
+
+    assert(rwlock->writer == thread_getpid());
+    thread_t *me = thread_get_active();
+    uint8_t original_priority = rwlock->writer_original_priority;
+
+    rwlock->writer = KERNEL_PID_UNDEF;
+    uint16_t min_prio = _wake(rwlock);
+
+    /* yields if needed, which also lets the woken threads run */
+    _restore_priority(me, original_priority);
+
+    irq_restore(irq_state);
+    if (min_prio <= THREAD_PRIORITY_MIN) {
+        sched_switch(min_prio);
+    }
+}
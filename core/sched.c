@@ -24,8 +24,11 @@
 #include "bitarithm.h"
 #include "clist.h"
 #include "irq.h"
+#include "ktrace.h"
 #include "log.h"
+#include "lthread.h"
 #include "sched.h"
+#include "softirq.h"
 #include "thread.h"
 #include "panic.h"
 
@@ -146,6 +149,11 @@ thread_t *__attribute__((used)) sched_run(void)
     thread_t *active_thread = thread_get_active();
     thread_t *previous_thread = active_thread;
 
+#if IS_USED(MODULE_CORE_SOFTIRQ)
+    /* deferred work may wake up threads, so run it before picking one */
+    softirq_run();
+#endif
+
     if (!IS_USED(MODULE_CORE_IDLE_THREAD) && !runqueue_bitcache) {
         if (active_thread) {
             _unschedule(active_thread);
@@ -154,6 +162,9 @@ thread_t *__attribute__((used)) sched_run(void)
 
         do {
             sched_arch_idle();
+#if IS_USED(MODULE_CORE_SOFTIRQ)
+            softirq_run();
+#endif
         } while (!runqueue_bitcache);
     }
 
@@ -174,6 +185,13 @@ thread_t *__attribute__((used)) sched_run(void)
                        : active_thread->pid),
         next_thread->pid);
 
+#if IS_USED(MODULE_CORE_LTHREAD)
+    if (next_thread->sp == NULL) {
+        /* a posted light thread, set up its frame on the shared stack */
+        lthread_prepare(next_thread);
+    }
+#endif
+
     next_thread->status = STATUS_RUNNING;
 
     if (previous_thread == next_thread) {
@@ -195,6 +213,12 @@ thread_t *__attribute__((used)) sched_run(void)
             _unschedule(active_thread);
         }
 
+        ktrace_sched_switch(previous_thread ? previous_thread->pid
+                                            : KERNEL_PID_UNDEF,
+                            next_thread->pid,
+                            previous_thread ? previous_thread->status
+                                            : STATUS_STOPPED);
+
         sched_active_pid = next_thread->pid;
         sched_active_thread = next_thread;
 
@@ -0,0 +1,102 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     core_softirq
+ * @{
+ *
+ * @file
+ * @brief       Soft IRQ implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "irq.h"
+#include "softirq.h"
+#include "thread.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* The scheduler runs in the lowest priority exception (PendSV) on Cortex-M,
+ * so interrupts can be taken while handlers run. On other platforms the
+ * scheduler may run in a context that must not be interrupted. */
+#ifdef MODULE_CORTEXM_COMMON
+#  define SOFTIRQ_IRQ_ENABLE    1
+#else
+#  define SOFTIRQ_IRQ_ENABLE    0
+#endif
+
+static clist_node_t _pending[SOFTIRQ_PRIO_NUMOF];
+
+void softirq_raise(softirq_t *softirq, softirq_prio_t prio)
+{
+    assert(softirq->handler && (prio < SOFTIRQ_PRIO_NUMOF));
+
+    unsigned irq_state = irq_disable();
+
+    if (softirq->list_node.next) {
+        irq_restore(irq_state);
+        return;
+    }
+
+    clist_rpush(&_pending[prio], &softirq->list_node);
+    irq_restore(irq_state);
+
+    /* from ISRs this only requests the scheduler to run on exit */
+    thread_yield_higher();
+}
+
+bool softirq_cancel(softirq_t *softirq)
+{
+    bool cancelled = false;
+    unsigned irq_state = irq_disable();
+
+    if (softirq->list_node.next) {
+        for (unsigned prio = 0; prio < SOFTIRQ_PRIO_NUMOF; prio++) {
+            if (clist_remove(&_pending[prio], &softirq->list_node)) {
+                break;
+            }
+        }
+        softirq->list_node.next = NULL;
+        cancelled = true;
+    }
+
+    irq_restore(irq_state);
+    return cancelled;
+}
+
+void softirq_run(void)
+{
+    unsigned prio = 0;
+
+    while (prio < SOFTIRQ_PRIO_NUMOF) {
+        clist_node_t *node = clist_lpop(&_pending[prio]);
+
+        if (!node) {
+            prio++;
+            continue;
+        }
+
+        softirq_t *softirq = container_of(node, softirq_t, list_node);
+        /* may be raised again from within its own handler */
+        node->next = NULL;
+
+        DEBUG("softirq_run: running %p (prio %u)\n", (void *)softirq, prio);
+        if (SOFTIRQ_IRQ_ENABLE) {
+            irq_enable();
+            softirq->handler(softirq);
+            irq_disable();
+        }
+        else {
+            softirq->handler(softirq);
+        }
+
+        /* handlers and ISRs may have raised soft IRQs of a higher class */
+        prio = 0;
+    }
+}
@@ -233,6 +233,51 @@ uintptr_t measure_stack_free_internal(const char *stack, size_t size)
     return space_free;
 }
 
+kernel_pid_t thread_init_tcb(thread_t *thread, uint8_t priority,
+                             const char *name)
+{
+#ifndef CONFIG_THREAD_NAMES
+    (void)name;
+#endif
+
+    kernel_pid_t pid = KERNEL_PID_UNDEF;
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; ++i) {
+        if (sched_threads[i] == NULL) {
+            pid = i;
+            break;
+        }
+    }
+    if (pid == KERNEL_PID_UNDEF) {
+        return KERNEL_PID_UNDEF;
+    }
+
+    sched_threads[pid] = thread;
+
+    thread->pid = pid;
+#ifdef CONFIG_THREAD_NAMES
+    thread->name = name;
+#endif
+
+    thread->priority = priority;
+    thread->status = STATUS_STOPPED;
+
+    thread->rq_entry.next = NULL;
+
+#ifdef MODULE_CORE_MSG
+    thread->wait_data = NULL;
+    thread->msg_waiters.next = NULL;
+    cib_init(&(thread->msg_queue), 0);
+    thread->msg_array = NULL;
+#endif
+#ifdef MODULE_CORE_MSG_SPSC
+    thread->msg_queue_spsc = false;
+#endif
+
+    sched_num_threads++;
+
+    return pid;
+}
+
 kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
                            int flags, thread_task_func_t function, void *arg,
                            const char *name)
@@ -310,13 +355,7 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
 
     unsigned state = irq_disable();
 
-    kernel_pid_t pid = KERNEL_PID_UNDEF;
-    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; ++i) {
-        if (sched_threads[i] == NULL) {
-            pid = i;
-            break;
-        }
-    }
+    kernel_pid_t pid = thread_init_tcb(thread, priority, name);
     if (pid == KERNEL_PID_UNDEF) {
         DEBUG("thread_create(): too many threads!\n");
 
@@ -325,9 +364,6 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
         return -EOVERFLOW;
     }
 
-    sched_threads[pid] = thread;
-
-    thread->pid = pid;
     thread->sp = thread_stack_init(function, arg, stack, stacksize);
 
 #if defined(DEVELHELP) || IS_ACTIVE(SCHED_TEST_STACK) || \
@@ -338,23 +374,6 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
 #ifdef DEVELHELP
     thread->stack_size = total_stacksize;
 #endif
-#ifdef CONFIG_THREAD_NAMES
-    thread->name = name;
-#endif
-
-    thread->priority = priority;
-    thread->status = STATUS_STOPPED;
-
-    thread->rq_entry.next = NULL;
-
-#ifdef MODULE_CORE_MSG
-    thread->wait_data = NULL;
-    thread->msg_waiters.next = NULL;
-    cib_init(&(thread->msg_queue), 0);
-    thread->msg_array = NULL;
-#endif
-
-    sched_num_threads++;
 
     DEBUG("Created thread %s. PID: %" PRIkernel_pid ". Priority: %u.\n", name,
           thread->pid, priority);
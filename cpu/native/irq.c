@@ -20,6 +20,7 @@
 
 #include "irq.h"
 #include "cpu.h"
+#include "ktrace.h"
 #include "periph/pm.h"
 
 #include "native_internal.h"
@@ -261,7 +262,9 @@ void _native_call_sig_handlers_and_switch(void)
 
         if (_native_irq_handlers[sig]) {
             DEBUG_IRQ("call sig handlers + switch: calling interrupt handler for %i\n", sig);
+            ktrace_irq_enter(sig);
             _native_irq_handlers[sig]();
+            ktrace_irq_exit(sig);
         }
         else if (sig == SIGUSR1) {
             warnx("call sig handlers + switch: ignoring SIGUSR1");
@@ -12,6 +12,7 @@
  */
 
 #include <err.h>
+#include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -51,9 +52,31 @@ void pm_set_lowest(void)
 }
 #endif
 
+#if defined(MODULE_PM_LAYERED)
+/* pm_layered calls pm_set() with interrupts disabled. Like WFI, wake up on
+ * any signal but leave handling it to when interrupts get enabled again. */
+static void _native_sleep_irq_disabled(void)
+{
+    _native_pending_syscalls_up();
+    sigsuspend(&_native_sig_set);
+    _native_pending_syscalls_down();
+
+    if (_native_pending_signals > 0) {
+        /* makes irq_enable() switch to ISR context to handle the signal */
+        sched_context_switch_request = 1;
+    }
+}
+#endif
+
 void pm_set(unsigned mode)
 {
     if (mode == 0) {
+#if defined(MODULE_PM_LAYERED)
+        if (!_native_interrupts_enabled) {
+            _native_sleep_irq_disabled();
+            return;
+        }
+#endif
         _native_sleep();
     }
 }
@@ -0,0 +1,202 @@
+#! /usr/bin/env python3
+#
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+"""
+Convert a dump of the `ktrace` kernel event tracer to the Chrome trace event
+format, which can be viewed in chrome://tracing or https://ui.perfetto.dev.
+
+The input is either the raw binary dump as written by `ktrace_dump()`, or a
+terminal log containing the hex encoded output of the `ktrace dump` shell
+command.
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+MAGIC = b"KTRC"
+HDR = struct.Struct("<4sBBBBIII")
+EVENT = struct.Struct("<IHBB")
+
+SCHED_SWITCH = 1
+IRQ_ENTER = 2
+IRQ_EXIT = 3
+MUTEX_BLOCK = 4
+MUTEX_UNBLOCK = 5
+MSG_SEND = 6
+MSG_RECV = 7
+
+CTX_ISR = 0xff
+PID_UNDEF = 0
+
+# thread_status_t values, see core/include/sched.h
+STATUS_NAMES = [
+    "stopped", "zombie", "sleeping", "bl mutex", "bl rx", "bl send",
+    "bl reply", "bl anyfl", "bl allfl", "bl mbox", "bl cond", "running",
+    "pending",
+]
+
+HEX_BEGIN = "ktrace: begin"
+HEX_END = "ktrace: end"
+HEX_LINE = re.compile(r"([0-9a-fA-F]{2})+")
+
+
+def extract_hex(text):
+    """Return the binary dump contained in the last hex dump of a log"""
+    dump = None
+    lines = None
+    for line in text.splitlines():
+        line = line.strip()
+        if line.endswith(HEX_BEGIN):
+            lines = []
+        elif line.endswith(HEX_END) and lines is not None:
+            dump = bytes.fromhex("".join(lines))
+            lines = None
+        elif lines is not None and line:
+            # ignore any prefix added by the terminal program
+            match = HEX_LINE.fullmatch(line.split()[-1])
+            if match:
+                lines.append(match.group(0))
+    if dump is None:
+        raise ValueError("no ktrace dump found in input")
+    return dump
+
+
+def parse(data):
+    """Parse a binary dump into (ticks per second, counter width, lost,
+    events, names)"""
+    magic, version, ev_size, width, _, tps, numof, lost = \
+        HDR.unpack_from(data)
+    if magic != MAGIC:
+        raise ValueError("not a ktrace dump")
+    if version != 2 or ev_size not in (EVENT.size + 4, EVENT.size + 8):
+        raise ValueError("unsupported ktrace dump version {}".format(version))
+
+    offset = HDR.size
+    events = []
+    for _ in range(numof):
+        time, obj, typ, ctx = EVENT.unpack_from(data, offset)
+        arg = int.from_bytes(data[offset + EVENT.size:offset + ev_size],
+                             "little")
+        events.append((time, arg, obj, typ, ctx))
+        offset += ev_size
+
+    names = {}
+    (num_names,) = struct.unpack_from("<I", data, offset)
+    offset += 4
+    for _ in range(num_names):
+        pid, length = struct.unpack_from("<BB", data, offset)
+        offset += 2
+        names[pid] = data[offset:offset + length].decode(errors="replace")
+        offset += length
+
+    return tps, width, lost, events, names
+
+
+def unwrap(events, tps, width):
+    """Turn the raw timestamps of a width bit counter into monotonic
+    microseconds"""
+    result = []
+    base = 0
+    last = None
+    for time, arg, obj, typ, ctx in events:
+        if last is not None and time < last and \
+                last - time > (1 << (width - 1)):
+            base += 1 << width
+        last = time
+        result.append(((base + time) * 1e6 / tps, arg, obj, typ, ctx))
+    return result
+
+
+def convert(data):
+    tps, width, lost, events, names = parse(data)
+    events = unwrap(events, tps, width)
+    out = []
+    flow_id = 0
+    # flows waiting to be finished, keyed by the woken up thread
+    pending_wakeups = {}
+    # messages in flight, keyed by (sender, receiver)
+    pending_msgs = {}
+    running = None
+
+    def tid_name(tid):
+        if tid == CTX_ISR:
+            return "ISR"
+        if tid == PID_UNDEF:
+            return "no thread"
+        return "{} ({})".format(names.get(tid, "thread"), tid)
+
+    def add(ph, name, ts, tid, **kwargs):
+        event = {"ph": ph, "name": name, "ts": ts, "pid": 1, "tid": tid}
+        event.update(kwargs)
+        out.append(event)
+
+    seen = {CTX_ISR}
+    for ts, arg, obj, typ, ctx in events:
+        seen.add(ctx)
+        if typ == SCHED_SWITCH:
+            seen.add(obj)
+            status = STATUS_NAMES[arg] if arg < len(STATUS_NAMES) else str(arg)
+            if running is not None:
+                add("E", "running", ts, running, args={"until": status})
+            add("B", "running", ts, obj)
+            running = obj
+            if obj in pending_wakeups:
+                add("f", "wakeup", ts, obj, id=pending_wakeups.pop(obj),
+                    bp="e", cat="wakeup")
+        elif typ == IRQ_ENTER:
+            add("B", "irq {}".format(obj), ts, CTX_ISR)
+        elif typ == IRQ_EXIT:
+            add("E", "irq {}".format(obj), ts, CTX_ISR)
+        elif typ == MUTEX_BLOCK:
+            add("i", "mutex_lock blocks", ts, ctx, s="t",
+                args={"mutex": hex(arg)})
+        elif typ == MUTEX_UNBLOCK:
+            flow_id += 1
+            add("i", "mutex_unlock", ts, ctx, s="t",
+                args={"mutex": hex(arg), "wakes": obj})
+            add("s", "wakeup", ts, ctx, id=flow_id, cat="wakeup")
+            pending_wakeups[obj] = flow_id
+        elif typ == MSG_SEND:
+            flow_id += 1
+            add("i", "msg_send", ts, ctx, s="t",
+                args={"to": obj, "type": hex(arg)})
+            add("s", "msg", ts, ctx, id=flow_id, cat="msg")
+            sender = PID_UNDEF if ctx == CTX_ISR else ctx
+            pending_msgs.setdefault((sender, obj), []).append(flow_id)
+        elif typ == MSG_RECV:
+            add("i", "msg_receive", ts, ctx, s="t",
+                args={"from": obj, "type": hex(arg)})
+            # messages sent from ISRs carry KERNEL_PID_ISR as sender
+            key = (obj if obj in seen else PID_UNDEF, ctx)
+            if pending_msgs.get(key):
+                add("f", "msg", ts, ctx, id=pending_msgs[key].pop(0),
+                    bp="e", cat="msg")
+
+    for tid in sorted(seen):
+        add("M", "thread_name", 0, tid, args={"name": tid_name(tid)})
+    add("M", "process_name", 0, 0, args={"name": "RIOT"})
+
+    return {"traceEvents": out, "otherData": {"lost_events": lost}}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("input", type=argparse.FileType("rb"),
+                        help="binary dump or terminal log with a hex dump")
+    parser.add_argument("output", type=argparse.FileType("w"), nargs="?",
+                        default=sys.stdout, help="JSON output, default stdout")
+    args = parser.parse_args()
+
+    data = args.input.read()
+    if not data.startswith(MAGIC):
+        data = extract_hex(data.decode(errors="replace"))
+    json.dump(convert(data), args.output)
+
+
+if __name__ == "__main__":
+    main()
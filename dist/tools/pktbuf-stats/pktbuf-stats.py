@@ -15,6 +15,7 @@ pseudo-module) command and the `gnrc_pktbuf_stats()` function.
 
 import argparse
 import collections
+import io
 import pprint
 import re
 import subprocess
@@ -434,6 +435,122 @@ def parse_hexdump(dump):
         yield pktbuf
 
 
+def parse_slab_stats(dump):
+    """
+    Generator to parse the `gnrc_pktbuf_stats()` output of the
+    `gnrc_pktbuf_slab` implementation into a processable dictionary
+
+    Parameters:
+        dump (string): The output of the `gnrcp_pktbuf_stats()` function / the
+        `pktbuf` command.
+        Outputs of multiples invocation are possible to be parsed. They each
+        will be outputted one by one when iterating over the generator.
+
+    Returns:
+        dict: A dictionary describing the state of the packet buffer:
+            - "line" (int): The summary line of the packet buffer.
+            - "size" (int): size in bytes of the packet buffer.
+            - "slabs" (list): list of slab dictionaries with the members
+              "name", "block_size", "used", "numof", "max_used", "allocs",
+              "failed", and "bytes" (the number of bytes requested in the used
+              blocks), all but "name" as int.
+    """
+    pktbuf = None
+    for line in dump.readlines():
+        m = re.search(r"packet buffer \(slab\): first byte: 0x[0-9A-Fa-f]+, "
+                      r"last byte: 0x[0-9A-Fa-f]+ \(size: +(\d+)\)", line)
+        if m is not None:
+            if pktbuf is not None:
+                yield pktbuf
+            pktbuf = {"line": line.strip(), "size": int(m.group(1)),
+                      "slabs": []}
+            continue
+        if pktbuf is None:
+            continue
+        m = re.search(r"slab (\w+) +\(block size: +(\d+)\): "
+                      r"used: +(\d+)/ *(\d+), max used: +(\d+), "
+                      r"allocs: (\d+), failed: (\d+), bytes: (\d+)", line)
+        if m is not None:
+            keys = ("block_size", "used", "numof", "max_used", "allocs",
+                    "failed", "bytes")
+            slab = {"name": m.group(1)}
+            slab.update({k: int(v) for k, v in zip(keys, m.groups()[1:])})
+            pktbuf["slabs"].append(slab)
+    if pktbuf is not None:
+        yield pktbuf
+
+
+def parse_latency(dump):
+    """
+    Generator to parse the latency lines of the `gnrc_pktbuf` benchmark
+    (`tests/bench/gnrc_pktbuf`)
+
+    Parameters:
+        dump (string): The output of the benchmark.
+
+    Returns:
+        dict: A dictionary with the members "backend" (str), "ops", "avg_ns",
+        and "failed" (all int).
+    """
+    for line in dump.readlines():
+        m = re.search(r"pktbuf latency: backend: (\w+), ops: (\d+), "
+                      r"avg: (\d+) ns, failed: (\d+)", line)
+        if m is not None:
+            yield {"backend": m.group(1), "ops": int(m.group(2)),
+                   "avg_ns": int(m.group(3)), "failed": int(m.group(4))}
+
+
+def _percent(part, total):
+    return (100.0 * part / total) if total else 0.0
+
+
+def summarize(dump):
+    """
+    Prints allocation latency and fragmentation of all packet buffer outputs
+    in a dump, for both the `gnrc_pktbuf_static` and the `gnrc_pktbuf_slab`
+    implementation.
+
+    For `gnrc_pktbuf_static` the fragmentation is external: free memory that
+    can not be allocated in one piece, i.e. 1 - largest unused / total unused.
+    For `gnrc_pktbuf_slab` it is internal: memory in used blocks that was not
+    requested, i.e. 1 - requested bytes / size of used blocks.
+
+    Parameters:
+        dump (string): The output of one or more `pktbuf` executions or of the
+        `gnrc_pktbuf` benchmark.
+    """
+    text = dump.read()
+    for lat in parse_latency(io.StringIO(text)):
+        print("latency ({backend}): {avg_ns} ns per operation "
+              "({ops} operations, {failed} failed)".format(**lat))
+    for pktbuf in parse_hexdump(io.StringIO(text)):
+        unused = [s["size"] for s in pktbuf["segments"]
+                  if s["type"] == "unused"]
+        free = sum(unused)
+        largest = max(unused, default=0)
+        print("static: used: {} / {} bytes, unused: {} bytes in {} segments, "
+              "largest unused: {} bytes, external fragmentation: {:.1f} %"
+              .format(pktbuf["size"] - free, pktbuf["size"], free,
+                      len(unused), largest,
+                      100.0 - _percent(largest, free) if free else 0.0))
+    for pktbuf in parse_slab_stats(io.StringIO(text)):
+        used_bytes = 0
+        requested = 0
+        for slab in pktbuf["slabs"]:
+            block_bytes = slab["used"] * slab["block_size"]
+            used_bytes += block_bytes
+            requested += slab["bytes"]
+            print("slab {name}: used: {used} / {numof} blocks of {block_size} "
+                  "bytes (max. {max_used}), {allocs} allocations, {failed} "
+                  "failed, internal fragmentation: {frag:.1f} %"
+                  .format(frag=100.0 - _percent(slab["bytes"], block_bytes)
+                          if block_bytes else 0.0, **slab))
+        print("slab: used: {} / {} bytes, internal fragmentation: {:.1f} %"
+              .format(used_bytes, pktbuf["size"],
+                      100.0 - _percent(requested, used_bytes)
+                      if used_bytes else 0.0))
+
+
 def empty_pktbuf(pktbuf):
     """
     Checks if the packet buffer is empty.
@@ -653,14 +770,25 @@ def main():
     args_parser = argparse.ArgumentParser(
              description="Analyze `pktbuf` command output"
         )
-    args_parser.add_argument("elffile", type=_is_file,
+    args_parser.add_argument("-s", "--summary", action="store_true",
+                             help="Only print allocation latency and "
+                                  "fragmentation, no ELF file required")
+    args_parser.add_argument("elffile", type=_is_file, nargs="?",
                              help="The elffile of the application `pktbuf` "
                                   "was executed in")
     args_parser.add_argument("dump", type=argparse.FileType("r"),
-                             default=sys.stdin,
+                             nargs="?", default=sys.stdin,
                              help="Output of one or more `pktbuf` executions "
                                   "(default: stdin)")
     args = args_parser.parse_args()
+    if args.summary:
+        if args.elffile is not None and args.dump is sys.stdin:
+            # only one positional argument given: it is the dump
+            args.dump = open(args.elffile)
+        summarize(args.dump)
+        return
+    if args.elffile is None:
+        args_parser.error("the following arguments are required: elffile")
     get_struct(args.elffile, PKTSNIP_STRUCT["name"])
     for i, pktbuf in enumerate(parse_hexdump(args.dump), 1):
         if empty_pktbuf(pktbuf):
@@ -0,0 +1,191 @@
+/* Generated file do not edit */
+#ifdef DOXYGEN
+#define RIOT_VERSION "<YEAR_OF_RELEASE>.<MONTH_OF_RELEASE>-<POSTFIX>"
+#define RIOT_VERSION_CODE   RIOT_VERSION_NUM(<YEAR>,<MONTH>,<PATCH>,<EXTRA>)
+#define RIOT_APPLICATION    "<RIOT_APP_NAME>"
+#define RIOT_BOARD          "<BOARD_NAME>"
+#define RIOT_CPU            "<CPU_FOLDER_NAME>"
+#define CPU_RAM_SIZE        /* RAM Size in Bytes */
+#endif /* DOXYGEN */
+#if defined(DOXYGEN)
+#  define MACRO_DEPRECATED    /* implementation */
+#elif defined(__GNUC__) || defined(__clang__)
+#  define MACRO_DEPRECATED _Pragma("GCC warning \"Code is using a deprecated macro\"")
+#else
+#  define MACRO_DEPRECATED
+#endif
+#define DEVELHELP 1
+#undef _FORTIFY_SOURCE
+#define _GNU_SOURCE 1
+#define DEBUG_ASSERT_VERBOSE 1
+#define RIOT_APPLICATION "gcoap_example"
+#define BOARD_NATIVE64 "native64"
+#define RIOT_BOARD BOARD_NATIVE64
+#define CPU_NATIVE "native"
+#define RIOT_CPU CPU_NATIVE
+#define SOCK_HAS_ASYNC 1
+#define SOCK_HAS_IPV6 1
+#define SOCK_HAS_ASYNC 1
+#define SOCK_HAS_ASYNC_CTX 1
+#define CONFIG_GCOAP_RESEND_BUFS_MAX 2
+#define RIOT_VERSION "5388"
+#define RIOT_VERSION_CODE RIOT_VERSION_NUM(2042,5,23,0)
+#define RIOT_OS 1
+#define MODULE_AUTO_INIT 1
+#define MODULE_AUTO_INIT_GNRC_IPV6 1
+#define MODULE_AUTO_INIT_GNRC_IPV6_NIB 1
+#define MODULE_AUTO_INIT_GNRC_NETIF 1
+#define MODULE_AUTO_INIT_GNRC_PKTBUF 1
+#define MODULE_AUTO_INIT_GNRC_UDP 1
+#define MODULE_AUTO_INIT_RANDOM 1
+#define MODULE_AUTO_INIT_ZTIMER 1
+#define MODULE_BOARD 1
+#define MODULE_BOARD_COMMON_INIT 1
+#define MODULE_BOARDS_COMMON_NATIVE 1
+#define MODULE_CORE 1
+#define MODULE_CORE_IDLE_THREAD 1
+#define MODULE_CORE_INIT 1
+#define MODULE_CORE_LIB 1
+#define MODULE_CORE_MBOX 1
+#define MODULE_CORE_MSG 1
+#define MODULE_CORE_PANIC 1
+#define MODULE_CORE_THREAD 1
+#define MODULE_CORE_THREAD_FLAGS 1
+#define MODULE_CPU 1
+#define MODULE_EUI_PROVIDER 1
+#define MODULE_EVENT 1
+#define MODULE_EVENT_CALLBACK 1
+#define MODULE_EVENT_PERIODIC 1
+#define MODULE_EVENT_PERIODIC_CALLBACK 1
+#define MODULE_EVENT_THREAD 1
+#define MODULE_EVENT_TIMEOUT_ZTIMER 1
+#define MODULE_EVTIMER 1
+#define MODULE_FDCAN 1
+#define MODULE_FMT 1
+#define MODULE_FRAC 1
+#define MODULE_GCOAP 1
+#define MODULE_GNRC 1
+#define MODULE_GNRC_ICMPV6 1
+#define MODULE_GNRC_ICMPV6_ECHO 1
+#define MODULE_GNRC_IPV6 1
+#define MODULE_GNRC_IPV6_CLASSIC 1
+#define MODULE_GNRC_IPV6_DEFAULT 1
+#define MODULE_GNRC_IPV6_HDR 1
+#define MODULE_GNRC_IPV6_NIB 1
+#define MODULE_GNRC_NDP 1
+#define MODULE_GNRC_NETAPI 1
+#define MODULE_GNRC_NETAPI_CALLBACKS 1
+#define MODULE_GNRC_NETAPI_MBOX 1
+#define MODULE_GNRC_NETIF 1
+#define MODULE_GNRC_NETIF_ETHERNET 1
+#define MODULE_GNRC_NETIF_HDR 1
+#define MODULE_GNRC_NETIF_INIT_DEVS 1
+#define MODULE_GNRC_NETIF_IPV6 1
+#define MODULE_GNRC_NETREG 1
+#define MODULE_GNRC_NETTYPE_ICMPV6 1
+#define MODULE_GNRC_NETTYPE_IPV6 1
+#define MODULE_GNRC_NETTYPE_UDP 1
+#define MODULE_GNRC_PKT 1
+#define MODULE_GNRC_PKTBUF 1
+#define MODULE_GNRC_PKTBUF_STATIC 1
+#define MODULE_GNRC_SOCK 1
+#define MODULE_GNRC_SOCK_ASYNC 1
+#define MODULE_GNRC_SOCK_UDP 1
+#define MODULE_GNRC_UDP 1
+#define MODULE_ICMPV6 1
+#define MODULE_INET_CSUM 1
+#define MODULE_IOLIST 1
+#define MODULE_IPV6 1
+#define MODULE_IPV6_ADDR 1
+#define MODULE_IPV6_HDR 1
+#define MODULE_ISRPIPE 1
+#define MODULE_L2UTIL 1
+#define MODULE_LIBC 1
+#define MODULE_LUID 1
+#define MODULE_NANOCOAP 1
+#define MODULE_NATIVE_CLI_EUI_PROVIDER 1
+#define MODULE_NATIVE_DRIVERS 1
+#define MODULE_NETDEV 1
+#define MODULE_NETDEV_DEFAULT 1
+#define MODULE_NETDEV_ETH 1
+#define MODULE_NETDEV_NEW_API 1
+#define MODULE_NETDEV_REGISTER 1
+#define MODULE_NETDEV_TAP 1
+#define MODULE_NETIF 1
+#define MODULE_NETUTILS 1
+#define MODULE_OD 1
+#define MODULE_PERIPH 1
+#define MODULE_PERIPH_COMMON 1
+#define MODULE_PERIPH_CPUID 1
+#define MODULE_PERIPH_GPIO 1
+#define MODULE_PERIPH_GPIO_LINUX 1
+#define MODULE_PERIPH_HWRNG 1
+#define MODULE_PERIPH_INIT 1
+#define MODULE_PERIPH_INIT_BUTTONS 1
+#define MODULE_PERIPH_INIT_CPUID 1
+#define MODULE_PERIPH_INIT_GPIO 1
+#define MODULE_PERIPH_INIT_GPIO_LINUX 1
+#define MODULE_PERIPH_INIT_HWRNG 1
+#define MODULE_PERIPH_INIT_LED0 1
+#define MODULE_PERIPH_INIT_LED1 1
+#define MODULE_PERIPH_INIT_LED2 1
+#define MODULE_PERIPH_INIT_LED3 1
+#define MODULE_PERIPH_INIT_LED4 1
+#define MODULE_PERIPH_INIT_LED5 1
+#define MODULE_PERIPH_INIT_LED6 1
+#define MODULE_PERIPH_INIT_LED7 1
+#define MODULE_PERIPH_INIT_LEDS 1
+#define MODULE_PERIPH_INIT_PM 1
+#define MODULE_PERIPH_INIT_RTC 1
+#define MODULE_PERIPH_INIT_TIMER 1
+#define MODULE_PERIPH_INIT_UART 1
+#define MODULE_PERIPH_PM 1
+#define MODULE_PERIPH_RTC 1
+#define MODULE_PERIPH_TIMER 1
+#define MODULE_PERIPH_TIMER_QUERY_FREQS 1
+#define MODULE_PERIPH_UART 1
+#define MODULE_POSIX_HEADERS 1
+#define MODULE_POSIX_INET 1
+#define MODULE_PREPROCESSOR 1
+#define MODULE_PREPROCESSOR_SUCCESSOR 1
+#define MODULE_PRNG 1
+#define MODULE_PRNG_MUSL_LCG 1
+#define MODULE_PS 1
+#define MODULE_RANDOM 1
+#define MODULE_RTC_UTILS 1
+#define MODULE_SHELL 1
+#define MODULE_SHELL_CMD_GNRC_ICMPV6_ECHO 1
+#define MODULE_SHELL_CMD_GNRC_IPV6_NIB 1
+#define MODULE_SHELL_CMD_GNRC_NETIF 1
+#define MODULE_SHELL_CMD_GNRC_PKTSHARK 1
+#define MODULE_SHELL_CMD_PM 1
+#define MODULE_SHELL_CMD_PS 1
+#define MODULE_SHELL_CMD_RTC 1
+#define MODULE_SHELL_CMD_SYS 1
+#define MODULE_SHELL_CMD_UDP 1
+#define MODULE_SHELL_CMDS 1
+#define MODULE_SHELL_CMDS_DEFAULT 1
+#define MODULE_SOCK 1
+#define MODULE_SOCK_ASYNC 1
+#define MODULE_SOCK_ASYNC_EVENT 1
+#define MODULE_SOCK_AUX_LOCAL 1
+#define MODULE_SOCK_UDP 1
+#define MODULE_SOCK_UTIL 1
+#define MODULE_STDIN 1
+#define MODULE_STDIO 1
+#define MODULE_STDIO_DEFAULT 1
+#define MODULE_STDIO_NATIVE 1
+#define MODULE_SYS 1
+#define MODULE_TSRB 1
+#define MODULE_UDP 1
+#define MODULE_URI_PARSER 1
+#define MODULE_ZTIMER 1
+#define MODULE_ZTIMER_CONVERT 1
+#define MODULE_ZTIMER_CONVERT_FRAC 1
+#define MODULE_ZTIMER_CONVERT_SHIFT 1
+#define MODULE_ZTIMER_CORE 1
+#define MODULE_ZTIMER_EXTEND 1
+#define MODULE_ZTIMER_INIT 1
+#define MODULE_ZTIMER_MSEC 1
+#define MODULE_ZTIMER_PERIPH_TIMER 1
+#define MODULE_ZTIMER_USEC 1
@@ -126,6 +126,7 @@ PSEUDOMODULES += evtimer_mbox
 
 PSEUDOMODULES += fatfs_vfs_format
 PSEUDOMODULES += fdcan
+PSEUDOMODULES += fib_indexed
 PSEUDOMODULES += fido2_tests
 PSEUDOMODULES += fmt_%
 PSEUDOMODULES += fortuna_reseed
@@ -174,6 +175,7 @@ PSEUDOMODULES += gnrc_ipv6_nib_rtr_adv_pio_cb
 PSEUDOMODULES += gnrc_ipv6_router
 PSEUDOMODULES += gnrc_ipv6_router_default
 PSEUDOMODULES += gnrc_lorawan_1_1
+PSEUDOMODULES += gnrc_netapi_batch
 PSEUDOMODULES += gnrc_netapi_callbacks
 PSEUDOMODULES += gnrc_netapi_mbox
 PSEUDOMODULES += gnrc_neterr
@@ -183,6 +185,7 @@ PSEUDOMODULES += gnrc_netif_dedup
 PSEUDOMODULES += gnrc_netif_ipv6
 PSEUDOMODULES += gnrc_netif_single
 PSEUDOMODULES += gnrc_netif_timestamp
+PSEUDOMODULES += gnrc_netreg_hashed
 
 
 ## @addtogroup 	net_gnrc_nettype
@@ -297,6 +300,40 @@ PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
 PSEUDOMODULES += gnrc_sock_async
 PSEUDOMODULES += gnrc_sock_check_reuse
+##
+## @defgroup net_gnrc_tcp_congure gnrc_tcp_congure: Congestion control for TCP
+## @ingroup net_gnrc_tcp
+## @brief  Congestion control for @ref net_gnrc_tcp using the @ref sys_congure
+##
+## Limits the amount of data in flight to the congestion window (slow start,
+## congestion avoidance) and retransmits lost segments after three duplicate
+## acknowledgments (fast retransmit). Fast retransmit needs at least four
+## segments in flight, so @ref CONFIG_GNRC_TCP_SND_BUF_SIZE should be increased
+## accordingly. The flavor of congestion control can be selected using the
+## following sub-modules:
+##
+## - @ref net_gnrc_tcp_congure_reno (the default)
+## @{
+##
+PSEUDOMODULES += gnrc_tcp_congure
+## @defgroup net_gnrc_tcp_congure_reno gnrc_tcp_congure_reno: TCP Reno
+## @brief  Congestion control for TCP using the
+##         [TCP Reno congestion control algorithm](@ref sys_congure_reno)
+## @{
+PSEUDOMODULES += gnrc_tcp_congure_reno
+## @}
+## @}
+##
+## @defgroup net_gnrc_tcp_sack gnrc_tcp_sack: Selective acknowledgments for TCP
+## @ingroup net_gnrc_tcp
+## @brief  Selective acknowledgment (SACK) support for @ref net_gnrc_tcp
+##
+## Negotiates SACK with the peer (see RFC 2018). Blocks acknowledged selectively
+## by the peer are not retransmitted on fast retransmit. A received out-of-order
+## block is kept in the receive buffer and reported to the peer.
+## @{
+PSEUDOMODULES += gnrc_tcp_sack
+## @}
 PSEUDOMODULES += gnrc_txtsnd
 
 PSEUDOMODULES += ieee802154_security
@@ -397,6 +434,14 @@ PSEUDOMODULES += pio_autostart_%
 
 PSEUDOMODULES += pktqueue
 
+## @defgroup pseudomodule_pm_layered_stats pm_layered_stats
+## @{
+## @brief Account time spent in each power mode and wakeup sources
+##
+## See @ref sys_pm_layered and @ref pm_stats_get.
+PSEUDOMODULES += pm_layered_stats
+## @}
+
 ## @defgroup pseudomodule_pmp_noexec_ram pmp_noexec_ram
 ## @{
 ## @brief Mark RAM as non-executable using the PMP
@@ -446,6 +491,14 @@ PSEUDOMODULES += saul_pwm
 PSEUDOMODULES += scanf_float
 PSEUDOMODULES += sched_cb
 PSEUDOMODULES += sched_runq_callback
+
+## @defgroup pseudomodule_schedstatistics_cycles schedstatistics_cycles
+## @ingroup schedstatistics
+## @brief   Use the CPU cycle counter as time base for scheduler statistics
+## @{
+PSEUDOMODULES += schedstatistics_cycles
+## @}
+
 ## @defgroup pseudomodule_sema_deprecated sema_deprecated
 ## @ingroup sys_sema
 ## @{
@@ -520,6 +573,7 @@ PSEUDOMODULES += shell_cmd_nimble_statconn
 PSEUDOMODULES += shell_cmd_opendsme
 PSEUDOMODULES += shell_cmd_openthread
 PSEUDOMODULES += shell_cmd_openwsn
+PSEUDOMODULES += shell_cmd_ktrace
 PSEUDOMODULES += shell_cmd_pm
 PSEUDOMODULES += shell_cmd_ps
 PSEUDOMODULES += shell_cmd_random
@@ -197,6 +197,13 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock, const iolist_t *snips,
                            (struct _sock_tl_ep *)remote, NETCONN_UDP);
 }
 
+ssize_t sock_udp_send_batch(sock_udp_t *sock, const sock_udp_dgram_t *dgrams,
+                            unsigned num)
+{
+    assert((dgrams != NULL) || (num == 0));
+    return sock_udp_send_batch_each(sock, dgrams, num);
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
@@ -332,6 +332,13 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
     return payload_len;
 }
 
+ssize_t sock_udp_send_batch(sock_udp_t *sock, const sock_udp_dgram_t *dgrams,
+                            unsigned num)
+{
+    assert((dgrams != NULL) || (num == 0));
+    return sock_udp_send_batch_each(sock, dgrams, num);
+}
+
 void sock_udp_close(sock_udp_t *sock)
 {
     assert(sock != NULL);
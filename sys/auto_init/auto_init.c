@@ -63,6 +63,11 @@ extern void init_schedstatistics(void);
 AUTO_INIT(init_schedstatistics,
           AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS);
 #endif
+#if IS_USED(MODULE_AUTO_INIT_KTRACE)
+extern void auto_init_ktrace(void);
+AUTO_INIT(auto_init_ktrace,
+          AUTO_INIT_PRIO_MOD_KTRACE);
+#endif
 #if IS_USED(MODULE_SCHED_ROUND_ROBIN)
 extern void sched_round_robin_init(void);
 AUTO_INIT(sched_round_robin_init,
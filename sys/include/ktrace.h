@@ -0,0 +1,269 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_ktrace Kernel event tracer
+ * @ingroup     sys
+ * @brief       Record scheduler, interrupt, mutex and IPC events for offline
+ *              timeline analysis
+ *
+ * With the `ktrace` module, the kernel records the following events into a
+ * ring buffer in RAM:
+ *
+ * - every context switch in @ref sched_run()
+ * - interrupt entry and exit, on CPUs with a common interrupt dispatcher
+ *   (currently native) or where drivers call @ref ktrace_irq_enter() and
+ *   @ref ktrace_irq_exit()
+ * - a thread blocking on a mutex, and a thread being woken up by
+ *   @ref mutex_unlock()
+ * - every message sent or received using @ref core_msg
+ *
+ * Recording an event reserves a slot in the ring with a single atomic
+ * increment and then reads the raw counter of the timer backing `ZTIMER_USEC`
+ * (`CONFIG_ZTIMER_USEC_DEV`) as timestamp, so no interrupts are disabled, no
+ * ztimer code runs from within the scheduler and events can be recorded from
+ * any context. The timestamp has the width and frequency of that timer, which
+ * are stored in the dump header. When the ring is full, the oldest events are
+ * overwritten. RIOT runs on a single core, so there is only one ring.
+ *
+ * Tracing is started automatically once `ZTIMER_USEC` is available, see
+ * @ref ktrace_start() and @ref ktrace_stop(). @ref ktrace_dump() exports the
+ * recorded events in the binary format described below, the `ktrace` shell
+ * command prints that dump hex encoded. `dist/tools/ktrace/ktrace2json.py`
+ * converts either the raw binary dump or a terminal log containing the hex
+ * dump into the Chrome trace event format, which can be opened in
+ * `chrome://tracing` or https://ui.perfetto.dev.
+ *
+ * ## Dump format
+ *
+ * All integers are little endian.
+ *
+ * | Offset | Size | Content                                           |
+ * |-------:|-----:|:--------------------------------------------------|
+ * |      0 |    4 | magic "KTRC"                                      |
+ * |      4 |    1 | format version, currently 2                       |
+ * |      5 |    1 | size of an event record, 8 + size of a pointer    |
+ * |      6 |    1 | width of the timestamp counter in bits            |
+ * |      7 |    1 | reserved, 0                                       |
+ * |      8 |    4 | timestamp ticks per second                        |
+ * |     12 |    4 | number of event records that follow               |
+ * |     16 |    4 | number of events lost because the ring was full   |
+ *
+ * Each event record is a @ref ktrace_event_t, oldest first, with the members
+ * in the order `time` (4 bytes), `obj` (2 bytes), `type` (1 byte), `ctx`
+ * (1 byte), `arg` (the remaining bytes of the record, the size of a pointer
+ * on the traced platform). The event records are followed by the names of the
+ * threads that existed at the time of the dump: a 4 byte count, followed by
+ * that many records of a 1 byte PID, a 1 byte length and the name itself.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Kernel event tracer interface
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "kernel_defines.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    sys_ktrace_config Kernel event tracer configuration
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Number of events the ring buffer holds, must be a power of two
+ */
+#ifndef CONFIG_KTRACE_BUFSIZE
+#define CONFIG_KTRACE_BUFSIZE       (256U)
+#endif
+/** @} */
+
+/**
+ * @brief   Value of @ref ktrace_event_t::ctx for events recorded in
+ *          interrupt context
+ */
+#define KTRACE_CTX_ISR              (0xff)
+
+/**
+ * @brief   Event types
+ *
+ * The meaning of @ref ktrace_event_t::obj and @ref ktrace_event_t::arg
+ * depends on the event type.
+ */
+typedef enum {
+    KTRACE_SCHED_SWITCH = 1,    /**< context switch, `ctx` is the thread
+                                     descheduled, `obj` the thread scheduled
+                                     and `arg` the status of the former */
+    KTRACE_IRQ_ENTER,           /**< interrupt entry, `obj` is the IRQ number */
+    KTRACE_IRQ_EXIT,            /**< interrupt exit, `obj` is the IRQ number */
+    KTRACE_MUTEX_BLOCK,         /**< `ctx` blocks on the mutex at `arg` */
+    KTRACE_MUTEX_UNBLOCK,       /**< `ctx` wakes up `obj` waiting for the
+                                     mutex at `arg` */
+    KTRACE_MSG_SEND,            /**< `ctx` sends a message of type `arg` to
+                                     `obj` */
+    KTRACE_MSG_RECV,            /**< `ctx` receives a message of type `arg`
+                                     from `obj` */
+} ktrace_type_t;
+
+/**
+ * @brief   A recorded event
+ */
+typedef struct {
+    uint32_t time;              /**< raw timestamp counter value */
+    uint16_t obj;               /**< event specific object, usually a PID */
+    uint8_t type;               /**< event type, see @ref ktrace_type_t */
+    uint8_t ctx;                /**< PID of the running thread, or
+                                     @ref KTRACE_CTX_ISR */
+    uintptr_t arg;              /**< event specific argument, wide enough
+                                     to hold a pointer */
+} ktrace_event_t;
+
+/**
+ * @brief   Callback used by @ref ktrace_dump() to write out the dump
+ *
+ * @param[in]   data    data to write
+ * @param[in]   len     length of @p data in bytes
+ * @param[in]   arg     argument passed to @ref ktrace_dump()
+ */
+typedef void (*ktrace_write_cb_t)(const void *data, size_t len, void *arg);
+
+/**
+ * @brief   Start recording events
+ */
+void ktrace_start(void);
+
+/**
+ * @brief   Stop recording events
+ */
+void ktrace_stop(void);
+
+/**
+ * @brief   Discard all recorded events
+ */
+void ktrace_reset(void);
+
+/**
+ * @brief   Dump all recorded events in the binary dump format
+ *
+ * Recording is paused while dumping.
+ *
+ * @param[in]   write   callback called with consecutive chunks of the dump
+ * @param[in]   arg     argument passed to @p write
+ */
+void ktrace_dump(ktrace_write_cb_t write, void *arg);
+
+/**
+ * @brief   Record an event
+ *
+ * @param[in]   type    event type
+ * @param[in]   ctx     PID of the thread the event is recorded for, or
+ *                      @ref KTRACE_CTX_ISR
+ * @param[in]   obj     event specific object
+ * @param[in]   arg     event specific argument
+ */
+void ktrace_record_ctx(ktrace_type_t type, uint8_t ctx, uint16_t obj,
+                       uintptr_t arg);
+
+/**
+ * @brief   Record an event for the current context
+ *
+ * @param[in]   type    event type
+ * @param[in]   obj     event specific object
+ * @param[in]   arg     event specific argument
+ */
+void ktrace_record(ktrace_type_t type, uint16_t obj, uintptr_t arg);
+
+/**
+ * @name    Kernel hooks
+ *
+ * These compile to nothing unless the `ktrace` module is used.
+ * @{
+ */
+
+/**
+ * @brief   Record a context switch from @p prev to @p next
+ */
+static inline void ktrace_sched_switch(unsigned prev, unsigned next,
+                                       unsigned prev_status)
+{
+    if (IS_USED(MODULE_KTRACE)) {
+        ktrace_record_ctx(KTRACE_SCHED_SWITCH, prev, next, prev_status);
+    }
+}
+
+/**
+ * @brief   Record the entry of the interrupt handler for @p irq
+ */
+static inline void ktrace_irq_enter(unsigned irq)
+{
+    if (IS_USED(MODULE_KTRACE)) {
+        ktrace_record_ctx(KTRACE_IRQ_ENTER, KTRACE_CTX_ISR, irq, 0);
+    }
+}
+
+/**
+ * @brief   Record the exit of the interrupt handler for @p irq
+ */
+static inline void ktrace_irq_exit(unsigned irq)
+{
+    if (IS_USED(MODULE_KTRACE)) {
+        ktrace_record_ctx(KTRACE_IRQ_EXIT, KTRACE_CTX_ISR, irq, 0);
+    }
+}
+
+/**
+ * @brief   Record the current thread blocking on @p mutex
+ */
+static inline void ktrace_mutex_block(const void *mutex)
+{
+    if (IS_USED(MODULE_KTRACE)) {
+        ktrace_record(KTRACE_MUTEX_BLOCK, 0, (uintptr_t)mutex);
+    }
+}
+
+/**
+ * @brief   Record @p waiter being woken up as @p mutex got unlocked
+ */
+static inline void ktrace_mutex_unblock(const void *mutex, unsigned waiter)
+{
+    if (IS_USED(MODULE_KTRACE)) {
+        ktrace_record(KTRACE_MUTEX_UNBLOCK, waiter, (uintptr_t)mutex);
+    }
+}
+
+/**
+ * @brief   Record a message of type @p type being sent to @p target
+ */
+static inline void ktrace_msg_send(unsigned target, uint16_t type)
+{
+    if (IS_USED(MODULE_KTRACE)) {
+        ktrace_record(KTRACE_MSG_SEND, target, type);
+    }
+}
+
+/**
+ * @brief   Record a message of type @p type being received from @p sender
+ */
+static inline void ktrace_msg_recv(unsigned sender, uint16_t type)
+{
+    if (IS_USED(MODULE_KTRACE)) {
+        ktrace_record(KTRACE_MSG_RECV, sender, type);
+    }
+}
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -12,6 +12,13 @@
  *
  * This module is unused by RIOT's networking stacks, see @ref net_gnrc_ipv6_nib_ft
  * instead.
+ *
+ * By default, every lookup searches all entries of a table and removes the
+ * expired ones on the way. With the `fib_indexed` module, the single hop
+ * tables are indexed by destination address and by the full bytes of the
+ * prefixes, and the entries with a lifetime are kept in a heap ordered by
+ * expiry, so lookups, insertions and removals do not depend on the table
+ * size anymore. Source route tables are not indexed.
  * @{
  *
  * @file
@@ -17,6 +17,7 @@
 
 #include <stdint.h>
 
+#include "kernel_defines.h"
 #include "sched.h"
 #include "universal_address.h"
 #include "mutex.h"
@@ -31,6 +32,17 @@ extern "C" {
  */
 #define FIB_MAX_REGISTERED_RP (5)
 
+#if IS_USED(MODULE_FIB_INDEXED) || defined(DOXYGEN)
+/**
+ * @brief   Number of hash buckets of each index of a FIB table
+ *
+ * @note    Only available with the `fib_indexed` module. Must be a power of 2.
+ */
+#ifndef CONFIG_FIB_INDEXED_BUCKETS
+#define CONFIG_FIB_INDEXED_BUCKETS (16U)
+#endif
+#endif
+
 /**
  * @brief Container descriptor for a FIB entry
  */
@@ -47,6 +59,16 @@ typedef struct {
     uint32_t next_hop_flags;
     /** Pointer to the shared generic address */
     universal_address_container_t *next_hop;
+#if IS_USED(MODULE_FIB_INDEXED) || defined(DOXYGEN)
+    /** next entry (index + 1) in the exact match bucket or the free list */
+    uint16_t exact_next;
+    /** next entry (index + 1) in the prefix match bucket */
+    uint16_t prefix_next;
+    /** entry (index) at this position of the lifetime heap of the table */
+    uint16_t heap_entry;
+    /** position of this entry in the lifetime heap of the table */
+    uint16_t heap_pos;
+#endif
 } fib_entry_t;
 
 /**
@@ -129,6 +151,18 @@ typedef struct {
     *   e.g. when the unreachable destination is covered by the prefix
     */
     universal_address_container_t* prefix_rp[FIB_MAX_REGISTERED_RP];
+#if IS_USED(MODULE_FIB_INDEXED) || defined(DOXYGEN)
+    /** entries (index + 1) by destination address */
+    uint16_t idx_exact[CONFIG_FIB_INDEXED_BUCKETS];
+    /** prefix entries (index + 1) by the full bytes of their prefix */
+    uint16_t idx_prefix[CONFIG_FIB_INDEXED_BUCKETS];
+    /** number of prefix entries by the number of full bytes of their prefix */
+    uint16_t idx_prefix_numof[UNIVERSAL_ADDRESS_SIZE];
+    /** number of entries with a lifetime, in the heap ordered by lifetime */
+    uint16_t idx_heap_len;
+    /** first unused entry (index + 1) */
+    uint16_t idx_free;
+#endif
 } fib_table_t;
 
 #ifdef __cplusplus
@@ -146,6 +146,20 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_MSG_QUEUE_SIZE_EXP    (3U)
 #endif
 
+/**
+ * @brief   Number of entries in the destination cache of the IPv6 thread
+ *
+ * The destination cache keeps the next hop of recently used unicast
+ * destinations, so further packets to them do not need to look up the next
+ * hop in the @ref net_gnrc_ipv6_nib "NIB". All entries are invalidated when the
+ * @ref gnrc_ipv6_nib_generation() "NIB changes".
+ *
+ * Must be a power of two. 0 disables the cache.
+ */
+#ifndef CONFIG_GNRC_IPV6_DST_CACHE_SIZE
+#define CONFIG_GNRC_IPV6_DST_CACHE_SIZE        (0U)
+#endif
+
 #ifdef DOXYGEN
 /**
  * @brief   Add a static IPv6 link local address to any network interface
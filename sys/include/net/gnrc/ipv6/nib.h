@@ -368,6 +368,22 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
                                       gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
                                       gnrc_ipv6_nib_nc_t *nce);
 
+/**
+ * @brief   Gets the generation of the NIB
+ *
+ * The generation changes whenever the NIB changes in a way that may change the
+ * result of @ref gnrc_ipv6_nib_get_next_hop_l2addr(), e.g. when a neighbor
+ * changes its link-layer address or reachability or when a route or prefix is
+ * added or removed.
+ *
+ * A successful result of @ref gnrc_ipv6_nib_get_next_hop_l2addr() may be
+ * reused for the same destination and interface as long as the generation is
+ * the same as it was right before that call. The generation is never 0.
+ *
+ * @return  The current generation of the NIB.
+ */
+uint32_t gnrc_ipv6_nib_generation(void);
+
 /**
  * @brief   Handles a received ICMPv6 packet
  *
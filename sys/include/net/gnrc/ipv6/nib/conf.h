@@ -298,6 +298,21 @@ extern "C" {
 #  define CONFIG_GNRC_IPV6_NIB_NUMOF                 (4)
 #endif
 
+/**
+ * @brief   (de-)activate the hash index over the on-link entries
+ *
+ * Without it, the on-link entries (neighbor cache, DAD table and the next
+ * hops of the other views) are searched linearly whenever a neighbor is
+ * looked up, e.g. for every packet sent. With it, they are indexed in open
+ * addressing hash tables of `2 * CONFIG_GNRC_IPV6_NIB_NUMOF` slots by their
+ * IPv6 address and, with @ref CONFIG_GNRC_IPV6_NIB_ARSM, by their link-layer
+ * address, so the cost of a lookup does not grow with the number of entries.
+ * Use it with a large @ref CONFIG_GNRC_IPV6_NIB_NUMOF.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_NC_HASH
+#  define CONFIG_GNRC_IPV6_NIB_NC_HASH               0
+#endif
+
 /**
  * @brief Per-neighbor packet queue capacity
  *
@@ -320,6 +335,22 @@ extern "C" {
 #  define CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF            (8)
 #endif
 
+/**
+ * @brief   (de-)activate the longest-prefix-match trie over the off-link
+ *          entries
+ *
+ * Without it, the off-link entries are searched linearly for the route of
+ * every packet. With it, a path-compressed binary trie over their prefixes
+ * bounds a lookup to at most 128 nodes, independent of
+ * @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF, at the cost of up to
+ * `2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF` trie nodes of 24 bytes each. Use it on
+ * border routers with many routes, e.g. the downward routes of RPL
+ * non-storing mode.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+#  define CONFIG_GNRC_IPV6_NIB_OFFL_TRIE             0
+#endif
+
 #if CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
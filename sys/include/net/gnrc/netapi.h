@@ -59,6 +59,7 @@
 #include "net/gnrc/netapi/notify.h"
 #include "net/gnrc/nettype.h"
 #include "net/gnrc/pkt.h"
+#include "net/gnrc/pktqueue.h"
 #include "net/netopt.h"
 #include "thread.h"
 
@@ -66,6 +67,19 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Maximum number of messages a GNRC protocol thread takes from its
+ *          message queue at once
+ *
+ * The protocol threads use @ref msg_receive_batch() to drain their message
+ * queue, so a burst of packets costs a single critical section instead of one
+ * per packet. Every message in the batch needs `sizeof(msg_t)` bytes on the
+ * thread's stack. Set to 1 to receive one message at a time.
+ */
+#ifndef CONFIG_GNRC_NETAPI_MSG_BATCH_SIZE
+#define CONFIG_GNRC_NETAPI_MSG_BATCH_SIZE   (4U)
+#endif
+
 /**
  * @brief   @ref core_msg type for passing a @ref net_gnrc_pkt up the network stack
  */
@@ -98,6 +112,21 @@ extern "C" {
  */
 #define GNRC_NETAPI_MSG_TYPE_NOTIFY     (0x0207)
 
+/**
+ * @brief   @ref core_msg type for passing a batch of @ref net_gnrc_pkt down
+ *          the network stack
+ *
+ * The content is the head of a @ref net_gnrc_pktqueue. The receiver takes
+ * over all packets in the queue, but the queue nodes stay with the sender.
+ * This sends back a @ref GNRC_NETAPI_MSG_TYPE_ACK carrying the number of
+ * packets handled once the receiver is done with the nodes, so it should be
+ * used with `msg_send_receive()`.
+ *
+ * @note    Only handled by the IPv6 and the interface threads and only with
+ *          the `gnrc_netapi_batch` module.
+ */
+#define GNRC_NETAPI_MSG_TYPE_SND_BATCH  (0x0208)
+
 /**
  * @brief   Data structure to be send for setting (@ref GNRC_NETAPI_MSG_TYPE_SET)
  *          and getting (@ref GNRC_NETAPI_MSG_TYPE_GET) options
@@ -160,6 +189,21 @@ static inline int gnrc_netapi_send(kernel_pid_t pid, gnrc_pktsnip_t *pkt)
     return _gnrc_netapi_send_recv(pid, pkt, GNRC_NETAPI_MSG_TYPE_SND);
 }
 
+/**
+ * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_SND_BATCH
+ *          messages
+ *
+ * Blocks until the targeted network module handled the batch.
+ *
+ * @param[in] pid       PID of the targeted network module
+ * @param[in] batch     queue of the packets to send
+ *
+ * @return              number of packets from the head of @p batch the targeted
+ *                      network module took over. The caller stays responsible
+ *                      for the others.
+ */
+int gnrc_netapi_send_batch(kernel_pid_t pid, gnrc_pktqueue_t *batch);
+
 /**
  * @brief   Sends @p cmd to all subscribers to (@p type, @p demux_ctx).
  *
@@ -0,0 +1,147 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_gnrc_netapi_single_thread  Single thread extension
+ * @ingroup     net_gnrc_netapi
+ * @brief       Runs the GNRC protocol layers in one thread
+ * @{
+ *
+ * @details The submodule `gnrc_netapi_single_thread` runs UDP, IPv6 and
+ *          6LoWPAN as message handlers of one shared thread instead of a
+ *          thread per layer. Packets passed between these layers within the
+ *          shared thread are handed over by a direct function call instead of
+ *          a message, so a packet crossing the stack costs no context switch
+ *          and only one stack is needed for all layers.
+ *
+ *          Packets dispatched to a layer from any other thread (e.g. a sock
+ *          or a network interface) are still passed as a message to the
+ *          shared thread. The network interfaces, TCP and routing protocols
+ *          keep their own threads.
+ *
+ * To use, add the module `gnrc_netapi_single_thread` to the `USEMODULE` macro
+ * in your application's Makefile:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_netapi_single_thread
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @file
+ * @brief       Single thread extension for @ref net_gnrc_netapi
+ */
+
+#include "msg.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/nettype.h"
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_gnrc_netapi_single_thread_conf GNRC single thread compile configurations
+ * @ingroup  net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Default stack size of the shared thread
+ *
+ *          Packets are handed between the layers by nested function calls, so
+ *          this needs to fit the deepest path through the stack, e.g. from
+ *          6LoWPAN via IPv6 to UDP.
+ */
+#ifndef GNRC_NETAPI_SINGLE_THREAD_STACK_SIZE
+#define GNRC_NETAPI_SINGLE_THREAD_STACK_SIZE    ((THREAD_STACKSIZE_DEFAULT) + \
+                                                 (THREAD_STACKSIZE_SMALL))
+#endif
+
+/**
+ * @brief   Default priority of the shared thread
+ */
+#ifndef GNRC_NETAPI_SINGLE_THREAD_PRIO
+#define GNRC_NETAPI_SINGLE_THREAD_PRIO          (THREAD_PRIORITY_MAIN - 3)
+#endif
+
+/**
+ * @brief   Default message queue size of the shared thread (as exponent of
+ *          2^n).
+ *
+ *          As the queue size ALWAYS needs to be power of two, this option
+ *          represents the exponent of 2^n, which will be used as the size of
+ *          the queue.
+ */
+#ifndef CONFIG_GNRC_NETAPI_SINGLE_THREAD_MSG_QUEUE_SIZE_EXP
+#define CONFIG_GNRC_NETAPI_SINGLE_THREAD_MSG_QUEUE_SIZE_EXP  (4U)
+#endif
+/** @} */
+
+/**
+ * @brief   Message queue size of the shared thread
+ */
+#ifndef GNRC_NETAPI_SINGLE_THREAD_MSG_QUEUE_SIZE
+#define GNRC_NETAPI_SINGLE_THREAD_MSG_QUEUE_SIZE \
+    (1 << CONFIG_GNRC_NETAPI_SINGLE_THREAD_MSG_QUEUE_SIZE_EXP)
+#endif
+
+/**
+ * @brief   Maximum number of layers that can share the thread
+ */
+#define GNRC_NETAPI_SINGLE_THREAD_LAYERS_MAX    (8U)
+
+/**
+ * @brief   Message handler of a layer, as it would be called from the
+ *          layer's own thread
+ *
+ * @param[in] msg   The message to handle
+ * @param[in] reply Preset @ref GNRC_NETAPI_MSG_TYPE_ACK message for replies
+ */
+typedef void (*gnrc_netapi_single_thread_handler_t)(msg_t *msg, msg_t *reply);
+
+/**
+ * @brief   A protocol layer running in the shared thread
+ */
+typedef struct gnrc_netapi_single_thread_layer {
+    gnrc_netapi_single_thread_handler_t handler;    /**< message handler */
+    /**
+     * @brief   Callback for netreg entries of the layer
+     *
+     * Use with @ref gnrc_netreg_entry_init_cb() to register the layer for
+     * further types.
+     */
+    gnrc_netreg_entry_cbd_t cbd;
+    gnrc_netreg_entry_t entry;                      /**< netreg entry */
+    uint8_t idx;                                    /**< index in the thread */
+} gnrc_netapi_single_thread_layer_t;
+
+/**
+ * @brief   Registers a layer to run in the shared thread
+ *
+ * Starts the shared thread, if it is not running yet, and registers the layer
+ * at @ref net_gnrc_netreg for all packets of @p type.
+ *
+ * Messages sent to the shared thread directly (e.g. timeouts) are handed to
+ * every layer. The commands of @ref net_gnrc_netapi are only handed to the
+ * IPv6 layer in that case.
+ *
+ * @param[out] layer    The layer, must stay valid
+ * @param[in] type      The type of packets the layer handles
+ * @param[in] handler   The message handler of the layer
+ *
+ * @return  PID of the shared thread, that replaces the layer's thread
+ * @return  KERNEL_PID_UNDEF, if there are already
+ *          @ref GNRC_NETAPI_SINGLE_THREAD_LAYERS_MAX layers
+ */
+kernel_pid_t gnrc_netapi_single_thread_register(gnrc_netapi_single_thread_layer_t *layer,
+                                                gnrc_nettype_t type,
+                                                gnrc_netapi_single_thread_handler_t handler);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -9,6 +9,14 @@
  * @defgroup    net_gnrc_netreg  Network protocol registry
  * @ingroup     net_gnrc
  * @brief       Registry to receive messages of a specified protocol type by GNRC.
+ *
+ * The entries of a protocol type are kept in a list that is searched for the
+ * @ref gnrc_netreg_entry_t::demux_ctx "demux context" of every dispatched
+ * packet. With many registrations, e.g. a node with dozens of UDP sockets,
+ * this linear search gets expensive. The `gnrc_netreg_hashed` module
+ * distributes the entries of @ref GNRC_NETTYPE_UDP and @ref GNRC_NETTYPE_TCP
+ * into @ref CONFIG_GNRC_NETREG_HASHED_BUCKETS lists by their demux context,
+ * i.e. their port, so a lookup only searches the entries in one of them.
  * @{
  *
  * @file
@@ -69,6 +77,22 @@ typedef enum {
 } gnrc_netreg_type_t;
 #endif
 
+/**
+ * @defgroup net_gnrc_netreg_conf GNRC network protocol registry compile
+ *                                configurations
+ * @ingroup net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of hash buckets per protocol type with `gnrc_netreg_hashed`
+ *
+ * @note    Must be a power of 2.
+ */
+#ifndef CONFIG_GNRC_NETREG_HASHED_BUCKETS
+#define CONFIG_GNRC_NETREG_HASHED_BUCKETS   (16U)
+#endif
+/** @} */
+
 /**
  * @brief   Demux context value to get all packets of a certain type.
  *
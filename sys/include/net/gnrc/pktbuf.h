@@ -19,12 +19,22 @@
  *
  * # Backends
  *
- * There are two backends available: `gnrc_pktbuf_static` and
- * `gnrc_pktbuf_malloc`. The former is the default and most suitable for
- * embedded devices, as it works with a static pool of memory. The latter is
- * mostly useful when debugging allocations with tools like Valgrind on the
- * `native` board, as it builds upon standard `malloc()`, `realloc()`, and
- * `free()` that those tools can hook into.
+ * There are three backends available: `gnrc_pktbuf_static`,
+ * `gnrc_pktbuf_slab`, and `gnrc_pktbuf_malloc`. The first is the default and
+ * most suitable for embedded devices, as it works with a static pool of memory.
+ * The last is mostly useful when debugging allocations with tools like
+ * Valgrind on the `native` board, as it builds upon standard `malloc()`,
+ * `realloc()`, and `free()` that those tools can hook into.
+ *
+ * `gnrc_pktbuf_slab` also works with static memory, but splits it into
+ * slabs of fixed size blocks: One for packet snip descriptors and three
+ * configurable size classes for data, by default for small headers, link layer
+ * frames of IEEE 802.15.4, and full-MTU IPv6 packets. Allocation and release
+ * take constant time, independent of the number of packets in the buffer, and
+ * the buffer can not fragment externally. The price is internal fragmentation
+ * and that data larger than @ref CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE can not be
+ * allocated at all, so the size classes need to be adapted to the link layers
+ * in use, e.g. to 1536 bytes for Ethernet.
  *
  * Since `gnrc_pktbuf_static` is the default, no action is required to use it:
  * Any code using `gnrc_pktbuf` will automatically pull that in as a dependency.
@@ -78,6 +88,67 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @brief   Number of packet snip descriptors in the `gnrc_pktbuf_slab`
+ *          backend
+ *
+ * @details Data that fits into a packet snip descriptor, e.g. a UDP header,
+ *          is also allocated from this slab.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF      (32)
+#endif
+
+/**
+ * @brief   Block size of the small data class of the `gnrc_pktbuf_slab`
+ *          backend, sized for network layer headers
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE      (64)
+#endif
+
+/**
+ * @brief   Number of blocks of the small data class of the
+ *          `gnrc_pktbuf_slab` backend
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF     (16)
+#endif
+
+/**
+ * @brief   Block size of the medium data class of the `gnrc_pktbuf_slab`
+ *          backend, sized for IEEE 802.15.4 frames
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE     (128)
+#endif
+
+/**
+ * @brief   Number of blocks of the medium data class of the
+ *          `gnrc_pktbuf_slab` backend
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF    (8)
+#endif
+
+/**
+ * @brief   Block size of the large data class of the `gnrc_pktbuf_slab`
+ *          backend, sized for full-MTU IPv6 packets
+ *
+ * @details This is the largest size that can be allocated with this backend.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE      (1280)
+#endif
+
+/**
+ * @brief   Number of blocks of the large data class of the
+ *          `gnrc_pktbuf_slab` backend
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF     (3)
+#endif
 /** @} */
 
 /**
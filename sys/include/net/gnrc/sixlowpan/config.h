@@ -54,6 +54,22 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_MSG_QUEUE_SIZE_EXP   (3U)
 #endif
 
+/**
+ * @brief   Number of header templates for UDP flows in IPHC (power of two)
+ *
+ * For UDP datagrams without extension headers, the IPv6 and UDP headers
+ * compressed by IPHC are kept as a template of the flow, identified by the
+ * addresses and ports. Further datagrams of the flow are compressed by copying
+ * the template and inserting the UDP checksum. The templates are looked up
+ * direct-mapped, so this must be a power of two. 0 disables the templates.
+ *
+ * @note    Only applicable with the `gnrc_sixlowpan_iphc_nhc` and
+ *          [gnrc_udp](@ref net_gnrc_udp) modules.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_IPHC_TMPL_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_IPHC_TMPL_SIZE       (0U)
+#endif
+
 /**
  * @brief   Number of datagrams that can be fragmented simultaneously
  *
@@ -166,6 +182,22 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US  (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)
 #endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US */
 
+/**
+ * @brief   Override the least recently used entry when the VRB is full
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb) module.
+ *
+ * When a new datagram needs to be forwarded and the VRB is full, the least
+ * recently used VRB entry is replaced if it is older than @ref
+ * CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US. Otherwise, the new datagram is
+ * reassembled instead of forwarded. When set, the least recently used entry is
+ * always replaced, dropping the remaining fragments of its datagram.
+ */
+#ifdef DOXYGEN
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_OVERRIDE_LRU
+#endif
+
 /**
  * @name Selective fragment recovery configuration
  * @see  [RFC 8931, section 7.1]
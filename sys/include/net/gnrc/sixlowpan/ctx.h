@@ -124,6 +124,21 @@ static inline void gnrc_sixlowpan_ctx_remove(uint8_t id)
     }
 }
 
+/**
+ * @brief   Gets the generation of the context buffer
+ *
+ * The generation changes with every call of gnrc_sixlowpan_ctx_update(), so
+ * state derived from the contexts (e.g. a compressed header) can tell if a
+ * context may have been added or changed since.
+ *
+ * @note    Neither removing a context nor the expiry of its lifetime change
+ *          the generation. Use gnrc_sixlowpan_ctx_lookup_id() to check if a
+ *          context is still valid.
+ *
+ * @return  The current generation of the context buffer.
+ */
+uint32_t gnrc_sixlowpan_ctx_generation(void);
+
 /**
  * @brief   Check if a prefix matches a compression context
  *
@@ -234,6 +234,13 @@ const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void);
  */
 void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry);
 
+/**
+ * @brief   Returns all fragment intervals of a base entry to the pool
+ *
+ * @param[in,out] entry Entry to remove the intervals from
+ */
+void gnrc_sixlowpan_frag_rb_base_ints_rm(gnrc_sixlowpan_frag_rb_base_t *entry);
+
 /**
  * @brief   Garbage collect reassembly buffer.
  */
@@ -272,12 +279,7 @@ int gnrc_sixlowpan_frag_rb_dispatch_when_complete(gnrc_sixlowpan_frag_rb_t *rbuf
  *
  * @param[in] rbuf  A reassembly buffer entry. Must not be NULL.
  */
-static inline void gnrc_sixlowpan_frag_rb_remove(gnrc_sixlowpan_frag_rb_t *rbuf)
-{
-    assert(rbuf != NULL);
-    gnrc_sixlowpan_frag_rb_base_rm(&rbuf->super);
-    rbuf->pkt = NULL;
-}
+void gnrc_sixlowpan_frag_rb_remove(gnrc_sixlowpan_frag_rb_t *rbuf);
 #else
 /* NOPs to be used with gnrc_sixlowpan_iphc if gnrc_sixlowpan_frag_rb is not
  * compiled in */
@@ -36,6 +36,12 @@ typedef struct {
 #if defined(MODULE_GNRC_SIXLOWPAN_FRAG_VRB) || DOXYGEN
     unsigned vrb_full;      /**< counts the number of events where the virtual
                              *   reassembly buffer is full */
+    unsigned vrb_evictions; /**< counts the entries of the virtual reassembly
+                             *   buffer replaced because it was full */
+    unsigned vrb_hits;      /**< successful lookups of fragments in the
+                             *   virtual reassembly buffer */
+    unsigned vrb_misses;    /**< failed lookups of fragments in the virtual
+                             *   reassembly buffer */
 #endif
 } gnrc_sixlowpan_frag_stats_t;
 
@@ -74,6 +74,9 @@ typedef struct {
  * @pre `out_dst != NULL`
  * @pre `out_dst_len > 0`
  *
+ * When the VRB is full, the least recently used entry is replaced if it timed
+ * out or if @ref CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_OVERRIDE_LRU is set.
+ *
  * @return  A new VRB entry.
  * @return  NULL, if VRB is full.
  */
@@ -147,13 +150,7 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_reverse(
  *
  * @param[in] vrb   A VRB entry
  */
-static inline void gnrc_sixlowpan_frag_vrb_rm(gnrc_sixlowpan_frag_vrb_t *vrb)
-{
-    if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB)) {
-        gnrc_sixlowpan_frag_rb_base_rm(&vrb->super);
-    }
-    vrb->super.src_len = 0;
-}
+void gnrc_sixlowpan_frag_vrb_rm(gnrc_sixlowpan_frag_vrb_t *vrb);
 
 /**
  * @brief   Determines if a VRB entry is empty
@@ -149,7 +149,8 @@ void gnrc_tcp_tcb_queue_init(gnrc_tcp_tcb_queue_t *queue);
  * @return   -EINVAL if @p remote and @p tcb address_family do not match
  *                    or @p target_addr is invalid.
  * @return   -EISCONN if @p tcb is already connected.
- * @return   -ENOMEM if there are no receive buffer left to use for @p tcb.
+ * @return   -ENOMEM if there are no receive or send buffer left to use for @p tcb.
+ *                    Increase CONFIG_GNRC_TCP_RCV_BUFFERS or CONFIG_GNRC_TCP_SND_BUFFERS.
  * @return   -EADDRINUSE if @p local_port is already in use.
  * @return   -ETIMEDOUT if the connection attempt timed out.
  * @return   -ECONNREFUSED if the connection attempt was reset by the peer.
@@ -175,8 +176,8 @@ int gnrc_tcp_open(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote, uint16_t loc
  * @return   -EAFNOSUPPORT given address family in @p local is not supported.
  * @return   -EINVAL address_family in @p tcbs and @p local do not match.
  * @return   -EISCONN a TCB in @p tcbs is already connected.
- * @return   -ENOMEM all available receive buffers are in use.
- *                   Increase GNRC_TCP_RCV_BUFFERS.
+ * @return   -ENOMEM all available receive or send buffers are in use.
+ *                   Increase CONFIG_GNRC_TCP_RCV_BUFFERS or CONFIG_GNRC_TCP_SND_BUFFERS.
  */
 int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tcbs_len,
                     const gnrc_tcp_ep_t *local);
@@ -212,19 +213,24 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
  * @pre @p tcb must not be NULL.
  * @pre @p data must not be NULL.
  *
- * @note Blocks until up to @p len bytes were transmitted or an error occurred.
+ * @note Data is copied into the send buffer of @p tcb and transmitted from there.
+ *       Blocks until up to @p len bytes were copied into the send buffer or an
+ *       error occurred. Small writes are coalesced into larger segments while
+ *       a previously sent small segment is unacknowledged (Nagle's algorithm),
+ *       unless CONFIG_GNRC_TCP_NO_NAGLE is set.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
  * @param[in]     len                        Number of bytes that should be transmitted.
- * @param[in]     user_timeout_duration_ms   If not zero and there was not data transmitted
- *                                           the function returns after user_timeout_duration_ms.
+ * @param[in]     user_timeout_duration_ms   If not zero and there was no space in the send
+ *                                           buffer the function returns after
+ *                                           user_timeout_duration_ms.
  *                                           If zero, no timeout will be triggered.
  *                                           If GNRC_TCP_NO_TIMEOUT the timeout is disabled
  *                                           causing the function to block until some data was
- *                                           transmitted or and error occurred.
+ *                                           buffered or and error occurred.
  *
- * @return   The number of successfully transmitted bytes.
+ * @return   The number of bytes copied into the send buffer.
  * @return   -ENOTCONN if connection is not established.
  * @return   -ECONNRESET if connection was reset by the peer.
  * @return   -ECONNABORTED if the connection was aborted.
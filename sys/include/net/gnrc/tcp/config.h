@@ -104,6 +104,58 @@ extern "C" {
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Number of preallocated send buffers.
+ *
+ * Every open connection requires a receive and a send buffer.
+ */
+#ifndef CONFIG_GNRC_TCP_SND_BUFFERS
+#define CONFIG_GNRC_TCP_SND_BUFFERS (CONFIG_GNRC_TCP_RCV_BUFFERS)
+#endif
+
+/**
+ * @brief Send buffer size
+ *
+ * The send buffer holds data written by the user until the peer acknowledged
+ * it. Its size limits the amount of data in flight, so with the default of two
+ * MSS two segments can be sent before an acknowledgment is required.
+ */
+#ifndef CONFIG_GNRC_TCP_SND_BUF_SIZE
+#define CONFIG_GNRC_TCP_SND_BUF_SIZE (2U * CONFIG_GNRC_TCP_MSS)
+#endif
+
+#ifdef DOXYGEN
+/**
+ * @brief Disable Nagle's algorithm (see RFC 896)
+ *
+ * By default, a small segment is held back while a previously sent small
+ * segment is unacknowledged, so that small writes get coalesced into full
+ * sized segments. Define this to send data as soon as the send window permits.
+ */
+#define CONFIG_GNRC_TCP_NO_NAGLE
+#endif
+
+/**
+ * @brief Maximum delay of an acknowledgment in milliseconds (see RFC 1122)
+ *
+ * Acknowledgments for received data are delayed by up to this duration, so
+ * that they can be sent along with data. Every second segment is acknowledged
+ * immediately. Set to 0 to acknowledge every segment immediately.
+ */
+#ifndef CONFIG_GNRC_TCP_DELAYED_ACK_MS
+#define CONFIG_GNRC_TCP_DELAYED_ACK_MS (100U)
+#endif
+
+/**
+ * @brief Number of blocks selectively acknowledged by the peer that are remembered
+ *
+ * Only used with module `gnrc_tcp_sack` (see RFC 2018). Each block takes 8 bytes in
+ * every TCB. Without the TCP timestamp option, a peer reports at most four blocks.
+ */
+#ifndef CONFIG_GNRC_TCP_SACK_BLOCKS
+#define CONFIG_GNRC_TCP_SACK_BLOCKS (3U)
+#endif
+
 /**
  * @brief Lower bound for RTO in milliseconds. Default is 1 sec (see RFC 6298)
  *
@@ -30,10 +30,22 @@
 #include "net/gnrc/ipv6.h"
 #endif
 
+#ifdef MODULE_GNRC_TCP_CONGURE
+#include "congure.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief Block of sequence numbers, used for selective acknowledgments.
+ */
+typedef struct {
+    uint32_t start;        /**< First sequence number of the block */
+    uint32_t end;          /**< Sequence number following the block, equal to start if empty */
+} gnrc_tcp_sack_block_t;
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -50,26 +62,41 @@ typedef struct sock_tcp {
     uint8_t status;        /**< A connections status flags */
     uint32_t snd_una;      /**< Send unacknowledged */
     uint32_t snd_nxt;      /**< Send next */
+    uint32_t snd_max;      /**< Highest sequence number sent */
     uint16_t snd_wnd;      /**< Send window */
     uint32_t snd_wl1;      /**< SeqNo. from last window update */
     uint32_t snd_wl2;      /**< AckNo. from last window update */
+    uint32_t snd_sml;      /**< End of the last small segment sent */
     uint32_t rcv_nxt;      /**< Receive next */
     uint16_t rcv_wnd;      /**< Receive window */
     uint32_t iss;          /**< Initial sequence sumber */
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
     uint32_t rtt_start;    /**< Timer value for rtt estimation */
+    uint32_t rtt_seq;      /**< Sequence number ending the current rtt measurement */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
+    uint32_t probe_timeout; /**< Duration until the next window probe, 0 if not probing */
     uint8_t retries;       /**< Number of retransmissions */
+    uint8_t acks_pending;  /**< Number of received segments not acknowledged yet */
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_msg_event_t event_timeout;    /**< Timeout event */
+    evtimer_msg_event_t event_ack;        /**< Delayed acknowledgment event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
     gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
+    uint8_t *snd_buf_raw;    /**< Pointer to the send buffer */
+    ringbuffer_t snd_buf;    /**< Send buffer data structure, starts at snd_una */
+#ifdef MODULE_GNRC_TCP_CONGURE
+    congure_snd_t *congure;  /**< State object for [CongURE](@ref sys_congure) */
+#endif
+#ifdef MODULE_GNRC_TCP_SACK
+    gnrc_tcp_sack_block_t sack_blocks[CONFIG_GNRC_TCP_SACK_BLOCKS]; /**< Blocks SACKed by the peer */
+    gnrc_tcp_sack_block_t rcv_ooo; /**< Out-of-order data held in the receive buffer */
+#endif
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
     struct sock_tcp *next;   /**< Pointer next TCB */
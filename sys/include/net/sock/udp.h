@@ -372,6 +372,16 @@ typedef struct {
     sock_aux_flags_t flags; /**< Flags used request information */
 } sock_udp_aux_tx_t;
 
+/**
+ * @brief   A datagram of a batch sent with @ref sock_udp_send_batch()
+ */
+typedef struct {
+    const iolist_t *snips;          /**< list of payload chunks, may be `NULL` */
+    const sock_udp_ep_t *remote;    /**< remote end point of the datagram, may
+                                     *   be `NULL`, if the sock has a remote
+                                     *   end point */
+} sock_udp_dgram_t;
+
 /**
  * @brief   Creates a new UDP sock object
  *
@@ -668,6 +678,63 @@ static inline ssize_t sock_udp_recv_buf(sock_udp_t *sock,
 ssize_t sock_udp_sendv_aux(sock_udp_t *sock, const iolist_t *snips,
                            const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux);
 
+/**
+ * @brief   Sends a batch of UDP messages, like `sendmmsg()`
+ *
+ * Every datagram in @p dgrams is sent as by @ref sock_udp_sendv_aux() without
+ * auxiliary data. Stacks that support it hand the whole batch down to the
+ * link layer as one unit, so a burst of small datagrams does not cost a
+ * context switch per datagram and layer. Others send the datagrams one by
+ * one.
+ *
+ * @pre `(dgrams != NULL) && (for every datagram: (sock != NULL || remote != NULL))`
+ *
+ * @param[in] sock      A UDP sock object. May be `NULL`.
+ *                      A sensible local end point should be selected by the
+ *                      implementation in that case.
+ * @param[in] dgrams    The datagrams to send, in order.
+ * @param[in] num       Number of datagrams in @p dgrams.
+ *
+ * @experimental    This function is quite new, and may be subject to sudden
+ *                  API changes. Do not use in production if this is
+ *                  unacceptable.
+ *
+ * @return  The number of datagrams sent. Sending stops at the first datagram
+ *          that could not be sent, so this may be less than @p num.
+ * @return  The error of the first datagram as in @ref sock_udp_sendv_aux(),
+ *          if it could not be sent.
+ */
+ssize_t sock_udp_send_batch(sock_udp_t *sock, const sock_udp_dgram_t *dgrams,
+                            unsigned num);
+
+/**
+ * @brief   Sends a batch of UDP messages one by one
+ *
+ * Implements @ref sock_udp_send_batch() on top of @ref sock_udp_sendv_aux(),
+ * for stacks or configurations without a batched transmit path.
+ *
+ * @param[in] sock      A UDP sock object. May be `NULL`.
+ * @param[in] dgrams    The datagrams to send, in order.
+ * @param[in] num       Number of datagrams in @p dgrams.
+ *
+ * @return  As @ref sock_udp_send_batch()
+ */
+static inline ssize_t sock_udp_send_batch_each(sock_udp_t *sock,
+                                               const sock_udp_dgram_t *dgrams,
+                                               unsigned num)
+{
+    ssize_t res = 0;
+    unsigned numof;
+
+    for (numof = 0; numof < num; numof++) {
+        if ((res = sock_udp_sendv_aux(sock, dgrams[numof].snips,
+                                      dgrams[numof].remote, NULL)) < 0) {
+            break;
+        }
+    }
+    return (numof > 0) ? (ssize_t)numof : res;
+}
+
 /**
  * @brief   Sends a UDP message to remote end point
  *
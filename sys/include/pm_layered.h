@@ -23,6 +23,11 @@
  * - if a mode is blocked, so are implicitly all lower modes
  * - the idle thread automatically selects and sets the lowest unblocked mode
  *
+ * With the `pm_layered_stats` module, @ref pm_set_lowest() additionally
+ * accounts the time spent in each power mode and which source woke the CPU
+ * up, see @ref pm_stats_get(). The `pm stats` shell command prints these
+ * statistics.
+ *
  * In order to use this module, you'll need to implement pm_set().
  *
  * @file
@@ -34,6 +39,7 @@
 #include <stdint.h>
 #include "periph_cpu.h"
 #include "architecture.h"
+#include "modules.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -88,6 +94,91 @@ static inline void pm_unblock(unsigned mode) { (void)mode; }
  */
 void pm_set(unsigned mode);
 
+/**
+ * @name    Power mode statistics configuration
+ * @{
+ */
+/**
+ * @brief   Number of wakeup sources distinguished by the statistics
+ *
+ * Sources from @ref PM_WAKEUP_SRC_USER to this value minus one can be used by
+ * the application and drivers.
+ */
+#ifndef CONFIG_PM_LAYERED_STATS_WAKEUP_NUMOF
+#define CONFIG_PM_LAYERED_STATS_WAKEUP_NUMOF    (4U)
+#endif
+
+/**
+ * @brief   ztimer clock used to measure the time spent in power modes
+ *
+ * The clock is acquired once and then kept running, so it must neither stop
+ * in nor block any of the power modes that are used. Otherwise the time spent
+ * sleeping is under-reported, or the deeper modes are never entered. The
+ * default `ZTIMER_MSEC` is backed by the RTT where available, which fulfills
+ * both. If another clock is configured, its ztimer module has to be selected
+ * by the application.
+ */
+#ifndef PM_LAYERED_STATS_CLOCK
+#define PM_LAYERED_STATS_CLOCK                  ZTIMER_MSEC
+#endif
+
+/**
+ * @brief   Microseconds per tick of @ref PM_LAYERED_STATS_CLOCK
+ */
+#ifndef PM_LAYERED_STATS_US_PER_TICK
+#define PM_LAYERED_STATS_US_PER_TICK            (1000U)
+#endif
+/** @} */
+
+/**
+ * @brief   Wakeup sources known to the power mode statistics
+ */
+enum {
+    PM_WAKEUP_SRC_UNKNOWN,      /**< no source reported before next sleep */
+    PM_WAKEUP_SRC_ZTIMER,       /**< a ztimer clock interrupt */
+    PM_WAKEUP_SRC_USER,         /**< first source free for the application */
+};
+
+/**
+ * @brief   Power mode statistics
+ */
+typedef struct {
+    uint64_t period_us;                         /**< time since reset */
+    uint64_t residency_us[PM_NUM_MODES];        /**< time spent per mode */
+    uint32_t entries[PM_NUM_MODES];             /**< number of entries per mode */
+    /** number of wakeups per source */
+    uint32_t wakeups[CONFIG_PM_LAYERED_STATS_WAKEUP_NUMOF];
+} pm_stats_t;
+
+/**
+ * @brief   Reports the source of the most recent wakeup
+ *
+ * To be called from interrupt handlers that may wake the CPU. Only the first
+ * report after leaving a power mode is counted; wakeups without any report
+ * are counted as @ref PM_WAKEUP_SRC_UNKNOWN.
+ *
+ * @param[in]   source  wakeup source, values outside of
+ *                      @ref CONFIG_PM_LAYERED_STATS_WAKEUP_NUMOF are counted
+ *                      as @ref PM_WAKEUP_SRC_UNKNOWN
+ */
+#if IS_USED(MODULE_PM_LAYERED_STATS)
+void pm_stats_wakeup(unsigned source);
+#else
+static inline void pm_stats_wakeup(unsigned source) { (void)source; }
+#endif
+
+/**
+ * @brief   Gets the power mode statistics since the last reset
+ *
+ * @param[out]  stats   statistics
+ */
+void pm_stats_get(pm_stats_t *stats);
+
+/**
+ * @brief   Resets the power mode statistics
+ */
+void pm_stats_reset(void);
+
 /**
  * @brief   Get currently blocked PM modes
  *
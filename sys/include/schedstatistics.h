@@ -13,8 +13,24 @@
  *              (@ref schedstat_t) for a thread will be updated on every
  *              @ref sched_run().
  *
+ * Besides the CPU time and the number of times a thread was scheduled, the
+ * module counts how often a thread was descheduled while still runnable
+ * (i.e. it was preempted or yielded) and how long it waited for a mutex or
+ * for message IPC. Waiting time is measured from the moment a thread blocks
+ * until it runs again. Use @ref schedstats_get() to query these numbers.
+ * Note that blocking functions such as ztimer_sleep() are implemented on top
+ * of a mutex and thus count as waiting for a mutex as well.
+ *
+ * By default, time is taken from `ZTIMER_USEC` on every context switch. With
+ * the `schedstatistics_cycles` module, the CPU cycle counter is used instead
+ * where one exists (the DWT cycle counter on Cortex-M3 and up), and the
+ * host's monotonic clock on native. This makes every context switch
+ * considerably cheaper, but as the counter is only 32 bit wide, intervals
+ * longer than one counter period (2^32 CPU cycles) are only accounted modulo
+ * that period. CPUs without a cycle counter fall back to `ZTIMER_USEC`.
+ *
  * @note        If auto_init is disabled `init_schedstatistics()` needs to be
- *              called as well as xtimer_init().
+ *              called as well as ztimer_init().
  * @{
  *
  * @file
@@ -27,20 +43,45 @@
 
 #include <stdint.h>
 
+#include "sched.h"
+
 #ifdef __cplusplus
  extern "C" {
 #endif
 
 /**
  *  Scheduler statistics
+ *
+ *  All times are in ticks of the time base selected at compile time, use
+ *  @ref schedstats_get() to get them in microseconds.
  */
 typedef struct {
     uint32_t laststart;      /**< Time stamp of the last time this thread was
-                                  scheduled to run */
+                                  scheduled to run or descheduled */
     unsigned int schedules;  /**< How often the thread was scheduled to run */
-    uint64_t runtime_us;     /**< The total runtime of this thread in microseconds */
+    unsigned int preemptions; /**< How often the thread was descheduled while
+                                   still runnable */
+    uint64_t runtime;        /**< The total runtime of this thread */
+    uint64_t mutex_wait;     /**< Total time spent waiting for a mutex */
+    uint64_t msg_wait;       /**< Total time spent waiting for message IPC */
+    uint8_t blocked_on;      /**< Thread status the thread is blocked in */
 } schedstat_t;
 
+/**
+ * @brief   Scheduler statistics of a single thread, as returned by
+ *          @ref schedstats_get()
+ */
+typedef struct {
+    uint64_t runtime_us;     /**< Total runtime in microseconds */
+    uint64_t mutex_wait_us;  /**< Total time spent waiting for a mutex in
+                                  microseconds */
+    uint64_t msg_wait_us;    /**< Total time spent blocked in message
+                                  send, receive or reply in microseconds */
+    unsigned int schedules;  /**< How often the thread was scheduled to run */
+    unsigned int preemptions; /**< How often the thread was descheduled while
+                                   still runnable */
+} schedstats_t;
+
 /**
  *  Thread statistics table
  */
@@ -52,6 +93,33 @@ extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
  */
 void init_schedstatistics(void);
 
+/**
+ * @brief   Scheduler callback updating @ref sched_pidlist
+ *
+ * @param[in]   active_thread   PID of the thread being descheduled, or
+ *                              @ref KERNEL_PID_UNDEF
+ * @param[in]   next_thread     PID of the thread being scheduled, or
+ *                              @ref KERNEL_PID_UNDEF
+ */
+void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread);
+
+/**
+ * @brief   Get the scheduler statistics of a thread
+ *
+ * The numbers are a consistent snapshot taken at the last context switch of
+ * the thread, the time the thread spent running since then is not included.
+ *
+ * When the `core_idle_thread` module is not used, the time spent idling is
+ * accounted to @ref KERNEL_PID_UNDEF.
+ *
+ * @param[in]   pid     PID of the thread to query
+ * @param[out]  out     statistics of the thread
+ *
+ * @retval  0 on success
+ * @retval  -EINVAL if @p pid is out of range
+ */
+int schedstats_get(kernel_pid_t pid, schedstats_t *out);
+
 #ifdef __cplusplus
 }
 #endif
@@ -297,6 +297,11 @@ typedef void (*ztimer_callback_t)(void *arg);
 struct ztimer_base {
     ztimer_base_t *next;        /**< next timer in list */
     uint32_t offset;            /**< offset from last timer in list */
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+    ztimer_base_t *child;       /**< first child, on heap clocks only */
+    ztimer_base_t *prev;        /**< parent or left sibling, on heap
+                                     clocks only */
+#endif
 };
 
 /**
@@ -387,6 +392,11 @@ struct ztimer_clock {
     uint8_t block_pm_mode;          /**< min. pm mode to block for the clock to run
                                          don't use in combination with ztimer_ondemand! */
 #endif
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+    uint32_t heap_elapsed;          /**< ticks since epoch of the heap keys */
+    bool heap;                      /**< timers are kept in a pairing heap,
+                                         see @ref sys_ztimer_heap           */
+#endif
 };
 
 /**
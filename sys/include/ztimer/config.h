@@ -184,6 +184,36 @@ extern "C" {
 #define CONFIG_ZTIMER_USEC_ADJUST_SLEEP   0
 #endif
 
+/**
+ * @brief   Keep the timers of ZTIMER_USEC in a pairing heap
+ *
+ * Only has an effect if the module `ztimer_heap` is used, see
+ * @ref sys_ztimer_heap.
+ */
+#ifndef CONFIG_ZTIMER_USEC_HEAP
+#define CONFIG_ZTIMER_USEC_HEAP     1
+#endif
+
+/**
+ * @brief   Keep the timers of ZTIMER_MSEC in a pairing heap
+ *
+ * Only has an effect if the module `ztimer_heap` is used, see
+ * @ref sys_ztimer_heap.
+ */
+#ifndef CONFIG_ZTIMER_MSEC_HEAP
+#define CONFIG_ZTIMER_MSEC_HEAP     1
+#endif
+
+/**
+ * @brief   Keep the timers of ZTIMER_SEC in a pairing heap
+ *
+ * Only has an effect if the module `ztimer_heap` is used, see
+ * @ref sys_ztimer_heap.
+ */
+#ifndef CONFIG_ZTIMER_SEC_HEAP
+#define CONFIG_ZTIMER_SEC_HEAP      1
+#endif
+
 /**
  * @brief   Some MCUs clocks need some warm-up time during which timing is
  *          inaccurate. This can be a hindrance when using the @ref
@@ -0,0 +1,128 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_ztimer_heap ztimer pairing heap timer queue
+ * @ingroup     sys_ztimer
+ * @brief       Alternative timer queue for ztimer clocks with many timers
+ *
+ * By default, ztimer keeps the timers of a clock in a delta-encoded, sorted
+ * singly linked list. Setting a timer has to walk that list with interrupts
+ * disabled, so its cost grows linearly with the number of armed timers.
+ *
+ * With the `ztimer_heap` module, a clock can instead keep its timers in a
+ * pairing heap. Setting a timer then costs O(1), removing a timer or
+ * dispatching an expired one costs amortized O(log n). In exchange, every
+ * @ref ztimer_t grows by two pointers and every clock by a few bytes.
+ *
+ * The queue implementation is selected per clock using
+ * @ref ztimer_clock_use_heap(). For the default clocks, this is done in
+ * @ref ztimer_init() according to @ref CONFIG_ZTIMER_USEC_HEAP,
+ * @ref CONFIG_ZTIMER_MSEC_HEAP and @ref CONFIG_ZTIMER_SEC_HEAP.
+ *
+ * Heap keys are stored relative to an epoch that ztimer moves forward
+ * whenever the heap runs empty. Only when a timer is set so far into the
+ * future that its key would not fit in 32 bit anymore, or if the epoch is
+ * older than 2^31 ticks, all keys are rebased in a single O(n) pass.
+ *
+ * `tests/bench/ztimer` can be built with `USEMODULE=ztimer_heap` to compare
+ * the cost of both implementations for a given number of armed timers.
+ *
+ * @{
+ *
+ * @file
+ * @brief       ztimer pairing heap timer queue interface
+ *
+ * The functions in this header other than @ref ztimer_clock_use_heap() are
+ * internal to ztimer and only to be called by ztimer core with interrupts
+ * disabled.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Make @p clock keep its timers in a pairing heap
+ *
+ * Timers already set on @p clock are moved to the heap.
+ *
+ * @param[in]   clock   ztimer clock to operate on
+ */
+void ztimer_clock_use_heap(ztimer_clock_t *clock);
+
+/**
+ * @brief   Insert a timer into the heap of @p clock
+ *
+ * @param[in]   clock   ztimer clock to operate on
+ * @param[in]   entry   timer to insert, with `entry->offset` set to the
+ *                      number of ticks relative to the clock's current base
+ */
+void ztimer_heap_add(ztimer_clock_t *clock, ztimer_base_t *entry);
+
+/**
+ * @brief   Remove a timer from the heap of @p clock
+ *
+ * @param[in]   clock   ztimer clock to operate on
+ * @param[in]   entry   timer to remove, must be in the heap of @p clock
+ */
+void ztimer_heap_del(ztimer_clock_t *clock, ztimer_base_t *entry);
+
+/**
+ * @brief   Remove and return the earliest timer if it has expired
+ *
+ * @param[in]   clock   ztimer clock to operate on
+ *
+ * @return  the earliest timer, if its remaining offset is zero
+ * @return  NULL otherwise
+ */
+ztimer_base_t *ztimer_heap_pop_expired(ztimer_clock_t *clock);
+
+/**
+ * @brief   Get the number of ticks until the earliest timer expires
+ *
+ * @pre     The heap of @p clock is not empty
+ *
+ * @param[in]   clock   ztimer clock to operate on
+ *
+ * @return  remaining ticks relative to the clock's current base,
+ *          0 if the earliest timer has already expired
+ */
+uint32_t ztimer_heap_head_offset(const ztimer_clock_t *clock);
+
+/**
+ * @brief   Advance the clock's base by @p diff ticks
+ *
+ * @param[in]   clock   ztimer clock to operate on
+ * @param[in]   diff    ticks passed since the last call
+ */
+void ztimer_heap_advance(ztimer_clock_t *clock, uint32_t diff);
+
+/**
+ * @brief   Check whether @p entry is in the heap of @p clock
+ *
+ * @param[in]   clock   ztimer clock to operate on
+ * @param[in]   entry   timer to check
+ *
+ * @return  true if @p entry is set
+ */
+static inline bool ztimer_heap_contains(const ztimer_clock_t *clock,
+                                        const ztimer_base_t *entry)
+{
+    return entry->prev || clock->list.next == entry;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
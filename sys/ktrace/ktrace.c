@@ -0,0 +1,171 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_ktrace
+ * @{
+ *
+ * @file
+ * @brief       Kernel event tracer implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "irq.h"
+#include "ktrace.h"
+#include "periph/timer.h"
+#include "sched.h"
+#include "thread.h"
+#include "ztimer.h"
+#include "ztimer/config.h"
+
+#define KTRACE_MAGIC        "KTRC"
+#define KTRACE_VERSION      (2U)
+#define KTRACE_EVENT_SIZE   (8U + sizeof(uintptr_t))
+#define KTRACE_HDR_SIZE     (20U)
+
+static_assert((CONFIG_KTRACE_BUFSIZE & (CONFIG_KTRACE_BUFSIZE - 1)) == 0,
+              "CONFIG_KTRACE_BUFSIZE must be a power of two");
+
+static ktrace_event_t _ring[CONFIG_KTRACE_BUFSIZE];
+/* number of slots reserved so far, the ring position is taken modulo the
+ * buffer size */
+static uint32_t _head;
+static bool _enabled;
+
+void ktrace_record_ctx(ktrace_type_t type, uint8_t ctx, uint16_t obj,
+                       uintptr_t arg)
+{
+    if (!__atomic_load_n(&_enabled, __ATOMIC_RELAXED)) {
+        return;
+    }
+
+    uint32_t pos = __atomic_fetch_add(&_head, 1, __ATOMIC_RELAXED);
+    /* This is called from sched_run(), so read the timer backing ZTIMER_USEC
+     * directly instead of going through ztimer. ktrace_start() acquires
+     * ZTIMER_USEC to keep that timer running. */
+    uint32_t now = timer_read(CONFIG_ZTIMER_USEC_DEV);
+
+    _ring[pos & (CONFIG_KTRACE_BUFSIZE - 1)] = (ktrace_event_t){
+        .time = now,
+        .obj = obj,
+        .type = type,
+        .ctx = ctx,
+        .arg = arg,
+    };
+}
+
+void ktrace_record(ktrace_type_t type, uint16_t obj, uintptr_t arg)
+{
+    ktrace_record_ctx(type, irq_is_in() ? KTRACE_CTX_ISR : thread_getpid(),
+                      obj, arg);
+}
+
+void ktrace_start(void)
+{
+    if (!_enabled) {
+        ztimer_acquire(ZTIMER_USEC);
+        __atomic_store_n(&_enabled, true, __ATOMIC_RELAXED);
+    }
+}
+
+void ktrace_stop(void)
+{
+    if (_enabled) {
+        __atomic_store_n(&_enabled, false, __ATOMIC_RELAXED);
+        ztimer_release(ZTIMER_USEC);
+    }
+}
+
+void ktrace_reset(void)
+{
+    __atomic_store_n(&_head, 0, __ATOMIC_RELAXED);
+}
+
+static void _write_event(const ktrace_event_t *ev, ktrace_write_cb_t write,
+                         void *arg)
+{
+    /* large enough for 64 bit pointers, only KTRACE_EVENT_SIZE bytes are
+     * written */
+    uint8_t buf[16];
+
+    byteorder_htolebufl(&buf[0], ev->time);
+    byteorder_htolebufs(&buf[4], ev->obj);
+    buf[6] = ev->type;
+    buf[7] = ev->ctx;
+    byteorder_htolebufl(&buf[8], (uint32_t)ev->arg);
+    if (sizeof(uintptr_t) > sizeof(uint32_t)) {
+        byteorder_htolebufl(&buf[12], (uint64_t)ev->arg >> 32);
+    }
+    write(buf, KTRACE_EVENT_SIZE, arg);
+}
+
+static void _write_threads(ktrace_write_cb_t write, void *arg)
+{
+    uint8_t buf[4];
+    uint32_t numof = 0;
+
+    /* without CONFIG_THREAD_NAMES, all names are NULL */
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        const thread_t *thread = thread_get(pid);
+        numof += (thread && thread_get_name(thread));
+    }
+    byteorder_htolebufl(buf, numof);
+    write(buf, sizeof(buf), arg);
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        const thread_t *thread = thread_get(pid);
+        const char *name = thread ? thread_get_name(thread) : NULL;
+        if (!name) {
+            continue;
+        }
+        size_t len = strlen(name);
+        buf[0] = pid;
+        buf[1] = (len > UINT8_MAX) ? UINT8_MAX : len;
+        write(buf, 2, arg);
+        write(name, buf[1], arg);
+    }
+}
+
+void ktrace_dump(ktrace_write_cb_t write, void *arg)
+{
+    bool enabled = _enabled;
+    uint8_t hdr[KTRACE_HDR_SIZE];
+
+    ktrace_stop();
+
+    uint32_t head = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+    uint32_t numof = (head > CONFIG_KTRACE_BUFSIZE) ? CONFIG_KTRACE_BUFSIZE
+                                                    : head;
+
+    memcpy(&hdr[0], KTRACE_MAGIC, 4);
+    hdr[4] = KTRACE_VERSION;
+    hdr[5] = KTRACE_EVENT_SIZE;
+    hdr[6] = CONFIG_ZTIMER_USEC_WIDTH;
+    hdr[7] = 0;
+    byteorder_htolebufl(&hdr[8], CONFIG_ZTIMER_USEC_BASE_FREQ);
+    byteorder_htolebufl(&hdr[12], numof);
+    byteorder_htolebufl(&hdr[16], head - numof);
+    write(hdr, sizeof(hdr), arg);
+
+    for (uint32_t i = head - numof; i != head; i++) {
+        _write_event(&_ring[i & (CONFIG_KTRACE_BUFSIZE - 1)], write, arg);
+    }
+    _write_threads(write, arg);
+
+    if (enabled) {
+        ktrace_start();
+    }
+}
+
+void auto_init_ktrace(void)
+{
+    ktrace_start();
+}
@@ -35,6 +35,9 @@
 #include "net/sock/async/event.h"
 #include "net/sock/udp.h"
 #include "net/sock/util.h"
+#if IS_USED(MODULE_GNRC_SOCK_UDP)
+#include "net/gnrc/pktbuf.h"
+#endif
 #include "mutex.h"
 #include "random.h"
 #include "thread.h"
@@ -329,14 +332,48 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
     sock_udp_ep_t remote;
 
     if (type & SOCK_ASYNC_MSG_RECV) {
-        void *stackbuf;
-        void *buf_ctx = NULL;
+        uint8_t *buf = _listen_buf;
         bool truncated = false;
         size_t cursor = 0;
         sock_udp_aux_rx_t aux_in = {
             .flags = SOCK_AUX_GET_LOCAL,
         };
 
+#if IS_USED(MODULE_GNRC_SOCK_UDP)
+        /* With GNRC, the stack lends us the whole packet. A message in a
+         * single snip that is not shared with other receivers, which is the
+         * common case, is processed in place in the packet buffer, as response
+         * handlers may write to it. Responses to requests are built in
+         * _listen_buf. */
+        gnrc_pktsnip_t *pkt;
+        ssize_t res = gnrc_sock_udp_recv_pkt(sock, &pkt, 0, &remote, &aux_in);
+
+        if (res < 0) {
+            DEBUG("gcoap: udp recv failure: %" PRIdSIZE "\n", res);
+            return;
+        }
+        if ((pkt->size == (size_t)res) && (pkt->users == 1) &&
+            ((size_t)res <= sizeof(_listen_buf))) {
+            buf = pkt->data;
+            cursor = res;
+        }
+        else {
+            for (gnrc_pktsnip_t *snip = pkt; snip->type != GNRC_NETTYPE_UDP;
+                 snip = snip->next) {
+                size_t len = snip->size;
+
+                if (cursor + len > sizeof(_listen_buf)) {
+                    len = sizeof(_listen_buf) - cursor;
+                    truncated = true;
+                }
+                memcpy(&_listen_buf[cursor], snip->data, len);
+                cursor += len;
+            }
+        }
+#else
+        void *stackbuf;
+        void *buf_ctx = NULL;
+
         /* The zero-copy _buf API is not used to its full potential here -- we
          * still copy out data in what is a manual version of sock_udp_recv,
          * but this gives the direly needed overflow information.
@@ -363,6 +400,7 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
             memcpy(&_listen_buf[cursor], stackbuf, res);
             cursor += res;
         }
+#endif
 
         /* make sure we reply with the same address that the request was
          * destined for -- except in the multicast case */
@@ -384,7 +422,10 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
             .socket.udp = sock,
          };
 
-        _process_coap_pdu(&socket, &remote, aux_out_ptr, _listen_buf, cursor, truncated);
+        _process_coap_pdu(&socket, &remote, aux_out_ptr, buf, cursor, truncated);
+#if IS_USED(MODULE_GNRC_SOCK_UDP)
+        gnrc_pktbuf_release(pkt);
+#endif
     }
 }
 
@@ -522,6 +563,12 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
 
                         coap_opt_get_uint(&pdu, COAP_OPT_MAX_AGE, &max_age);
                         ce->max_age = ztimer_now(ZTIMER_SEC) + max_age;
+                        if (pdu.buf != _listen_buf) {
+                            /* the response was parsed in place in the
+                             * stack's buffer, it is rebuilt in _listen_buf */
+                            memcpy(_listen_buf, buf, len);
+                            coap_parse_udp(&pdu, _listen_buf, len);
+                        }
                         /* copy all options and possible payload from the cached response
                          * to the new response */
                         assert((uint8_t *)pdu.buf == &_listen_buf[0]);
@@ -584,6 +631,12 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
     }
 
     if (messagelayer_emptyresponse_type != NO_IMMEDIATE_REPLY) {
+        if (pdu.buf != _listen_buf) {
+            /* do not modify the stack's buffer, it may be shared */
+            memcpy(_listen_buf, pdu.buf, sizeof(coap_udp_hdr_t));
+            pdu.buf = _listen_buf;
+            buf = _listen_buf;
+        }
         coap_pkt_set_type(&pdu, messagelayer_emptyresponse_type);
         coap_pkt_set_code(&pdu, COAP_CODE_EMPTY);
         coap_pkt_set_tkl(&pdu, 0);
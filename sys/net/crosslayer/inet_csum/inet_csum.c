@@ -13,15 +13,197 @@
  */
 
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 
+#include "byteorder.h"
+#include "container.h"
 #include "modules.h"
 #include "od.h"
 #include "net/inet_csum.h"
 
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* Summing up the 16 bit words in host byte order yields the byte swapped
+ * checksum on little endian platforms (RFC 1071, section 2 (B)), which allows
+ * to sum up whole machine words at once. All partial sums below are only
+ * congruent to the checksum modulo 0xffff, they are folded in the end. */
+
+#if UINTPTR_MAX > UINT32_MAX
+typedef uint64_t _word_t;
+#else
+typedef uint32_t _word_t;
+#endif
+
+/* Aligned loads through memcpy(), which the compiler turns into single load
+ * instructions without violating strict aliasing */
+static inline uint16_t _load16(const uint8_t *buf)
+{
+    uint16_t v;
+
+    memcpy(&v, __builtin_assume_aligned(buf, sizeof(v)), sizeof(v));
+    return v;
+}
+
+static inline uint32_t _load32(const uint8_t *buf)
+{
+    uint32_t v;
+
+    memcpy(&v, __builtin_assume_aligned(buf, sizeof(v)), sizeof(v));
+    return v;
+}
+
+static inline _word_t _load_word(const uint8_t *buf)
+{
+    _word_t v;
+
+    memcpy(&v, __builtin_assume_aligned(buf, sizeof(v)), sizeof(v));
+    return v;
+}
+
+static inline uint64_t _add(uint64_t sum, _word_t word)
+{
+    sum += word;
+    if (sizeof(_word_t) == sizeof(sum)) {
+        /* end-around carry. 32 bit words can not overflow the sum, as the
+         * buffer length is limited to 16 bit */
+        sum += (sum < word);
+    }
+    return sum;
+}
+
+static inline uint16_t _fold(uint64_t sum)
+{
+    while (sum >> 16) {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+    return sum;
+}
+
+#if defined(__AVX2__)
+static uint64_t _sum_simd(const uint8_t **buf, size_t *len)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i acc = zero;
+    uint32_t lanes[8];
+    uint64_t sum = 0;
+
+    /* 32 bit lanes of 16 bit words can not overflow for 16 bit lengths */
+    while (*len >= sizeof(__m256i)) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(uintptr_t)*buf);
+
+        acc = _mm256_add_epi32(acc, _mm256_unpacklo_epi16(v, zero));
+        acc = _mm256_add_epi32(acc, _mm256_unpackhi_epi16(v, zero));
+        *buf += sizeof(__m256i);
+        *len -= sizeof(__m256i);
+    }
+    _mm256_storeu_si256((__m256i *)(uintptr_t)lanes, acc);
+    for (unsigned i = 0; i < ARRAY_SIZE(lanes); i++) {
+        sum += lanes[i];
+    }
+    return sum;
+}
+#elif defined(__SSE2__)
+static uint64_t _sum_simd(const uint8_t **buf, size_t *len)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = zero;
+    uint32_t lanes[4];
+    uint64_t sum = 0;
+
+    /* 32 bit lanes of 16 bit words can not overflow for 16 bit lengths */
+    while (*len >= sizeof(__m128i)) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(uintptr_t)*buf);
+
+        acc = _mm_add_epi32(acc, _mm_unpacklo_epi16(v, zero));
+        acc = _mm_add_epi32(acc, _mm_unpackhi_epi16(v, zero));
+        *buf += sizeof(__m128i);
+        *len -= sizeof(__m128i);
+    }
+    _mm_storeu_si128((__m128i *)(uintptr_t)lanes, acc);
+    for (unsigned i = 0; i < ARRAY_SIZE(lanes); i++) {
+        sum += lanes[i];
+    }
+    return sum;
+}
+#endif
+
+/* Returns the checksum of buf with the words in host byte order */
+static uint16_t _sum_host(const uint8_t *buf, size_t len)
+{
+    bool odd = (uintptr_t)buf & 1;
+    uint64_t sum = 0;
+
+    if (len == 0) {
+        return 0;
+    }
+    /* Word loads need an even address. Pairing the bytes starting at the
+     * second one byte swaps the sum, which is undone below */
+    if (odd) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        sum = (uint16_t)(*buf << 8);
+#else
+        sum = *buf;
+#endif
+        buf++;
+        len--;
+    }
+    /* align to a machine word, the address is even now */
+    if ((len >= 2) && ((uintptr_t)buf & 2)) {
+        sum += _load16(buf);
+        buf += 2;
+        len -= 2;
+    }
+    if ((sizeof(_word_t) == 8) && (len >= 4) && ((uintptr_t)buf & 4)) {
+        sum += _load32(buf);
+        buf += 4;
+        len -= 4;
+    }
+#if defined(__AVX2__) || defined(__SSE2__)
+    if (len >= 64) {
+        sum += _sum_simd(&buf, &len);
+    }
+#endif
+    while (len >= (4 * sizeof(_word_t))) {
+        sum = _add(sum, _load_word(buf));
+        sum = _add(sum, _load_word(buf + sizeof(_word_t)));
+        sum = _add(sum, _load_word(buf + 2 * sizeof(_word_t)));
+        sum = _add(sum, _load_word(buf + 3 * sizeof(_word_t)));
+        buf += 4 * sizeof(_word_t);
+        len -= 4 * sizeof(_word_t);
+    }
+    while (len >= sizeof(_word_t)) {
+        sum = _add(sum, _load_word(buf));
+        buf += sizeof(_word_t);
+        len -= sizeof(_word_t);
+    }
+    while (len >= 2) {
+        sum = _add(sum, _load16(buf));
+        buf += 2;
+        len -= 2;
+    }
+    if (len) {      /* last byte is the first half of a word */
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        sum = _add(sum, *buf);
+#else
+        sum = _add(sum, (uint16_t)(*buf << 8));
+#endif
+    }
+
+    uint16_t csum = _fold(sum);
+
+    if (odd) {
+        csum = byteorder_swaps(csum);
+    }
+    return csum;
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -44,21 +226,10 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         csum += *buf;         /* add first byte as bottom half of 16-byte word */
         buf++;
         len--;
-        accum_len++;
     }
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
-    }
-
-    if ((accum_len + len) & 1)          /* if accumulated length is odd */
-        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
-
-    while (csum >> 16) {
-        uint16_t carry = csum >> 16;
-        csum = (csum & 0xffff) + carry;
-    }
+    csum += ntohs(_sum_host(buf, len));
+    csum = _fold(csum);
 
     DEBUG("inet_sum: new sum = 0x%04" PRIx32 "\n", csum);
 
@@ -70,6 +70,25 @@ int _gnrc_netapi_send_recv(kernel_pid_t pid, gnrc_pktsnip_t *pkt, uint16_t type)
     return ret;
 }
 
+int gnrc_netapi_send_batch(kernel_pid_t pid, gnrc_pktqueue_t *batch)
+{
+    msg_t cmd = {
+        .type = GNRC_NETAPI_MSG_TYPE_SND_BATCH,
+        .content.ptr = batch,
+    };
+    msg_t ack;
+
+    /* the queue nodes are owned by the caller, so wait until the receiver is
+     * done with them */
+    if (msg_send_receive(&cmd, &ack, pid) < 1) {
+        LOG_WARNING("gnrc_netapi: unable to send batch to %" PRIkernel_pid "\n",
+                    pid);
+        return 0;
+    }
+    assert(ack.type == GNRC_NETAPI_MSG_TYPE_ACK);
+    return (int)ack.content.value;
+}
+
 #ifdef MODULE_GNRC_NETAPI_MBOX
 static inline int _snd_rcv_mbox(mbox_t *mbox, uint16_t type, gnrc_pktsnip_t *pkt)
 {
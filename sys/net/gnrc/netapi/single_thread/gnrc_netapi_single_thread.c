@@ -0,0 +1,144 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ * @ingroup     net_gnrc_netapi_single_thread
+ * @file
+ * @brief       Shared thread of the GNRC protocol layers
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+
+#include "log.h"
+#include "msg.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netapi/notify.h"
+#include "net/gnrc/netapi/single_thread.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "thread.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* Commands dispatched to a layer from another thread carry the index of the
+ * layer and the lower nibble of the command in the message type:
+ * 0b0000_0010_1iii_cccc, i = index of the layer, c = command */
+#define _MSG_TYPE_LAYER         (0x0280U)
+#define _MSG_TYPE_LAYER_MASK    (0xff80U)
+#define _MSG_TYPE_NETAPI        (0x0200U)
+#define _MSG_TYPE_NETAPI_MASK   (0xfff0U)
+
+static_assert(GNRC_NETAPI_SINGLE_THREAD_LAYERS_MAX <= 8,
+              "layer index must fit into 3 bits of the message type");
+
+static char _stack[GNRC_NETAPI_SINGLE_THREAD_STACK_SIZE + DEBUG_EXTRA_STACKSIZE];
+static msg_t _msg_q[GNRC_NETAPI_SINGLE_THREAD_MSG_QUEUE_SIZE];
+static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+static gnrc_netapi_single_thread_layer_t *_layers[GNRC_NETAPI_SINGLE_THREAD_LAYERS_MAX];
+static unsigned _layers_numof;
+/* handles netapi commands sent to the shared thread itself */
+static gnrc_netapi_single_thread_layer_t *_netapi_layer;
+
+static void _dispatch(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    gnrc_netapi_single_thread_layer_t *layer = ctx;
+    msg_t msg = { .content = { .ptr = pkt } };
+
+    if (thread_getpid() == _pid) {
+        /* already running in the shared thread: just call the layer */
+        msg_t reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK,
+                        .content = { .value = (uint32_t)-ENOTSUP } };
+
+        msg.sender_pid = _pid;
+        msg.type = cmd;
+        layer->handler(&msg, &reply);
+        return;
+    }
+    msg.type = _MSG_TYPE_LAYER | (layer->idx << 4) | (cmd & ~_MSG_TYPE_NETAPI_MASK);
+    if (msg_try_send(&msg, _pid) < 1) {
+        LOG_WARNING("gnrc_netapi_single_thread: dropped message (queue is full)\n");
+        /* netapi can't tell that a callback failed, so clean up here */
+        if (cmd == GNRC_NETAPI_MSG_TYPE_NOTIFY) {
+#if IS_USED(MODULE_GNRC_NETAPI_NOTIFY)
+            gnrc_netapi_notify_ack(&((gnrc_netapi_notify_t *)(void *)pkt)->ack);
+#endif
+        }
+        else {
+            gnrc_pktbuf_release_error(pkt, ENOBUFS);
+        }
+    }
+}
+
+static void _handle_msg(msg_t *msg, msg_t *reply)
+{
+    if ((msg->type & _MSG_TYPE_LAYER_MASK) == _MSG_TYPE_LAYER) {
+        gnrc_netapi_single_thread_layer_t *layer = _layers[(msg->type >> 4) & 0x7];
+
+        msg->type = _MSG_TYPE_NETAPI | (msg->type & ~_MSG_TYPE_NETAPI_MASK);
+        layer->handler(msg, reply);
+    }
+    else if ((msg->type & _MSG_TYPE_NETAPI_MASK) == _MSG_TYPE_NETAPI) {
+        /* sent with the PID of the shared thread as the PID of a layer */
+        _netapi_layer->handler(msg, reply);
+    }
+    else {
+        /* timeouts and other events of a layer: every layer ignores the
+         * types it does not know */
+        for (unsigned i = 0; i < _layers_numof; i++) {
+            _layers[i]->handler(msg, reply);
+        }
+    }
+}
+
+static void *_event_loop(void *args)
+{
+    msg_t msgs[CONFIG_GNRC_NETAPI_MSG_BATCH_SIZE];
+
+    (void)args;
+    msg_init_queue(_msg_q, GNRC_NETAPI_SINGLE_THREAD_MSG_QUEUE_SIZE);
+
+    while (1) {
+        DEBUG("gnrc_netapi_single_thread: waiting for incoming message.\n");
+        unsigned num = msg_receive_batch(msgs, ARRAY_SIZE(msgs));
+
+        for (unsigned i = 0; i < num; i++) {
+            /* the layers may change the reply, so preset it every time */
+            msg_t reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK,
+                            .content = { .value = (uint32_t)-ENOTSUP } };
+
+            _handle_msg(&msgs[i], &reply);
+        }
+    }
+
+    return NULL;
+}
+
+kernel_pid_t gnrc_netapi_single_thread_register(gnrc_netapi_single_thread_layer_t *layer,
+                                                gnrc_nettype_t type,
+                                                gnrc_netapi_single_thread_handler_t handler)
+{
+    if (_layers_numof >= GNRC_NETAPI_SINGLE_THREAD_LAYERS_MAX) {
+        return KERNEL_PID_UNDEF;
+    }
+    layer->handler = handler;
+    layer->idx = _layers_numof;
+    layer->cbd.cb = _dispatch;
+    layer->cbd.ctx = layer;
+    _layers[_layers_numof++] = layer;
+    if ((_netapi_layer == NULL) || (type == GNRC_NETTYPE_IPV6)) {
+        _netapi_layer = layer;
+    }
+    if (_pid == KERNEL_PID_UNDEF) {
+        _pid = thread_create(_stack, sizeof(_stack), GNRC_NETAPI_SINGLE_THREAD_PRIO,
+                             0, _event_loop, NULL, "gnrc");
+    }
+    gnrc_netreg_entry_init_cb(&layer->entry, GNRC_NETREG_DEMUX_CTX_ALL, &layer->cbd);
+    gnrc_netreg_register(type, &layer->entry);
+    return _pid;
+}
@@ -2004,6 +2004,17 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
 #endif
 }
 
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+static void _wait_after_send(uint32_t *last_wakeup)
+{
+    ztimer_periodic_wakeup(ZTIMER_USEC, last_wakeup,
+                           CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US);
+    /* override last_wakeup in case last_wakeup +
+     * CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US was in the past */
+    *last_wakeup = ztimer_now(ZTIMER_USEC);
+}
+#endif
+
 static void *_gnrc_netif_thread(void *args)
 {
     _netif_ctx_t *ctx = args;
@@ -2062,16 +2073,24 @@ static void *_gnrc_netif_thread(void *args)
                 DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_SND received\n");
                 _send(netif, msg.content.ptr, false);
 #if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
-                ztimer_periodic_wakeup(
-                        ZTIMER_USEC,
-                        &last_wakeup,
-                        CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US
-                    );
-                /* override last_wakeup in case last_wakeup +
-                 * CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US was in the past */
-                last_wakeup = ztimer_now(ZTIMER_USEC);
+                _wait_after_send(&last_wakeup);
 #endif
                 break;
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+            case GNRC_NETAPI_MSG_TYPE_SND_BATCH:
+                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SND_BATCH received\n");
+                reply.content.value = 0;
+                for (gnrc_pktqueue_t *node = msg.content.ptr; node != NULL;
+                     node = node->next) {
+                    _send(netif, node->pkt, false);
+                    reply.content.value++;
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+                    _wait_after_send(&last_wakeup);
+#endif
+                }
+                msg_reply(&msg, &reply);
+                break;
+#endif
             case GNRC_NETAPI_MSG_TYPE_SET:
                 opt = msg.content.ptr;
 #ifdef MODULE_NETOPT
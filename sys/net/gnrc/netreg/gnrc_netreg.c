@@ -34,6 +34,49 @@
 /* The registry as lookup table by gnrc_nettype_t */
 static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
 
+#if IS_USED(MODULE_GNRC_NETREG_HASHED)
+static_assert((CONFIG_GNRC_NETREG_HASHED_BUCKETS &
+               (CONFIG_GNRC_NETREG_HASHED_BUCKETS - 1)) == 0,
+              "CONFIG_GNRC_NETREG_HASHED_BUCKETS must be a power of 2");
+
+/* The UDP and TCP entries hashed by their demux context (the port) */
+# if IS_USED(MODULE_GNRC_NETTYPE_UDP)
+static gnrc_netreg_entry_t *_udp[CONFIG_GNRC_NETREG_HASHED_BUCKETS];
+# endif
+# if IS_USED(MODULE_GNRC_NETTYPE_TCP)
+static gnrc_netreg_entry_t *_tcp[CONFIG_GNRC_NETREG_HASHED_BUCKETS];
+# endif
+
+static inline unsigned _hash(uint32_t demux_ctx)
+{
+    return demux_ctx & (CONFIG_GNRC_NETREG_HASHED_BUCKETS - 1);
+}
+#endif
+
+/**
+ * @brief   Returns the list holding the entries of @p type with @p demux_ctx
+ *
+ * All entries with the same type and demux context are in the same list, so
+ * gnrc_netreg_getnext() can continue the search from the found entry.
+ */
+static gnrc_netreg_entry_t **_list(gnrc_nettype_t type, uint32_t demux_ctx)
+{
+#if IS_USED(MODULE_GNRC_NETREG_HASHED)
+# if IS_USED(MODULE_GNRC_NETTYPE_UDP)
+    if (type == GNRC_NETTYPE_UDP) {
+        return &_udp[_hash(demux_ctx)];
+    }
+# endif
+# if IS_USED(MODULE_GNRC_NETTYPE_TCP)
+    if (type == GNRC_NETTYPE_TCP) {
+        return &_tcp[_hash(demux_ctx)];
+    }
+# endif
+#endif
+    (void)demux_ctx;
+    return &netreg[type];
+}
+
 /** Held while accessing _lock_counter, and also while the exclusive lock is held */
 static mutex_t _lock_for_counter = MUTEX_INIT;
 /** Number of shared locks on netreg. Saturating arithmetic is used; if this
@@ -64,6 +107,14 @@ void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
     memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+#if IS_USED(MODULE_GNRC_NETREG_HASHED)
+# if IS_USED(MODULE_GNRC_NETTYPE_UDP)
+    memset(_udp, 0, sizeof(_udp));
+# endif
+# if IS_USED(MODULE_GNRC_NETTYPE_TCP)
+    memset(_tcp, 0, sizeof(_tcp));
+# endif
+#endif
 }
 
 void gnrc_netreg_acquire_shared(void) {
@@ -151,15 +202,17 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return -EINVAL;
     }
 
+    gnrc_netreg_entry_t **list = _list(type, entry->demux_ctx);
+
     _gnrc_netreg_acquire_exclusive();
 
     /* don't add the same entry twice */
     gnrc_netreg_entry_t *e;
-    LL_FOREACH(netreg[type], e) {
+    LL_FOREACH(*list, e) {
         assert(entry != e);
     }
 
-    LL_PREPEND(netreg[type], entry);
+    LL_PREPEND(*list, entry);
     _gnrc_netreg_release_exclusive();
 
     return 0;
@@ -171,8 +224,10 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return;
     }
 
+    gnrc_netreg_entry_t **list = _list(type, entry->demux_ctx);
+
     _gnrc_netreg_acquire_exclusive();
-    LL_DELETE(netreg[type], entry);
+    LL_DELETE(*list, entry);
     /* We can release now already: No new references to this entry can be made
      * any more, and the caller is only allowed to reuse the entry and the mbox
      * target referenced by it after *this* function returned, not when the
@@ -214,7 +269,8 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
+        gnrc_netreg_entry_t *head = (from) ? from->next
+                                           : *_list(type, demux_ctx);
         LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
     }
 
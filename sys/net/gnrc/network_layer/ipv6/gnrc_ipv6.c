@@ -38,6 +38,10 @@
 #include "net/gnrc/ipv6/ext/frag.h"
 #endif
 
+#ifdef MODULE_GNRC_NETAPI_SINGLE_THREAD
+#include "net/gnrc/netapi/single_thread.h"
+#endif
+
 #ifdef MODULE_FIB
 #include "net/fib.h"
 #include "net/fib/table.h"
@@ -50,8 +54,15 @@
 
 #define _MAX_L2_ADDR_LEN    (8U)
 
+#if IS_USED(MODULE_GNRC_NETAPI_SINGLE_THREAD)
+static gnrc_netapi_single_thread_layer_t _layer;
+#ifdef MODULE_GNRC_NETAPI_NOTIFY
+static gnrc_netreg_entry_t _discovery_reg;
+#endif
+#else
 static char _stack[GNRC_IPV6_STACK_SIZE + DEBUG_EXTRA_STACKSIZE];
 static msg_t _msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
+#endif
 
 #ifdef MODULE_FIB
 /**
@@ -67,6 +78,48 @@ fib_table_t gnrc_ipv6_fib_table;
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
+#if CONFIG_GNRC_IPV6_DST_CACHE_SIZE
+static_assert((CONFIG_GNRC_IPV6_DST_CACHE_SIZE &
+               (CONFIG_GNRC_IPV6_DST_CACHE_SIZE - 1)) == 0,
+              "CONFIG_GNRC_IPV6_DST_CACHE_SIZE must be a power of two");
+
+/**
+ * @brief   Entry of the destination cache
+ */
+typedef struct {
+    ipv6_addr_t dst;            /**< the destination */
+    gnrc_netif_t *netif;        /**< interface given for the destination */
+    gnrc_ipv6_nib_nc_t nh;      /**< next hop to the destination */
+    uint32_t generation;        /**< NIB generation the next hop is valid for,
+                                     0 if the entry was never filled */
+} _dst_cache_entry_t;
+
+/**
+ * @brief   Destination cache, direct-mapped by the destination
+ */
+static _dst_cache_entry_t _dst_cache[CONFIG_GNRC_IPV6_DST_CACHE_SIZE];
+#endif
+
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+/**
+ * @brief   State of the send batch currently handled
+ */
+static struct {
+    /**
+     * @brief   Nodes of the batch that do not carry a packet anymore
+     *
+     * While there are some, packets for an interface are collected in `out`
+     * instead of being sent one by one.
+     */
+    gnrc_pktqueue_t *free;
+    gnrc_pktqueue_t *out;       /**< packets collected for the interfaces */
+    gnrc_netif_t *nh_netif;     /**< interface given for the cached next hop */
+    ipv6_addr_t nh_dst;         /**< destination of the cached next hop */
+    gnrc_ipv6_nib_nc_t nh;      /**< the cached next hop */
+    bool nh_valid;              /**< the next hop cache is valid */
+} _batch;
+#endif
+
 kernel_pid_t gnrc_ipv6_pid = KERNEL_PID_UNDEF;
 
 /* handles GNRC_NETAPI_MSG_TYPE_RCV commands */
@@ -76,18 +129,41 @@ static void _receive(gnrc_pktsnip_t *pkt);
  * assume it is already prepared */
 static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr);
 
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+/* Sends a batch of packets */
+static unsigned _send_batch(gnrc_pktqueue_t *batch);
+#endif
+
 #ifdef MODULE_GNRC_IPV6_EXT_FRAG
 static void _send_by_netif_hdr(gnrc_pktsnip_t *pkt);
 #endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
+#if IS_USED(MODULE_GNRC_NETAPI_SINGLE_THREAD)
+/* handles messages of the shared thread */
+static void _handle_msg(msg_t *msg, msg_t *reply);
+#else
 /* Main event loop for IPv6 */
 static void *_event_loop(void *args);
+#endif
 
 kernel_pid_t gnrc_ipv6_init(void)
 {
     if (gnrc_ipv6_pid == KERNEL_PID_UNDEF) {
+#if IS_USED(MODULE_GNRC_NETAPI_SINGLE_THREAD)
+#ifdef MODULE_GNRC_IPV6_EXT_FRAG
+        gnrc_ipv6_ext_frag_init();
+#endif
+        gnrc_ipv6_pid = gnrc_netapi_single_thread_register(&_layer, GNRC_NETTYPE_IPV6,
+                                                           _handle_msg);
+#ifdef MODULE_GNRC_NETAPI_NOTIFY
+        gnrc_netreg_entry_init_cb(&_discovery_reg, GNRC_NETREG_DEMUX_CTX_ALL,
+                                  &_layer.cbd);
+        gnrc_netreg_register(GNRC_NETTYPE_L2_DISCOVERY, &_discovery_reg);
+#endif
+#else
         gnrc_ipv6_pid = thread_create(_stack, sizeof(_stack), GNRC_IPV6_PRIO,
                                       0,
                                       _event_loop, NULL, "ipv6");
+#endif
     }
 
 #ifdef MODULE_FIB
@@ -184,14 +260,11 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
  */
 static inline bool _find_entry_in_nc(uint8_t *l2addr, uint8_t l2addr_len, ipv6_addr_t *ipv6)
 {
-    void *state = NULL;
     gnrc_ipv6_nib_nc_t nce;
 
-    while (gnrc_ipv6_nib_nc_iter(0, &state, &nce)) {
-        if (l2util_addr_equal(l2addr, l2addr_len, nce.l2addr, nce.l2addr_len)) {
-            *ipv6 = nce.ipv6;
-            return true;
-        }
+    if (gnrc_ipv6_nib_nc_get_by_l2addr(0, l2addr, l2addr_len, &nce)) {
+        *ipv6 = nce.ipv6;
+        return true;
     }
     return false;
 }
@@ -279,9 +352,83 @@ static inline void _netapi_notify_event(gnrc_netapi_notify_t *notify)
     }
 }
 
+static void _handle_msg(msg_t *msg, msg_t *reply)
+{
+    switch (msg->type) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV received\n");
+            _receive(msg->content.ptr);
+            break;
+
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
+            _send(msg->content.ptr, true);
+            break;
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+        case GNRC_NETAPI_MSG_TYPE_SND_BATCH:
+            DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND_BATCH received\n");
+            reply->content.value = _send_batch(msg->content.ptr);
+            msg_reply(msg, reply);
+            break;
+#endif
+
+        case GNRC_NETAPI_MSG_TYPE_GET:
+        case GNRC_NETAPI_MSG_TYPE_SET:
+            DEBUG("ipv6: reply to unsupported get/set\n");
+            reply->content.value = -ENOTSUP;
+            msg_reply(msg, reply);
+            break;
+        case GNRC_NETAPI_MSG_TYPE_NOTIFY:
+            DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_NOTIFY received\n");
+            _netapi_notify_event(msg->content.ptr);
+            break;
+#ifdef MODULE_GNRC_IPV6_EXT_FRAG
+        case GNRC_IPV6_EXT_FRAG_RBUF_GC:
+            gnrc_ipv6_ext_frag_rbuf_gc();
+            break;
+        case GNRC_IPV6_EXT_FRAG_CONTINUE:
+            DEBUG("ipv6: continue fragmenting packet\n");
+            gnrc_ipv6_ext_frag_send(msg->content.ptr);
+            break;
+        case GNRC_IPV6_EXT_FRAG_SEND:
+            DEBUG("ipv6: send fragment\n");
+            _send_by_netif_hdr(msg->content.ptr);
+            break;
+#endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
+        case GNRC_IPV6_NIB_SND_UC_NS:
+        case GNRC_IPV6_NIB_SND_MC_NS:
+        case GNRC_IPV6_NIB_SND_NA:
+        case GNRC_IPV6_NIB_SEARCH_RTR:
+        case GNRC_IPV6_NIB_REPLY_RS:
+        case GNRC_IPV6_NIB_SND_MC_RA:
+        case GNRC_IPV6_NIB_REACH_TIMEOUT:
+        case GNRC_IPV6_NIB_DELAY_TIMEOUT:
+        case GNRC_IPV6_NIB_ADDR_REG_TIMEOUT:
+        case GNRC_IPV6_NIB_ABR_TIMEOUT:
+        case GNRC_IPV6_NIB_PFX_TIMEOUT:
+        case GNRC_IPV6_NIB_RTR_TIMEOUT:
+        case GNRC_IPV6_NIB_RECALC_REACH_TIME:
+        case GNRC_IPV6_NIB_REREG_ADDRESS:
+        case GNRC_IPV6_NIB_DAD:
+        case GNRC_IPV6_NIB_VALID_ADDR:
+            DEBUG("ipv6: NIB timer event received\n");
+            gnrc_ipv6_nib_handle_timer_event(msg->content.ptr, msg->type);
+            break;
+        case GNRC_IPV6_NIB_IFACE_UP:
+            gnrc_ipv6_nib_iface_up(msg->content.ptr);
+            break;
+        case GNRC_IPV6_NIB_IFACE_DOWN:
+            gnrc_ipv6_nib_iface_down(msg->content.ptr, false);
+            break;
+        default:
+            break;
+    }
+}
+
+#if !IS_USED(MODULE_GNRC_NETAPI_SINGLE_THREAD)
 static void *_event_loop(void *args)
 {
-    msg_t msg, reply;
+    msg_t msgs[CONFIG_GNRC_NETAPI_MSG_BATCH_SIZE], reply;
 
     /* Register entry for messages in IPv6 context. */
     gnrc_netreg_entry_t me_ipv6_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
@@ -314,74 +461,16 @@ static void *_event_loop(void *args)
     /* start event loop */
     while (1) {
         DEBUG("ipv6: waiting for incoming message.\n");
-        msg_receive(&msg);
-
-        switch (msg.type) {
-            case GNRC_NETAPI_MSG_TYPE_RCV:
-                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV received\n");
-                _receive(msg.content.ptr);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_SND:
-                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
-                _send(msg.content.ptr, true);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_GET:
-            case GNRC_NETAPI_MSG_TYPE_SET:
-                DEBUG("ipv6: reply to unsupported get/set\n");
-                reply.content.value = -ENOTSUP;
-                msg_reply(&msg, &reply);
-                break;
-            case GNRC_NETAPI_MSG_TYPE_NOTIFY:
-                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_NOTIFY received\n");
-                _netapi_notify_event(msg.content.ptr);
-                break;
-#ifdef MODULE_GNRC_IPV6_EXT_FRAG
-            case GNRC_IPV6_EXT_FRAG_RBUF_GC:
-                gnrc_ipv6_ext_frag_rbuf_gc();
-                break;
-            case GNRC_IPV6_EXT_FRAG_CONTINUE:
-                DEBUG("ipv6: continue fragmenting packet\n");
-                gnrc_ipv6_ext_frag_send(msg.content.ptr);
-                break;
-            case GNRC_IPV6_EXT_FRAG_SEND:
-                DEBUG("ipv6: send fragment\n");
-                _send_by_netif_hdr(msg.content.ptr);
-                break;
-#endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
-            case GNRC_IPV6_NIB_SND_UC_NS:
-            case GNRC_IPV6_NIB_SND_MC_NS:
-            case GNRC_IPV6_NIB_SND_NA:
-            case GNRC_IPV6_NIB_SEARCH_RTR:
-            case GNRC_IPV6_NIB_REPLY_RS:
-            case GNRC_IPV6_NIB_SND_MC_RA:
-            case GNRC_IPV6_NIB_REACH_TIMEOUT:
-            case GNRC_IPV6_NIB_DELAY_TIMEOUT:
-            case GNRC_IPV6_NIB_ADDR_REG_TIMEOUT:
-            case GNRC_IPV6_NIB_ABR_TIMEOUT:
-            case GNRC_IPV6_NIB_PFX_TIMEOUT:
-            case GNRC_IPV6_NIB_RTR_TIMEOUT:
-            case GNRC_IPV6_NIB_RECALC_REACH_TIME:
-            case GNRC_IPV6_NIB_REREG_ADDRESS:
-            case GNRC_IPV6_NIB_DAD:
-            case GNRC_IPV6_NIB_VALID_ADDR:
-                DEBUG("ipv6: NIB timer event received\n");
-                gnrc_ipv6_nib_handle_timer_event(msg.content.ptr, msg.type);
-                break;
-            case GNRC_IPV6_NIB_IFACE_UP:
-                gnrc_ipv6_nib_iface_up(msg.content.ptr);
-                break;
-            case GNRC_IPV6_NIB_IFACE_DOWN:
-                gnrc_ipv6_nib_iface_down(msg.content.ptr, false);
-                break;
-            default:
-                break;
+        unsigned num = msg_receive_batch(msgs, ARRAY_SIZE(msgs));
+
+        for (unsigned i = 0; i < num; i++) {
+            _handle_msg(&msgs[i], &reply);
         }
     }
 
     return NULL;
 }
+#endif
 
 static void _send_to_iface(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
@@ -419,6 +508,17 @@ static void _send_to_iface(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
         }
         return;
     }
+#endif
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    if (_batch.free != NULL) {
+        gnrc_pktqueue_t *node = gnrc_pktqueue_remove_head(&_batch.free);
+
+        DEBUG("ipv6: collect packet for interface %" PRIkernel_pid "\n",
+              netif->pid);
+        node->pkt = pkt;
+        gnrc_pktqueue_add(&_batch.out, node);
+        return;
+    }
 #endif
     if (gnrc_netif_send(netif, pkt) < 1) {
         DEBUG("ipv6: unable to send packet\n");
@@ -614,6 +714,83 @@ static void _send_by_netif_hdr(gnrc_pktsnip_t *pkt)
 }
 #endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
 
+#if CONFIG_GNRC_IPV6_DST_CACHE_SIZE
+static inline unsigned _dst_cache_idx(const ipv6_addr_t *dst)
+{
+    uint32_t hash = dst->u32[0].u32 ^ dst->u32[1].u32 ^ dst->u32[2].u32 ^
+                    dst->u32[3].u32;
+
+    hash ^= hash >> 16;
+    hash ^= hash >> 8;
+    return hash & (CONFIG_GNRC_IPV6_DST_CACHE_SIZE - 1);
+}
+
+static bool _dst_cacheable(const gnrc_ipv6_nib_nc_t *nce)
+{
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
+    gnrc_netif_t *netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(nce));
+
+    /* the routing protocol wants to know about every use of a route */
+    return (netif != NULL) && (netif->ipv6.route_info_cb == NULL);
+#else
+    (void)nce;
+    return true;
+#endif
+}
+#endif  /* CONFIG_GNRC_IPV6_DST_CACHE_SIZE */
+
+static int _get_next_hop_l2addr(const ipv6_addr_t *dst, gnrc_netif_t *netif,
+                                gnrc_pktsnip_t *pkt, gnrc_ipv6_nib_nc_t *nce)
+{
+#if CONFIG_GNRC_IPV6_DST_CACHE_SIZE
+    _dst_cache_entry_t *entry = &_dst_cache[_dst_cache_idx(dst)];
+    /* get the generation before the lookup, so a change of the NIB during the
+     * lookup is noticed */
+    uint32_t generation = gnrc_ipv6_nib_generation();
+
+    if ((entry->generation == generation) &&
+        (entry->netif == netif) && ipv6_addr_equal(&entry->dst, dst)) {
+        DEBUG("ipv6: use cached next hop to %s\n",
+              ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+        *nce = entry->nh;
+        return 0;
+    }
+    if (gnrc_ipv6_nib_get_next_hop_l2addr(dst, netif, pkt, nce) < 0) {
+        return -1;
+    }
+    /* a lookup that changed the NIB (e.g. started neighbor unreachability
+     * detection) changes the generation, so its result is not cached */
+    if ((gnrc_ipv6_nib_generation() == generation) && _dst_cacheable(nce)) {
+        entry->dst = *dst;
+        entry->netif = netif;
+        entry->nh = *nce;
+        entry->generation = generation;
+    }
+    return 0;
+#elif IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    /* the packets of a batch often share their destination, so only ask the
+     * NIB for the first of them */
+    if (_batch.nh_valid && (_batch.nh_netif == netif) &&
+        ipv6_addr_equal(&_batch.nh_dst, dst)) {
+        DEBUG("ipv6: use next hop of previous packet in batch\n");
+        *nce = _batch.nh;
+        return 0;
+    }
+    if (gnrc_ipv6_nib_get_next_hop_l2addr(dst, netif, pkt, nce) < 0) {
+        return -1;
+    }
+    if (_batch.free != NULL) {
+        _batch.nh_netif = netif;
+        _batch.nh_dst = *dst;
+        _batch.nh = *nce;
+        _batch.nh_valid = true;
+    }
+    return 0;
+#else
+    return gnrc_ipv6_nib_get_next_hop_l2addr(dst, netif, pkt, nce);
+#endif
+}
+
 static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                           gnrc_netif_t *netif, ipv6_hdr_t *ipv6_hdr,
                           uint8_t netif_hdr_flags)
@@ -621,8 +798,7 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
     gnrc_ipv6_nib_nc_t nce;
 
     DEBUG("ipv6: send unicast\n");
-    if (gnrc_ipv6_nib_get_next_hop_l2addr(&ipv6_hdr->dst, netif, pkt,
-                                          &nce) < 0) {
+    if (_get_next_hop_l2addr(&ipv6_hdr->dst, netif, pkt, &nce) < 0) {
         /* packet is released by NIB */
         DEBUG("ipv6: no link-layer address or interface for next hop to %s\n",
               ipv6_addr_to_str(addr_str, &ipv6_hdr->dst, sizeof(addr_str)));
@@ -858,6 +1034,51 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
     }
 }
 
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+static unsigned _send_batch(gnrc_pktqueue_t *batch)
+{
+    unsigned numof = 0;
+
+    while (batch != NULL) {
+        gnrc_pktqueue_t *node = gnrc_pktqueue_remove_head(&batch);
+        gnrc_pktsnip_t *pkt = node->pkt;
+
+        /* the node can carry this packet (or one of its copies) to the
+         * interface */
+        node->pkt = NULL;
+        gnrc_pktqueue_add(&_batch.free, node);
+        _send(pkt, true);
+        numof++;
+    }
+    _batch.free = NULL;
+    _batch.nh_valid = false;
+    /* hand every run of packets for the same interface down as one batch */
+    while (_batch.out != NULL) {
+        gnrc_pktqueue_t *run = _batch.out, *last = run;
+        gnrc_netif_t *netif = gnrc_netif_hdr_get_netif(run->pkt->data);
+        int res;
+
+        while ((last->next != NULL) &&
+               (gnrc_netif_hdr_get_netif(last->next->pkt->data) == netif)) {
+            last = last->next;
+        }
+        _batch.out = last->next;
+        last->next = NULL;
+        DEBUG("ipv6: send batch to interface %" PRIkernel_pid "\n",
+              netif->pid);
+        res = gnrc_netapi_send_batch(netif->pid, run);
+        /* release what the interface did not take over */
+        for (gnrc_pktqueue_t *node = run; node != NULL; node = node->next) {
+            if (res-- <= 0) {
+                DEBUG("ipv6: unable to send packet\n");
+                gnrc_pktbuf_release(node->pkt);
+            }
+        }
+    }
+    return numof;
+}
+#endif
+
 /* functions for receiving */
 static inline bool _pkt_not_for_me(gnrc_netif_t **netif, ipv6_hdr_t *hdr)
 {
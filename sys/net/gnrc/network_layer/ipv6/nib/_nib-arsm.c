@@ -156,8 +156,8 @@ void _handle_sl2ao(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
         /* a 6LR MUST NOT modify an existing NCE based on an SL2AO in an RS
          * see https://tools.ietf.org/html/rfc6775#section-6.3 */
         if (!_rtr_sol_on_6lr(netif, icmpv6)) {
-            nce->l2addr_len = l2addr_len;
-            memcpy(nce->l2addr, sl2ao + 1, l2addr_len);
+            _nib_onl_set_l2addr(nce, (const uint8_t *)(sl2ao + 1),
+                                l2addr_len);
         }
 #endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
     }
@@ -357,11 +357,11 @@ void _handle_adv_l2(gnrc_netif_t *netif, _nib_onl_entry_t *nce,
         bool nce_was_incomplete =
             (_get_nud_state(nce) == GNRC_IPV6_NIB_NC_INFO_NUD_STATE_INCOMPLETE);
         if (tl2ao != NULL) {
-            nce->l2addr_len = l2addr_len;
-            memcpy(nce->l2addr, tl2ao + 1, l2addr_len);
+            _nib_onl_set_l2addr(nce, (const uint8_t *)(tl2ao + 1),
+                                l2addr_len);
         }
         else {
-            nce->l2addr_len = 0;
+            _nib_onl_set_l2addr(nce, NULL, 0);
         }
         if (_sflag_set((ndp_nbr_adv_t *)icmpv6)) {
             _set_reachable(netif, nce);
@@ -448,8 +448,11 @@ void _set_unreachable(gnrc_netif_t *netif, _nib_onl_entry_t *nce)
 void _set_nud_state(gnrc_netif_t *netif, _nib_onl_entry_t *nce,
                     uint16_t state)
 {
-    nce->info &= ~GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
-    nce->info |= state;
+    if ((nce->info & GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK) != state) {
+        nce->info &= ~GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
+        nce->info |= state;
+        _nib_changed();
+    }
 
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
     gnrc_netif_acquire(netif);
@@ -26,6 +26,7 @@
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/netif/internal.h"
 #include "net/ipv6/addr.h"
+#include "net/l2util.h"
 #include "random.h"
 
 #include "_nib-internal.h"
@@ -36,6 +37,8 @@
 
 /* pointers for default router selection */
 _nib_dr_entry_t *_prime_def_router = NULL;
+/* starts at 1, see _nib_changed() */
+uint32_t _nib_generation = 1;
 static clist_node_t _next_removable = { NULL };
 
 static _nib_onl_entry_t _nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
@@ -55,6 +58,322 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node);
 static inline bool _node_unreachable(_nib_onl_entry_t *node);
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+/* Path-compressed binary trie over the prefixes of the off-link entries.
+ * Every node without entries has two children, so 2 * OFFL_NUMOF - 1 nodes
+ * are always enough. Index 0 is used as NIL, both for nodes and for entries
+ * (which are stored as index into _dsts + 1), so the zero-initialized trie is
+ * empty. */
+#define _TRIE_NIL       (0U)
+#define _TRIE_NUMOF     (2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF)
+
+static_assert(_TRIE_NUMOF <= UINT16_MAX,
+              "CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF too large for the trie");
+
+typedef struct {
+    ipv6_addr_t pfx;            /* prefix, with the bits after pfx_len unset */
+    uint16_t child[2];          /* sub-tries by bit pfx_len of the prefix */
+    uint16_t dsts;              /* entries with exactly this prefix */
+    uint8_t pfx_len;            /* prefix length */
+} _trie_node_t;
+
+static _trie_node_t _trie[_TRIE_NUMOF];
+static uint16_t _trie_root;
+static uint16_t _trie_used;     /* nodes ever used, _trie[1.._trie_used] */
+static uint16_t _trie_free;     /* free list, linked by child[0] */
+/* next entry with the same prefix, in ascending order as the linear search
+ * returns the first entry of the array */
+static uint16_t _trie_dsts_next[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF + 1];
+
+static inline unsigned _bit(const ipv6_addr_t *addr, unsigned pos)
+{
+    return (addr->u8[pos / 8] >> (7 - (pos % 8))) & 1;
+}
+
+static uint16_t _trie_node_alloc(const ipv6_addr_t *pfx, unsigned pfx_len,
+                                 uint16_t dsts)
+{
+    uint16_t n = _trie_free;
+
+    if (n != _TRIE_NIL) {
+        _trie_free = _trie[n].child[0];
+    }
+    else {
+        n = ++_trie_used;
+    }
+    assert(n < _TRIE_NUMOF);
+    memset(&_trie[n], 0, sizeof(_trie[n]));
+    ipv6_addr_init_prefix(&_trie[n].pfx, pfx, pfx_len);
+    _trie[n].pfx_len = pfx_len;
+    _trie[n].dsts = dsts;
+    return n;
+}
+
+static void _trie_add(const _nib_offl_entry_t *dst)
+{
+    uint16_t idx = (dst - _dsts) + 1;
+    uint16_t *link = &_trie_root;
+
+    _trie_dsts_next[idx] = _TRIE_NIL;
+    while (*link != _TRIE_NIL) {
+        _trie_node_t *node = &_trie[*link];
+        unsigned match = ipv6_addr_match_prefix(&node->pfx, &dst->pfx);
+
+        if (match > dst->pfx_len) {
+            match = dst->pfx_len;
+        }
+        if (match < node->pfx_len) {
+            /* dst branches off above node: insert a new node at the fork */
+            uint16_t fork = _trie_node_alloc(&dst->pfx, match, _TRIE_NIL);
+
+            _trie[fork].child[_bit(&node->pfx, match)] = *link;
+            if (match == dst->pfx_len) {
+                _trie[fork].dsts = idx;
+            }
+            else {
+                _trie[fork].child[_bit(&dst->pfx, match)] =
+                    _trie_node_alloc(&dst->pfx, dst->pfx_len, idx);
+            }
+            *link = fork;
+            return;
+        }
+        if (node->pfx_len == dst->pfx_len) {
+            uint16_t *next = &node->dsts;
+
+            while ((*next != _TRIE_NIL) && (*next < idx)) {
+                next = &_trie_dsts_next[*next];
+            }
+            _trie_dsts_next[idx] = *next;
+            *next = idx;
+            return;
+        }
+        link = &node->child[_bit(&dst->pfx, node->pfx_len)];
+    }
+    *link = _trie_node_alloc(&dst->pfx, dst->pfx_len, idx);
+}
+
+/* removes the node at link if it is not needed as fork anymore */
+static void _trie_compact(uint16_t *link)
+{
+    _trie_node_t *node = &_trie[*link];
+    uint16_t n = *link;
+
+    if ((node->dsts != _TRIE_NIL) ||
+        ((node->child[0] != _TRIE_NIL) && (node->child[1] != _TRIE_NIL))) {
+        return;
+    }
+    *link = (node->child[0] != _TRIE_NIL) ? node->child[0] : node->child[1];
+    node->child[0] = _trie_free;
+    _trie_free = n;
+}
+
+static void _trie_del(const _nib_offl_entry_t *dst)
+{
+    uint16_t idx = (dst - _dsts) + 1;
+    uint16_t *parent = NULL;
+    uint16_t *link = &_trie_root;
+    uint16_t *next;
+
+    while ((*link != _TRIE_NIL) && (_trie[*link].pfx_len < dst->pfx_len)) {
+        parent = link;
+        link = &_trie[*link].child[_bit(&dst->pfx, _trie[*link].pfx_len)];
+    }
+    assert((*link != _TRIE_NIL) && (_trie[*link].pfx_len == dst->pfx_len));
+    for (next = &_trie[*link].dsts; *next != idx;
+         next = &_trie_dsts_next[*next]) {
+        assert(*next != _TRIE_NIL);
+    }
+    *next = _trie_dsts_next[idx];
+    _trie_compact(link);
+    if (parent != NULL) {
+        _trie_compact(parent);
+    }
+}
+
+static _nib_offl_entry_t *_trie_get_match(const ipv6_addr_t *addr)
+{
+    _nib_offl_entry_t *res = NULL;
+    uint16_t n = _trie_root;
+
+    while (n != _TRIE_NIL) {
+        const _trie_node_t *node = &_trie[n];
+
+        if (ipv6_addr_match_prefix(&node->pfx, addr) < node->pfx_len) {
+            break;
+        }
+        for (uint16_t idx = node->dsts; idx != _TRIE_NIL;
+             idx = _trie_dsts_next[idx]) {
+            if (_dsts[idx - 1].mode != _EMPTY) {
+                res = &_dsts[idx - 1];
+                break;
+            }
+        }
+        if (node->pfx_len == IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+        n = node->child[_bit(addr, node->pfx_len)];
+    }
+    return res;
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+/* Open addressing hash tables with linear probing over the on-link entries.
+ * Slots store the index into _nodes + 1, so 0 marks a free slot, and with
+ * twice as many slots as entries there is always a free one to end a probe
+ * sequence. A node is indexed by its IPv6 address while the address is
+ * specified, regardless of its mode, as _nib_onl_alloc() also matches empty
+ * entries. The interface is not part of the key, since both the requested
+ * and the stored interface may be 0 for "any": lookups check the interface
+ * of all nodes with the address and return the one with the lowest index,
+ * i.e. the one the linear search would have found. */
+#define _HASH_NIL       (0U)
+#define _HASH_NUMOF     (2 * CONFIG_GNRC_IPV6_NIB_NUMOF)
+
+static_assert(_HASH_NUMOF <= UINT16_MAX,
+              "CONFIG_GNRC_IPV6_NIB_NUMOF too large for the hash index");
+
+typedef unsigned (*_node_hash_t)(const _nib_onl_entry_t *node);
+
+static uint16_t _ipv6_idx[_HASH_NUMOF];
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+/* nodes with a link-layer address, by link-layer address */
+static uint16_t _l2addr_idx[_HASH_NUMOF];
+#endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
+
+static inline unsigned _hash_next(unsigned slot)
+{
+    return (slot + 1) % _HASH_NUMOF;
+}
+
+static unsigned _hash_ipv6(const ipv6_addr_t *addr)
+{
+    uint32_t h = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                 addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    /* finalizer of MurmurHash3 to spread the bits of the interface
+     * identifier */
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+    return h % _HASH_NUMOF;
+}
+
+static unsigned _node_hash_ipv6(const _nib_onl_entry_t *node)
+{
+    return _hash_ipv6(&node->ipv6);
+}
+
+static void _idx_add(uint16_t *table, unsigned slot,
+                     const _nib_onl_entry_t *node)
+{
+    while (table[slot] != _HASH_NIL) {
+        slot = _hash_next(slot);
+    }
+    table[slot] = (node - _nodes) + 1;
+}
+
+static void _idx_del(uint16_t *table, _node_hash_t hash,
+                     const _nib_onl_entry_t *node)
+{
+    uint16_t idx = (node - _nodes) + 1;
+    unsigned hole = hash(node);
+
+    while (table[hole] != idx) {
+        assert(table[hole] != _HASH_NIL);
+        hole = _hash_next(hole);
+    }
+    table[hole] = _HASH_NIL;
+    /* backward shift deletion: close the hole with later slots of the probe
+     * sequence that would not be found anymore otherwise */
+    for (unsigned slot = _hash_next(hole); table[slot] != _HASH_NIL;
+         slot = _hash_next(slot)) {
+        unsigned home = hash(&_nodes[table[slot] - 1]);
+
+        if (((slot + _HASH_NUMOF - home) % _HASH_NUMOF) >=
+            ((slot + _HASH_NUMOF - hole) % _HASH_NUMOF)) {
+            table[hole] = table[slot];
+            table[slot] = _HASH_NIL;
+            hole = slot;
+        }
+    }
+}
+
+/* lowest node with addr, on iface if exact, else usable for iface */
+static _nib_onl_entry_t *_ipv6_idx_get(const ipv6_addr_t *addr,
+                                       unsigned iface, bool exact)
+{
+    _nib_onl_entry_t *res = NULL;
+
+    for (unsigned slot = _hash_ipv6(addr); _ipv6_idx[slot] != _HASH_NIL;
+         slot = _hash_next(slot)) {
+        _nib_onl_entry_t *node = &_nodes[_ipv6_idx[slot] - 1];
+        unsigned node_iface = _nib_onl_get_if(node);
+
+        if (((res != NULL) && (node > res)) ||
+            !ipv6_addr_equal(&node->ipv6, addr)) {
+            continue;
+        }
+        if (exact) {
+            if (node_iface == iface) {
+                res = node;
+            }
+        }
+        else if ((node->mode != _EMPTY) &&
+                 ((node_iface == 0) || (iface == 0) || (node_iface == iface))) {
+            res = node;
+        }
+    }
+    return res;
+}
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+static unsigned _hash_l2addr(const uint8_t *l2addr, size_t l2addr_len)
+{
+    /* FNV-1a */
+    uint32_t h = 2166136261U;
+
+    for (unsigned i = 0; i < l2addr_len; i++) {
+        h ^= l2addr[i];
+        h *= 16777619U;
+    }
+    return h % _HASH_NUMOF;
+}
+
+static unsigned _node_hash_l2addr(const _nib_onl_entry_t *node)
+{
+    return _hash_l2addr(node->l2addr, node->l2addr_len);
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
+
+void _nib_onl_unindex(_nib_onl_entry_t *node)
+{
+    if (!ipv6_addr_is_unspecified(&node->ipv6)) {
+        _idx_del(_ipv6_idx, _node_hash_ipv6, node);
+    }
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+    if (node->l2addr_len > 0) {
+        _idx_del(_l2addr_idx, _node_hash_l2addr, node);
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+
+static void _onl_set_ipv6(_nib_onl_entry_t *node, const ipv6_addr_t *addr)
+{
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    if (!ipv6_addr_is_unspecified(&node->ipv6)) {
+        _idx_del(_ipv6_idx, _node_hash_ipv6, node);
+    }
+    if (!ipv6_addr_is_unspecified(addr)) {
+        _idx_add(_ipv6_idx, _hash_ipv6(addr), node);
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+    memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+}
+
 void _nib_init(void)
 {
 #ifdef TEST_SUITES
@@ -63,11 +382,23 @@ void _nib_init(void)
     memset(_nodes, 0, sizeof(_nodes));
     memset(_def_routers, 0, sizeof(_def_routers));
     memset(_dsts, 0, sizeof(_dsts));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+    _trie_root = _TRIE_NIL;
+    _trie_used = 0;
+    _trie_free = _TRIE_NIL;
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    memset(_ipv6_idx, 0, sizeof(_ipv6_idx));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+    memset(_l2addr_idx, 0, sizeof(_l2addr_idx));
+#endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
 #endif  /* TEST_SUITES */
     evtimer_init_msg(&_nib_evtimer);
+    _nib_changed();
     /* TODO: load ABR information from persistent memory */
 }
 
@@ -94,14 +425,26 @@ static inline bool _addr_equals(const ipv6_addr_t *addr,
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
 {
     _nib_onl_entry_t *node = NULL;
+    bool hashed = false;
 
     DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
           (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
                                                      sizeof(addr_str)), iface);
-    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    /* unspecified addresses are not indexed */
+    if ((addr != NULL) && !ipv6_addr_is_unspecified(addr)) {
+        hashed = true;
+        node = _ipv6_idx_get(addr, iface, true);
+        DEBUG("  %p is an exact match\n", (void *)node);
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+    /* with the index, only search for an empty entry */
+    for (unsigned i = 0; (i < CONFIG_GNRC_IPV6_NIB_NUMOF) &&
+                         (!hashed || (node == NULL)); i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
-        if ((_nib_onl_get_if(tmp) == iface) && _addr_equals(addr, tmp)) {
+        if (!hashed &&
+            (_nib_onl_get_if(tmp) == iface) && _addr_equals(addr, tmp)) {
             /* exact match */
             DEBUG("  %p is an exact match\n", (void *)tmp);
             node = tmp;
@@ -158,6 +501,7 @@ static inline _nib_onl_entry_t *_cache_out_onl_entry(const ipv6_addr_t *addr,
             /* cstate masked in _nib_nc_add() already */
             res->info |= cstate;
             res->mode = _NC;
+            _nib_changed();
         }
         /* requeue if not garbage collectible at the moment or queueing
          * newly created NCE or in case entry becomes garbage collectible
@@ -194,6 +538,7 @@ _nib_onl_entry_t *_nib_nc_add(const ipv6_addr_t *addr, unsigned iface,
         /* masked above already */
         node->info |= cstate;
         node->mode |= _NC;
+        _nib_changed();
     }
     if (node->next == NULL) {
         DEBUG("nib: queueing (addr = %s, iface = %u) for potential removal\n",
@@ -223,6 +568,14 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    if (!ipv6_addr_is_unspecified(addr)) {
+        _nib_onl_entry_t *node = _ipv6_idx_get(addr, iface, false);
+
+        DEBUG("  Found %p\n", (void *)node);
+        return node;
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
@@ -240,13 +593,81 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     return NULL;
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+void _nib_onl_set_l2addr(_nib_onl_entry_t *node, const uint8_t *l2addr,
+                         size_t l2addr_len)
+{
+    assert(l2addr_len <= CONFIG_GNRC_IPV6_NIB_L2ADDR_MAX_LEN);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    if (node->l2addr_len > 0) {
+        _idx_del(_l2addr_idx, _node_hash_l2addr, node);
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+    if ((l2addr != NULL) && (l2addr_len > 0)) {
+        memcpy(node->l2addr, l2addr, l2addr_len);
+    }
+    node->l2addr_len = l2addr_len;
+    _nib_changed();
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    if (node->l2addr_len > 0) {
+        _idx_add(_l2addr_idx, _node_hash_l2addr(node), node);
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+}
+
+static inline bool _l2addr_matches(const _nib_onl_entry_t *node, unsigned iface,
+                                   const uint8_t *l2addr, size_t l2addr_len)
+{
+    return (node->mode != _EMPTY) &&
+           ((iface == 0) || (_nib_onl_get_if(node) == iface)) &&
+           l2util_addr_equal(l2addr, l2addr_len, node->l2addr,
+                             node->l2addr_len);
+}
+
+_nib_onl_entry_t *_nib_onl_get_by_l2addr(const _nib_onl_entry_t *last,
+                                         unsigned iface, const uint8_t *l2addr,
+                                         size_t l2addr_len)
+{
+    assert(l2addr != NULL);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    /* entries without link-layer address are not indexed */
+    if (l2addr_len > 0) {
+        _nib_onl_entry_t *res = NULL;
+
+        for (unsigned slot = _hash_l2addr(l2addr, l2addr_len);
+             _l2addr_idx[slot] != _HASH_NIL; slot = _hash_next(slot)) {
+            _nib_onl_entry_t *node = &_nodes[_l2addr_idx[slot] - 1];
+
+            if (((last == NULL) || (node > last)) &&
+                ((res == NULL) || (node < res)) &&
+                _l2addr_matches(node, iface, l2addr, l2addr_len)) {
+                res = node;
+            }
+        }
+        return res;
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+    for (_nib_onl_entry_t *node = _nib_onl_iter(last); node != NULL;
+         node = _nib_onl_iter(node)) {
+        if (_l2addr_matches(node, iface, l2addr, l2addr_len)) {
+            return node;
+        }
+    }
+    return NULL;
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
+
 void _nib_nc_set_reachable(_nib_onl_entry_t *node)
 {
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
     gnrc_netif_t *netif = gnrc_netif_get_by_pid(_nib_onl_get_if(node));
 
-    node->info &= ~GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
-    node->info |= GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE;
+    if ((node->info & GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK) !=
+        GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE) {
+        node->info &= ~GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
+        node->info |= GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE;
+        _nib_changed();
+    }
 #ifdef TEST_SUITES
     /* exit early for unittests */
     if (netif == NULL) {
@@ -269,6 +690,7 @@ void _nib_nc_remove(_nib_onl_entry_t *node)
           ipv6_addr_to_str(addr_str, &node->ipv6, sizeof(addr_str)),
           _nib_onl_get_if(node));
     node->mode &= ~(_NC);
+    _nib_changed();
     evtimer_del((evtimer_t *)&_nib_evtimer, &node->snd_na.event);
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
     evtimer_del((evtimer_t *)&_nib_evtimer, &node->nud_timeout.event);
@@ -362,6 +784,7 @@ _nib_dr_entry_t *_nib_drl_add(const ipv6_addr_t *router_addr, unsigned iface)
         }
         _override_node(router_addr, iface, def_router->next_hop);
         def_router->next_hop->mode |= _DRL;
+        _nib_changed();
     }
     return def_router;
 }
@@ -371,6 +794,7 @@ void _nib_drl_remove(_nib_dr_entry_t *nib_dr)
     if (nib_dr->next_hop != NULL) {
         _evtimer_del(&nib_dr->rtr_timeout);
         nib_dr->next_hop->mode &= ~(_DRL);
+        _nib_changed();
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_DC)
         /*  When removing a router from the Default
             Router list, the node MUST update the Destination Cache in such a way
@@ -449,17 +873,17 @@ _nib_dr_entry_t *_nib_drl_get_dr(void)
             if ((_prime_def_router == NULL) || (next == NULL)) {
                 /* wrap around to first (potentially unreachable) route
                  * to trigger NUD for it */
-                _prime_def_router = _nib_drl_iter(NULL);
+                _nib_drl_set_prime(_nib_drl_iter(NULL));
             }
             /* there is another default router, choose it regardless of
              * reachability to potentially trigger NUD for it */
             else if (next != NULL) {
-                _prime_def_router = next;
+                _nib_drl_set_prime(next);
             }
             return _prime_def_router;
         }
     } while (_node_unreachable(ptr->next_hop));
-    _prime_def_router = ptr;
+    _nib_drl_set_prime(ptr);
     return _prime_def_router;
 }
 
@@ -508,9 +932,10 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
                                                        || _addr_equals(next_hop, tmp_node))) {
                 /* next hop matches or is unspecified */
                 DEBUG("  %p is an exact match\n", (void *)tmp);
-                if (next_hop != NULL) {
+                if ((next_hop != NULL) && !_addr_equals(next_hop, tmp_node)) {
                     /* sets next_hop if it was previously unspecified */
-                    memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+                    _onl_set_ipv6(tmp_node, next_hop);
+                    _nib_changed();
                 }
                 /*mark that this NCE is used by an offl_entry*/
                 tmp->next_hop->mode |= _DST;
@@ -520,6 +945,12 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
     }
     if (dst != NULL) {
         DEBUG("  using %p\n", (void *)dst);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+        if (dst->pfx_len != 0) {
+            /* entry was allocated but never used */
+            _trie_del(dst);
+        }
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
         if (!dst->next_hop && !(dst->next_hop = _nib_onl_alloc(next_hop, iface))) {
             memset(dst, 0, sizeof(_nib_offl_entry_t));
             return NULL;
@@ -528,6 +959,9 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+        _trie_add(dst);
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
     }
     return dst;
 }
@@ -566,6 +1000,11 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
                 _nib_onl_clear(dst->next_hop);
             }
         }
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+        if (dst->pfx_len != 0) {
+            _trie_del(dst);
+        }
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
     else {
@@ -594,13 +1033,16 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
     return (entry >= _dsts) && _in_dsts(entry);
 }
 
-static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
+_nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
+    DEBUG("nib: get match for destination %s from NIB\n",
+          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+    return _trie_get_match(dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
     _nib_offl_entry_t *res = NULL;
     uint8_t best_match = 0;
 
-    DEBUG("nib: get match for destination %s from NIB\n",
-          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -621,6 +1063,7 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
         }
     }
     return res;
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
 }
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
@@ -880,7 +1323,7 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
 {
     _nib_onl_clear(node);
     if (addr != NULL) {
-        memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+        _onl_set_ipv6(node, addr);
     }
     _nib_onl_set_if(node, iface);
 }
@@ -24,6 +24,7 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "atomic_utils.h"
 #include "bitfield.h"
 #include "evtimer_msg.h"
 #include "sched.h"
@@ -261,6 +262,27 @@ extern evtimer_msg_t _nib_evtimer;
  */
 extern _nib_dr_entry_t *_prime_def_router;
 
+/**
+ * @brief   Generation of the NIB
+ *
+ * @see gnrc_ipv6_nib_generation()
+ */
+extern uint32_t _nib_generation;
+
+/**
+ * @brief   Marks a change of the NIB that may change the next hop to a
+ *          destination or its link-layer address
+ *
+ * The generation is never 0, so zero initialized cached results are never
+ * valid.
+ */
+static inline void _nib_changed(void)
+{
+    if (atomic_fetch_add_u32(&_nib_generation, 1) == UINT32_MAX) {
+        atomic_fetch_add_u32(&_nib_generation, 1);
+    }
+}
+
 /**
  * @brief   Looks up if an event is queued in the event timer
  *
@@ -359,6 +381,17 @@ static inline void _nib_onl_set_if(_nib_onl_entry_t *node, unsigned iface)
  */
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH) || defined(DOXYGEN)
+/**
+ * @brief   Removes an on-link entry from the hash index
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_NC_HASH != 0.
+ *
+ * @param[in] node  An entry.
+ */
+void _nib_onl_unindex(_nib_onl_entry_t *node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+
 /**
  * @brief   Clears out a NIB entry (on-link version)
  *
@@ -370,6 +403,9 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
 {
     if (node->mode == _EMPTY) {
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+        _nib_onl_unindex(node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
         memset(node, 0, sizeof(_nib_onl_entry_t));
         return true;
     }
@@ -398,6 +434,42 @@ _nib_onl_entry_t *_nib_onl_iter(const _nib_onl_entry_t *last);
  */
 _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface);
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM) || defined(DOXYGEN)
+/**
+ * @brief   Sets the link-layer address of an on-link entry
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ARSM != 0.
+ *
+ * @param[in,out] node      An entry.
+ * @param[in] l2addr        The link-layer address. May be NULL to only
+ *                          change the length.
+ * @param[in] l2addr_len    Length of @p l2addr.
+ */
+void _nib_onl_set_l2addr(_nib_onl_entry_t *node, const uint8_t *l2addr,
+                         size_t l2addr_len);
+
+/**
+ * @brief   Gets the next node by link-layer address and interface
+ *
+ * @pre     `(l2addr != NULL)`
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ARSM != 0.
+ *
+ * @param[in] last          Last entry found (NULL to start).
+ * @param[in] iface         The interface to the node. May be 0 for any
+ *                          interface.
+ * @param[in] l2addr        The link-layer address of a node.
+ * @param[in] l2addr_len    Length of @p l2addr.
+ *
+ * @return  The first non-empty entry after @p last with @p l2addr on
+ *          @p iface.
+ * @return  NULL, if there is no such entry.
+ */
+_nib_onl_entry_t *_nib_onl_get_by_l2addr(const _nib_onl_entry_t *last,
+                                         unsigned iface, const uint8_t *l2addr,
+                                         size_t l2addr_len);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
+
 /**
  * @brief   Gets a node by IPv6 address and interface from the neighbor cache
  *
@@ -567,6 +639,19 @@ void _nib_drl_ft_get(const _nib_dr_entry_t *drl, gnrc_ipv6_nib_ft_t *fte);
  */
 _nib_dr_entry_t *_nib_drl_get_dr(void);
 
+/**
+ * @brief   Sets the primary default router
+ *
+ * @param[in] router    The new primary default router. May be NULL.
+ */
+static inline void _nib_drl_set_prime(_nib_dr_entry_t *router)
+{
+    if (router != _prime_def_router) {
+        _prime_def_router = router;
+        _nib_changed();
+    }
+}
+
 /**
  * @brief   Creates or gets an existing off-link entry by next hop and prefix
  *
@@ -603,6 +688,16 @@ void _nib_offl_clear(_nib_offl_entry_t *dst);
  */
 _nib_offl_entry_t *_nib_offl_iter(const _nib_offl_entry_t *last);
 
+/**
+ * @brief   Gets the off-link entry with the longest prefix matching @p dst
+ *
+ * @param[in] dst   A destination address.
+ *
+ * @return  The off-link entry with the longest prefix matching @p dst.
+ * @return  NULL, if no off-link entry matches @p dst.
+ */
+_nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst);
+
 /**
  * @brief   Checks if @p entry was allocated using _nib_offl_alloc()
  *
@@ -638,8 +733,9 @@ static inline _nib_offl_entry_t *_nib_offl_add(const ipv6_addr_t *next_hop,
 {
     _nib_offl_entry_t *nib_offl = _nib_offl_alloc(next_hop, iface, pfx, pfx_len);
 
-    if (nib_offl != NULL) {
+    if ((nib_offl != NULL) && ((nib_offl->mode & mode) != mode)) {
         nib_offl->mode |= mode;
+        _nib_changed();
     }
     return nib_offl;
 }
@@ -652,6 +748,7 @@ static inline _nib_offl_entry_t *_nib_offl_add(const ipv6_addr_t *next_hop,
 static inline void _nib_offl_remove(_nib_offl_entry_t *nib_offl, uint8_t mode)
 {
     nib_offl->mode &= ~mode;
+    _nib_changed();
     _nib_offl_clear(nib_offl);
 }
 
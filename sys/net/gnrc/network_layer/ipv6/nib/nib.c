@@ -305,19 +305,24 @@ void gnrc_ipv6_nib_init_iface(gnrc_netif_t *netif)
 
 static bool _on_link(const ipv6_addr_t *dst, unsigned *iface)
 {
-    _nib_offl_entry_t *entry = NULL;
     _nib_offl_entry_t *match = NULL;
 
     if (ipv6_addr_is_link_local(dst)) {
         return true;
     }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+    match = _nib_offl_get_match(dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+    _nib_offl_entry_t *entry = NULL;
+
     while ((entry = _nib_offl_iter(entry))) {
         if ((ipv6_addr_match_prefix(dst, &entry->pfx) >= entry->pfx_len) &&
             ((match == NULL) || (entry->pfx_len > match->pfx_len))) {
             match = entry;
         }
     }
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
 
     if (match) {
         *iface = _nib_onl_get_if(match->next_hop);
@@ -449,6 +454,11 @@ out:
     return res;
 }
 
+uint32_t gnrc_ipv6_nib_generation(void)
+{
+    return atomic_load_u32(&_nib_generation);
+}
+
 void gnrc_ipv6_nib_handle_pkt(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
                               const icmpv6_hdr_t *icmpv6, size_t icmpv6_len)
 {
@@ -1793,8 +1803,10 @@ static uint32_t _handle_pio(gnrc_netif_t *netif, const icmpv6_hdr_t *icmpv6,
             if (abr != NULL) {
                 _nib_abr_add_pfx(abr, pfx);
             }
-            if (pio->flags & NDP_OPT_PI_FLAGS_L) {
+            if ((pio->flags & NDP_OPT_PI_FLAGS_L) &&
+                !(pfx->flags & _PFX_ON_LINK)) {
                 pfx->flags |= _PFX_ON_LINK;
+                _nib_changed();
             }
             if (pio->flags & NDP_OPT_PI_FLAGS_A) {
                 pfx->flags |= _PFX_SLAAC;
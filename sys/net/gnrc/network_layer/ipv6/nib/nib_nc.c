@@ -43,10 +43,7 @@ int gnrc_ipv6_nib_nc_set(const ipv6_addr_t *ipv6, unsigned iface,
         return -ENOMEM;
     }
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
-    if ((l2addr != NULL) && (l2addr_len > 0)) {
-        memcpy(node->l2addr, l2addr, l2addr_len);
-    }
-    node->l2addr_len = l2addr_len;
+    _nib_onl_set_l2addr(node, l2addr, l2addr_len);
 #else
     (void)l2addr;
     (void)l2addr_len;
@@ -112,9 +109,9 @@ bool gnrc_ipv6_nib_nc_del_l2(unsigned iface, const uint8_t *l2addr, size_t l2add
     _nib_acquire();
 
     /* Find and remove entry with matching l2 address.*/
-    while ((node = _nib_onl_iter(node)) != NULL) {
-        if ((_nib_onl_get_if(node) == iface) &&
-            l2util_addr_equal(l2addr, l2addr_len, node->l2addr, node->l2addr_len)) {
+    while ((node = _nib_onl_get_by_l2addr(node, iface, l2addr,
+                                          l2addr_len)) != NULL) {
+        if (_nib_onl_get_if(node) == iface) {
             _nib_nc_remove(node);
             res = true;
             break;
@@ -143,6 +140,38 @@ void gnrc_ipv6_nib_nc_mark_reachable(const ipv6_addr_t *ipv6)
     _nib_release();
 }
 
+bool gnrc_ipv6_nib_nc_get_by_l2addr(unsigned iface, const uint8_t *l2addr,
+                                    size_t l2addr_len, gnrc_ipv6_nib_nc_t *nce)
+{
+    assert((l2addr != NULL) && (nce != NULL));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM) && !IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_6LN)
+    _nib_onl_entry_t *node = NULL;
+
+    _nib_acquire();
+    while ((node = _nib_onl_get_by_l2addr(node, iface, l2addr,
+                                          l2addr_len)) != NULL) {
+        if (node->mode & _NC) {
+            _nib_nc_get(node, nce);
+            break;
+        }
+    }
+    _nib_release();
+    return (node != NULL);
+#else
+    /* the link-layer address may be derived from the IPv6 address, so it
+     * is not indexed */
+    void *state = NULL;
+
+    while (gnrc_ipv6_nib_nc_iter(iface, &state, nce)) {
+        if (l2util_addr_equal(l2addr, l2addr_len, nce->l2addr,
+                              nce->l2addr_len)) {
+            return true;
+        }
+    }
+    return false;
+#endif
+}
+
 bool gnrc_ipv6_nib_nc_iter(unsigned iface, void **state,
                            gnrc_ipv6_nib_nc_t *entry)
 {
@@ -63,8 +63,10 @@ int gnrc_ipv6_nib_pl_set(unsigned iface,
      * address resolution towards the LoWPAN and not the upstream interface
      * See https://github.com/RIOT-OS/RIOT/pull/10627 and follow-ups
      */
-    if (!gnrc_netif_is_6ln(netif) || gnrc_netif_is_6lbr(netif)) {
+    if ((!gnrc_netif_is_6ln(netif) || gnrc_netif_is_6lbr(netif)) &&
+        !(dst->flags & _PFX_ON_LINK)) {
         dst->flags |= _PFX_ON_LINK;
+        _nib_changed();
     }
 
     /* Auto-configuration only works if the prefix is more than a single address */
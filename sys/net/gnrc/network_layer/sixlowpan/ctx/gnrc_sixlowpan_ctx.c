@@ -30,6 +30,7 @@
 static gnrc_sixlowpan_ctx_t _ctxs[GNRC_SIXLOWPAN_CTX_SIZE];
 static uint32_t _ctx_inval_times[GNRC_SIXLOWPAN_CTX_SIZE];
 static mutex_t _ctx_mutex = MUTEX_INIT;
+static uint32_t _ctx_generation;
 
 static uint32_t _current_minute(void);
 static void _update_lifetime(uint8_t id);
@@ -129,11 +130,22 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
           id, ipv6_addr_to_str(ipv6str, &_ctxs[id].prefix, sizeof(ipv6str)),
           _ctxs[id].prefix_len, _ctxs[id].ltime);
     _ctx_inval_times[id] = ltime + _current_minute();
+    _ctx_generation++;
 
     mutex_unlock(&_ctx_mutex);
     return &(_ctxs[id]);
 }
 
+uint32_t gnrc_sixlowpan_ctx_generation(void)
+{
+    uint32_t generation;
+
+    mutex_lock(&_ctx_mutex);
+    generation = _ctx_generation;
+    mutex_unlock(&_ctx_mutex);
+    return generation;
+}
+
 static uint32_t _current_minute(void)
 {
 #if IS_USED(MODULE_ZTIMER_MSEC)
@@ -170,6 +182,7 @@ static void _update_lifetime(uint8_t id)
 void gnrc_sixlowpan_ctx_reset(void)
 {
     memset(_ctxs, 0, sizeof(_ctxs));
+    _ctx_generation++;
 }
 #endif
 
@@ -17,6 +17,7 @@
 #include <inttypes.h>
 #include <stdbool.h>
 
+#include "bitfield.h"
 #include "net/ieee802154.h"
 #include "net/ipv6.h"
 #include "net/ipv6/hdr.h"
@@ -60,9 +61,19 @@
 #endif
 
 static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
+/* marks the intervals in rbuf_int that are in use */
+static BITFIELD(rbuf_int_used, RBUF_INT_SIZE);
 
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
+/* index of the entries in rbuf by (source address, tag), chained per bucket.
+ * Both arrays hold an index into rbuf + 1, 0 marks the end of a chain */
+static uint8_t rbuf_idx[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+static uint8_t rbuf_idx_next[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE < UINT8_MAX,
+              "reassembly buffer index must fit into uint8_t");
+
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
 static xtimer_t _gc_timer;
@@ -180,6 +191,43 @@ void gnrc_sixlowpan_frag_rb_rm_by_datagram(const gnrc_netif_hdr_t *netif_hdr,
     }
 }
 
+static unsigned _rbuf_idx_bucket(const uint8_t *src, size_t src_len,
+                                 uint16_t tag)
+{
+    uint32_t hash = tag;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash * 31) + src[i];
+    }
+    return hash % CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE;
+}
+
+static void _rbuf_idx_add(gnrc_sixlowpan_frag_rb_t *e)
+{
+    unsigned bucket = _rbuf_idx_bucket(e->super.src, e->super.src_len,
+                                       e->super.tag);
+    unsigned idx = e - &rbuf[0];
+
+    rbuf_idx_next[idx] = rbuf_idx[bucket];
+    rbuf_idx[bucket] = idx + 1;
+}
+
+static void _rbuf_idx_rm(gnrc_sixlowpan_frag_rb_t *e)
+{
+    uint8_t *ptr = &rbuf_idx[_rbuf_idx_bucket(e->super.src, e->super.src_len,
+                                              e->super.tag)];
+    unsigned idx = e - &rbuf[0];
+
+    while (*ptr > 0) {
+        if (*ptr == (idx + 1)) {
+            *ptr = rbuf_idx_next[idx];
+            rbuf_idx_next[idx] = 0;
+            return;
+        }
+        ptr = &rbuf_idx_next[*ptr - 1];
+    }
+}
+
 static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
                                                   uint16_t tag)
 {
@@ -189,8 +237,9 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
     const uint8_t src_len = netif_hdr->src_l2addr_len;
     const uint8_t dst_len = netif_hdr->dst_l2addr_len;
 
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
+    for (unsigned i = rbuf_idx[_rbuf_idx_bucket(src, src_len, tag)]; i > 0;
+         i = rbuf_idx_next[i - 1]) {
+        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i - 1];
 
         if ((e->pkt != NULL) && (e->super.tag == tag) &&
             (e->super.src_len == src_len) &&
@@ -514,18 +563,21 @@ static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
 
 static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void)
 {
-    for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
-        if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
-            return rbuf_int + i;
-        }
-    }
+    int i = bf_find_first_unset(rbuf_int_used, RBUF_INT_SIZE);
 
-    return NULL;
+    if (i < 0) {
+        return NULL;
+    }
+    bf_set(rbuf_int_used, i);
+    return rbuf_int + i;
 }
 
 #ifdef TEST_SUITES
 bool gnrc_sixlowpan_frag_rb_ints_empty(void)
 {
+    if (bf_find_first_set(rbuf_int_used, RBUF_INT_SIZE) >= 0) {
+        return false;
+    }
     for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
         if (rbuf_int[i].end > 0) {
             return false;
@@ -620,8 +672,11 @@ static int _rbuf_get(const void *src, size_t src_len,
     gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
     uint32_t now_usec = xtimer_now_usec();
 
-    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        /* check first if entry already available */
+    /* check first if entry already available */
+    for (unsigned int j = rbuf_idx[_rbuf_idx_bucket(src, src_len, tag)];
+         j > 0; j = rbuf_idx_next[j - 1]) {
+        unsigned int i = j - 1;
+
         if ((rbuf[i].pkt != NULL) && (rbuf[i].super.tag == tag) &&
             ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
               /* not all SFR fragments carry the datagram size, so make 0 a
@@ -654,7 +709,9 @@ static int _rbuf_get(const void *src, size_t src_len,
             _set_rbuf_timeout();
             return i;
         }
+    }
 
+    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         /* if there is a free spot: remember it */
         if ((res == NULL) && gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
             res = &(rbuf[i]);
@@ -746,6 +803,7 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->offset_diff = 0U;
     memset(res->received, 0U, sizeof(res->received));
 #endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
+    _rbuf_idx_add(res);
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
@@ -765,6 +823,7 @@ void gnrc_sixlowpan_frag_rb_reset(void)
 {
     xtimer_remove(&_gc_timer);
     memset(rbuf_int, 0, sizeof(rbuf_int));
+    memset(rbuf_int_used, 0, sizeof(rbuf_int_used));
     for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         if ((rbuf[i].pkt != NULL) &&
             (rbuf[i].pkt->users > 0)) {
@@ -772,6 +831,8 @@ void gnrc_sixlowpan_frag_rb_reset(void)
         }
     }
     memset(rbuf, 0, sizeof(rbuf));
+    memset(rbuf_idx, 0, sizeof(rbuf_idx));
+    memset(rbuf_idx_next, 0, sizeof(rbuf_idx_next));
 }
 
 const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
@@ -780,19 +841,39 @@ const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
 }
 #endif
 
-void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry)
+void gnrc_sixlowpan_frag_rb_base_ints_rm(gnrc_sixlowpan_frag_rb_base_t *entry)
 {
     while (entry->ints != NULL) {
         gnrc_sixlowpan_frag_rb_int_t *next = entry->ints->next;
 
+        /* intervals may not stem from the pool (e.g. in tests) */
+        if ((entry->ints >= &rbuf_int[0]) &&
+            (entry->ints < &rbuf_int[RBUF_INT_SIZE])) {
+            bf_unset(rbuf_int_used, entry->ints - &rbuf_int[0]);
+        }
         entry->ints->start = 0;
         entry->ints->end = 0;
         entry->ints->next = NULL;
         entry->ints = next;
     }
+}
+
+void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry)
+{
+    gnrc_sixlowpan_frag_rb_base_ints_rm(entry);
     entry->datagram_size = 0;
 }
 
+void gnrc_sixlowpan_frag_rb_remove(gnrc_sixlowpan_frag_rb_t *rbuf)
+{
+    assert(rbuf != NULL);
+    if (rbuf->pkt != NULL) {
+        _rbuf_idx_rm(rbuf);
+    }
+    gnrc_sixlowpan_frag_rb_base_rm(&rbuf->super);
+    rbuf->pkt = NULL;
+}
+
 static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
 {
 #if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0U
@@ -13,6 +13,8 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <assert.h>
+
 #include "net/ieee802154.h"
 #ifdef MODULE_GNRC_IPV6_NIB
 #include "net/ipv6/addr.h"
@@ -31,6 +33,19 @@
 #include "debug.h"
 
 static gnrc_sixlowpan_frag_vrb_t _vrb[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+/* All arrays below hold an index into _vrb + 1, 0 marks the end of a list.
+ * _idx and _idx_next chain the entries in _vrb by (source address, tag),
+ * _lru_prev and _lru_next order all entries from the most recently used
+ * (_lru_head) to the least recently used (_lru_tail) one. Empty entries are
+ * always kept at the tail, so they are picked first for a new entry. */
+static uint8_t _idx[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+static uint8_t _idx_next[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+static uint8_t _lru_prev[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+static uint8_t _lru_next[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+static uint8_t _lru_head, _lru_tail;
+
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE < UINT8_MAX,
+              "VRB index must fit into uint8_t");
 #ifdef MODULE_GNRC_IPV6_NIB
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 #else   /* MODULE_GNRC_IPV6_NIB */
@@ -46,77 +61,201 @@ static inline bool _equal_index(const gnrc_sixlowpan_frag_vrb_t *vrbe,
             (memcmp(vrbe->super.src, src, src_len) == 0));
 }
 
+static unsigned _idx_bucket(const uint8_t *src, size_t src_len, unsigned tag)
+{
+    uint32_t hash = tag;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash * 31) + src[i];
+    }
+    return hash % CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE;
+}
+
+static gnrc_sixlowpan_frag_vrb_t *_idx_get(const uint8_t *src, size_t src_len,
+                                           unsigned tag)
+{
+    for (unsigned i = _idx[_idx_bucket(src, src_len, tag)]; i > 0;
+         i = _idx_next[i - 1]) {
+        if (_equal_index(&_vrb[i - 1], src, src_len, tag)) {
+            return &_vrb[i - 1];
+        }
+    }
+    return NULL;
+}
+
+static void _idx_add(gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    unsigned bucket = _idx_bucket(vrbe->super.src, vrbe->super.src_len,
+                                  vrbe->super.tag);
+    unsigned idx = vrbe - &_vrb[0];
+
+    _idx_next[idx] = _idx[bucket];
+    _idx[bucket] = idx + 1;
+}
+
+static void _idx_rm(gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    uint8_t *ptr = &_idx[_idx_bucket(vrbe->super.src, vrbe->super.src_len,
+                                     vrbe->super.tag)];
+    unsigned idx = vrbe - &_vrb[0];
+
+    while (*ptr > 0) {
+        if (*ptr == (idx + 1)) {
+            *ptr = _idx_next[idx];
+            _idx_next[idx] = 0;
+            return;
+        }
+        ptr = &_idx_next[*ptr - 1];
+    }
+}
+
+static void _lru_unlink(unsigned idx)
+{
+    if (_lru_prev[idx] > 0) {
+        _lru_next[_lru_prev[idx] - 1] = _lru_next[idx];
+    }
+    else {
+        _lru_head = _lru_next[idx];
+    }
+    if (_lru_next[idx] > 0) {
+        _lru_prev[_lru_next[idx] - 1] = _lru_prev[idx];
+    }
+    else {
+        _lru_tail = _lru_prev[idx];
+    }
+}
+
+static void _lru_push_front(unsigned idx)
+{
+    _lru_prev[idx] = 0;
+    _lru_next[idx] = _lru_head;
+    if (_lru_head > 0) {
+        _lru_prev[_lru_head - 1] = idx + 1;
+    }
+    else {
+        _lru_tail = idx + 1;
+    }
+    _lru_head = idx + 1;
+}
+
+static void _lru_push_back(unsigned idx)
+{
+    _lru_next[idx] = 0;
+    _lru_prev[idx] = _lru_tail;
+    if (_lru_tail > 0) {
+        _lru_next[_lru_tail - 1] = idx + 1;
+    }
+    else {
+        _lru_head = idx + 1;
+    }
+    _lru_tail = idx + 1;
+}
+
+static void _lru_touch(gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    unsigned idx = vrbe - &_vrb[0];
+
+    if (_lru_head != (idx + 1)) {
+        _lru_unlink(idx);
+        _lru_push_front(idx);
+    }
+}
+
+static gnrc_sixlowpan_frag_vrb_t *_lru_get_free(void)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrbe;
+
+    if (_lru_tail == 0) {
+        /* first use since start-up or reset: all entries are empty */
+        for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+            _lru_push_back(i);
+        }
+    }
+    vrbe = &_vrb[_lru_tail - 1];
+    if (!gnrc_sixlowpan_frag_vrb_entry_empty(vrbe)) {
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+        gnrc_sixlowpan_frag_stats_get()->vrb_full++;
+#endif
+        /* without a free VRB entry the datagram is reassembled instead, so
+         * only override an entry still in use if configured */
+        if (!IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_OVERRIDE_LRU) &&
+            ((xtimer_now_usec() - vrbe->super.arrival) <=
+             CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US)) {
+            return NULL;
+        }
+        DEBUG("6lo vrb: VRB full, evicting least recently used entry (%s, %u)\n",
+              gnrc_netif_addr_to_str(vrbe->super.src, vrbe->super.src_len,
+                                     addr_str), vrbe->super.tag);
+        gnrc_sixlowpan_frag_vrb_rm(vrbe);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+        gnrc_sixlowpan_frag_stats_get()->vrb_evictions++;
+#endif
+    }
+    return vrbe;
+}
+
 gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
         const gnrc_sixlowpan_frag_rb_base_t *base,
         gnrc_netif_t *out_netif, const uint8_t *out_dst, size_t out_dst_len)
 {
-    gnrc_sixlowpan_frag_vrb_t *vrbe = NULL;
+    gnrc_sixlowpan_frag_vrb_t *vrbe;
 
     assert(base != NULL);
     assert(base->src_len != 0);
     assert(out_netif != NULL);
     assert(out_dst != NULL);
     assert(out_dst_len > 0);
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        gnrc_sixlowpan_frag_vrb_t *ptr = &_vrb[i];
-
-        if (gnrc_sixlowpan_frag_vrb_entry_empty(ptr) ||
-            _equal_index(ptr, base->src, base->src_len, base->tag)) {
-            vrbe = ptr;
-            if (gnrc_sixlowpan_frag_vrb_entry_empty(vrbe)) {
-                vrbe->super = *base;
-                vrbe->out_netif = out_netif;
-                memcpy(vrbe->super.dst, out_dst, out_dst_len);
-                vrbe->out_tag = gnrc_sixlowpan_frag_fb_next_tag();
-                vrbe->super.dst_len = out_dst_len;
-                DEBUG("6lo vrb: creating entry (%s, ",
-                      gnrc_netif_addr_to_str(vrbe->super.src,
-                                             vrbe->super.src_len,
-                                             addr_str));
-                DEBUG("%s, %u, %u) => ",
-                      gnrc_netif_addr_to_str(vrbe->super.dst,
-                                             vrbe->super.dst_len,
-                                             addr_str),
-                      (unsigned)vrbe->super.datagram_size, vrbe->super.tag);
-                DEBUG("(%s, %u)\n",
-                      gnrc_netif_addr_to_str(vrbe->super.dst,
-                                             vrbe->super.dst_len,
-                                             addr_str), vrbe->out_tag);
-            }
-            /* _equal_index() => append intervals of `base`, so they don't get
-             * lost. We use append, so we don't need to change base! */
-            else if (base->ints != NULL) {
-                gnrc_sixlowpan_frag_rb_int_t *tmp = vrbe->super.ints;
-
-                if (tmp != base->ints) {
-                    /* base->ints is not already vrbe->super.ints */
-                    if (tmp != NULL) {
-                        /* iterate before appending and check if `base->ints` is
-                         * not already part of list */
-                        while (tmp->next != NULL) {
-                            if (tmp == base->ints) {
-                                tmp = NULL;
-                                break;
-                            }
-                            tmp = tmp->next;
-                        }
-                        if (tmp != NULL) {
-                            tmp->next = base->ints;
-                        }
-                    }
-                    else {
-                        vrbe->super.ints = base->ints;
+    if ((vrbe = _idx_get(base->src, base->src_len, base->tag)) == NULL) {
+        if ((vrbe = _lru_get_free()) == NULL) {
+            return NULL;
+        }
+        vrbe->super = *base;
+        vrbe->out_netif = out_netif;
+        memcpy(vrbe->super.dst, out_dst, out_dst_len);
+        vrbe->out_tag = gnrc_sixlowpan_frag_fb_next_tag();
+        vrbe->super.dst_len = out_dst_len;
+        _idx_add(vrbe);
+        DEBUG("6lo vrb: creating entry (%s, ",
+              gnrc_netif_addr_to_str(vrbe->super.src,
+                                     vrbe->super.src_len,
+                                     addr_str));
+        DEBUG("%s, %u, %u) => ",
+              gnrc_netif_addr_to_str(vrbe->super.dst,
+                                     vrbe->super.dst_len,
+                                     addr_str),
+              (unsigned)vrbe->super.datagram_size, vrbe->super.tag);
+        DEBUG("(%s, %u)\n",
+              gnrc_netif_addr_to_str(vrbe->super.dst,
+                                     vrbe->super.dst_len,
+                                     addr_str), vrbe->out_tag);
+    }
+    /* _equal_index() => append intervals of `base`, so they don't get
+     * lost. We use append, so we don't need to change base! */
+    else if (base->ints != NULL) {
+        gnrc_sixlowpan_frag_rb_int_t *tmp = vrbe->super.ints;
+
+        if (tmp != base->ints) {
+            /* base->ints is not already vrbe->super.ints */
+            if (tmp != NULL) {
+                /* iterate before appending and check if `base->ints` is
+                 * not already part of list */
+                while (tmp->next != NULL) {
+                    if (tmp == base->ints) {
+                        tmp = NULL;
+                        break;
                     }
+                    tmp = tmp->next;
+                }
+                if (tmp != NULL) {
+                    tmp->next = base->ints;
                 }
             }
-            break;
+            else {
+                vrbe->super.ints = base->ints;
+            }
         }
     }
-#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
-    if (vrbe == NULL) {
-        gnrc_sixlowpan_frag_stats_get()->vrb_full++;
-    }
-#endif
+    _lru_touch(vrbe);
     return vrbe;
 }
 
@@ -170,18 +309,23 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(
     DEBUG("6lo vrb: trying to get entry for (%s, %u)\n",
           gnrc_netif_addr_to_str(src, src_len, addr_str), src_tag);
     assert(src_len != 0);
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[i];
+    gnrc_sixlowpan_frag_vrb_t *vrbe = _idx_get(src, src_len, src_tag);
 
-        if (_equal_index(vrbe, src, src_len, src_tag)) {
-            DEBUG("6lo vrb: got VRB to (%s, %u)\n",
-                  gnrc_netif_addr_to_str(vrbe->super.dst,
-                                         vrbe->super.dst_len,
-                                         addr_str), vrbe->out_tag);
-            return vrbe;
-        }
+    if (vrbe != NULL) {
+        DEBUG("6lo vrb: got VRB to (%s, %u)\n",
+              gnrc_netif_addr_to_str(vrbe->super.dst,
+                                     vrbe->super.dst_len,
+                                     addr_str), vrbe->out_tag);
+        _lru_touch(vrbe);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+        gnrc_sixlowpan_frag_stats_get()->vrb_hits++;
+#endif
+        return vrbe;
     }
     DEBUG("6lo vrb: no entry found\n");
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+    gnrc_sixlowpan_frag_stats_get()->vrb_misses++;
+#endif
     return NULL;
 }
 
@@ -209,6 +353,25 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_reverse(
 
 }
 
+void gnrc_sixlowpan_frag_vrb_rm(gnrc_sixlowpan_frag_vrb_t *vrb)
+{
+    unsigned idx = vrb - &_vrb[0];
+
+    if (gnrc_sixlowpan_frag_vrb_entry_empty(vrb)) {
+        return;
+    }
+    _idx_rm(vrb);
+    if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB)) {
+        gnrc_sixlowpan_frag_rb_base_rm(&vrb->super);
+    }
+    vrb->super.src_len = 0;
+    /* keep empty entries at the tail, so they are reused first */
+    if (_lru_tail != (idx + 1)) {
+        _lru_unlink(idx);
+        _lru_push_back(idx);
+    }
+}
+
 void gnrc_sixlowpan_frag_vrb_gc(void)
 {
     uint32_t now_usec = xtimer_now_usec();
@@ -234,6 +397,10 @@ void gnrc_sixlowpan_frag_vrb_gc(void)
 void gnrc_sixlowpan_frag_vrb_reset(void)
 {
     memset(_vrb, 0, sizeof(_vrb));
+    memset(_idx, 0, sizeof(_idx));
+    memset(_idx_next, 0, sizeof(_idx_next));
+    _lru_head = 0;
+    _lru_tail = 0;
 }
 #endif
 
@@ -28,6 +28,9 @@
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
 #include "net/gnrc/sixlowpan/iphc.h"
 #include "net/gnrc/netif.h"
+#ifdef MODULE_GNRC_NETAPI_SINGLE_THREAD
+#include "net/gnrc/netapi/single_thread.h"
+#endif
 #include "net/sixlowpan.h"
 
 #define ENABLE_DEBUG 0
@@ -35,15 +38,24 @@
 
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 
+#if IS_USED(MODULE_GNRC_NETAPI_SINGLE_THREAD)
+static gnrc_netapi_single_thread_layer_t _layer;
+#else
 static char _stack[GNRC_SIXLOWPAN_STACK_SIZE + DEBUG_EXTRA_STACKSIZE];
 static msg_t _msg_q[GNRC_SIXLOWPAN_MSG_QUEUE_SIZE];
+#endif
 
 /* handles GNRC_NETAPI_MSG_TYPE_RCV commands */
 static void _receive(gnrc_pktsnip_t *pkt);
 /* handles GNRC_NETAPI_MSG_TYPE_SND commands */
 static void _send(gnrc_pktsnip_t *pkt);
+#if IS_USED(MODULE_GNRC_NETAPI_SINGLE_THREAD)
+/* handles messages of the shared thread */
+static void _handle_msg(msg_t *msg, msg_t *reply);
+#else
 /* Main event loop for 6LoWPAN */
 static void *_event_loop(void *args);
+#endif
 
 kernel_pid_t gnrc_sixlowpan_init(void)
 {
@@ -51,8 +63,16 @@ kernel_pid_t gnrc_sixlowpan_init(void)
         return _pid;
     }
 
+#if IS_USED(MODULE_GNRC_NETAPI_SINGLE_THREAD)
+    _pid = gnrc_netapi_single_thread_register(&_layer, GNRC_NETTYPE_SIXLOWPAN,
+                                              _handle_msg);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    gnrc_sixlowpan_frag_sfr_init();
+#endif
+#else
     _pid = thread_create(_stack, sizeof(_stack), GNRC_SIXLOWPAN_PRIO,
                          0, _event_loop, NULL, "6lo");
+#endif
 
     return _pid;
 }
@@ -383,9 +403,58 @@ static void _continue_fragmenting(gnrc_sixlowpan_frag_fb_t *fbuf)
 }
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_FB */
 
+static void _handle_msg(msg_t *msg, msg_t *reply)
+{
+    switch (msg->type) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_RCV received\n");
+            _receive(msg->content.ptr);
+            break;
+
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_SND received\n");
+            _send(msg->content.ptr);
+            break;
+
+        case GNRC_NETAPI_MSG_TYPE_GET:
+        case GNRC_NETAPI_MSG_TYPE_SET:
+            DEBUG("6lo: reply to unsupported get/set\n");
+            reply->content.value = -ENOTSUP;
+            msg_reply(msg, reply);
+            break;
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_FB
+        case GNRC_SIXLOWPAN_FRAG_FB_SND_MSG:
+            DEBUG("6lo: send fragmented event received\n");
+            _continue_fragmenting(msg->content.ptr);
+            break;
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_FB */
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_RB
+        case GNRC_SIXLOWPAN_FRAG_RB_GC_MSG:
+            DEBUG("6lo: garbage collect reassembly buffer event received\n");
+            gnrc_sixlowpan_frag_rb_gc();
+            break;
+#endif
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+        case GNRC_SIXLOWPAN_FRAG_SFR_ARQ_TIMEOUT_MSG:
+            DEBUG("6lo sfr: ARQ timeout received\n");
+            gnrc_sixlowpan_frag_sfr_arq_timeout(msg->content.ptr);
+            break;
+        case GNRC_SIXLOWPAN_FRAG_SFR_INTER_FRAG_GAP_MSG:
+            DEBUG("6lo sfr: sending next scheduled frame\n");
+            gnrc_sixlowpan_frag_sfr_inter_frame_gap(msg->content.ptr);
+            break;
+#endif
+
+        default:
+            DEBUG("6lo: operation not supported\n");
+            break;
+    }
+}
+
+#if !IS_USED(MODULE_GNRC_NETAPI_SINGLE_THREAD)
 static void *_event_loop(void *args)
 {
-    msg_t msg, reply;
+    msg_t msgs[CONFIG_GNRC_NETAPI_MSG_BATCH_SIZE], reply;
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             thread_getpid());
 
@@ -405,55 +474,15 @@ static void *_event_loop(void *args)
     /* start event loop */
     while (1) {
         DEBUG("6lo: waiting for incoming message.\n");
-        msg_receive(&msg);
-
-        switch (msg.type) {
-            case GNRC_NETAPI_MSG_TYPE_RCV:
-                DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_RCV received\n");
-                _receive(msg.content.ptr);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_SND:
-                DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_SND received\n");
-                _send(msg.content.ptr);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_GET:
-            case GNRC_NETAPI_MSG_TYPE_SET:
-                DEBUG("6lo: reply to unsupported get/set\n");
-                reply.content.value = -ENOTSUP;
-                msg_reply(&msg, &reply);
-                break;
-#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_FB
-            case GNRC_SIXLOWPAN_FRAG_FB_SND_MSG:
-                DEBUG("6lo: send fragmented event received\n");
-                _continue_fragmenting(msg.content.ptr);
-                break;
-#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_FB */
-#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_RB
-            case GNRC_SIXLOWPAN_FRAG_RB_GC_MSG:
-                DEBUG("6lo: garbage collect reassembly buffer event received\n");
-                gnrc_sixlowpan_frag_rb_gc();
-                break;
-#endif
-#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
-            case GNRC_SIXLOWPAN_FRAG_SFR_ARQ_TIMEOUT_MSG:
-                DEBUG("6lo sfr: ARQ timeout received\n");
-                gnrc_sixlowpan_frag_sfr_arq_timeout(msg.content.ptr);
-                break;
-            case GNRC_SIXLOWPAN_FRAG_SFR_INTER_FRAG_GAP_MSG:
-                DEBUG("6lo sfr: sending next scheduled frame\n");
-                gnrc_sixlowpan_frag_sfr_inter_frame_gap(msg.content.ptr);
-                break;
-#endif
+        unsigned num = msg_receive_batch(msgs, ARRAY_SIZE(msgs));
 
-            default:
-                DEBUG("6lo: operation not supported\n");
-                break;
+        for (unsigned i = 0; i < num; i++) {
+            _handle_msg(&msgs[i], &reply);
         }
     }
 
     return NULL;
 }
+#endif
 
 /** @} */
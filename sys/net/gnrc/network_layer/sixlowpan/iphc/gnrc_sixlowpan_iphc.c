@@ -16,6 +16,7 @@
  * @author      Johann Fischer <j.fischer@phytec.de> (nhc udp encoding)
  */
 
+#include <assert.h>
 #include <stdbool.h>
 
 #include "byteorder.h"
@@ -115,12 +116,52 @@
 
 #define SIXLOWPAN_IPHC_PREFIX_LEN   (64)    /**< minimum prefix length for IPHC */
 
+#if defined(MODULE_GNRC_SIXLOWPAN_IPHC_NHC) && defined(MODULE_GNRC_UDP)
+#define IPHC_TMPL_SIZE              (CONFIG_GNRC_SIXLOWPAN_IPHC_TMPL_SIZE)
+#else
+#define IPHC_TMPL_SIZE              (0U)
+#endif
+
 /* currently only used with forwarding output, remove guard if more debug info
  * is added */
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
 
+#if IPHC_TMPL_SIZE
+static_assert((IPHC_TMPL_SIZE & (IPHC_TMPL_SIZE - 1)) == 0,
+              "CONFIG_GNRC_SIXLOWPAN_IPHC_TMPL_SIZE must be a power of two");
+
+/**
+ * @brief   Compressed IPv6 and UDP header of a UDP flow
+ */
+typedef struct {
+    gnrc_netif_t *iface;                /**< interface of the flow */
+    uint32_t ctx_generation;            /**< generation of the contexts */
+    network_uint32_t v_tc_fl;           /**< version, traffic class and flow label */
+    ipv6_addr_t src;                    /**< source address */
+    ipv6_addr_t dst;                    /**< destination address */
+    network_uint16_t src_port;          /**< source port */
+    network_uint16_t dst_port;          /**< destination port */
+    uint16_t ctxs;                      /**< contexts used in @ref hdr by ID */
+    uint8_t hl;                         /**< hop limit */
+    uint8_t l2addr_len;                 /**< length of @ref l2addr */
+    uint8_t dst_l2addr_len;             /**< length of @ref dst_l2addr */
+    /**
+     * @brief   length of @ref hdr, 0 if the template is not valid
+     */
+    uint8_t hdr_len;
+    uint8_t l2addr[GNRC_NETIF_L2ADDR_MAXLEN];       /**< address of @ref iface */
+    uint8_t dst_l2addr[GNRC_NETIF_L2ADDR_MAXLEN];   /**< next hop */
+    /**
+     * @brief   the compressed headers, up to the UDP checksum
+     */
+    uint8_t hdr[sizeof(ipv6_hdr_t) + sizeof(udp_hdr_t)];
+} _iphc_tmpl_t;
+
+static _iphc_tmpl_t _tmpls[IPHC_TMPL_SIZE];
+#endif  /* IPHC_TMPL_SIZE */
+
 static inline bool _is_rfrag(gnrc_pktsnip_t *sixlo)
 {
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
@@ -1614,58 +1655,16 @@ static inline bool _compressible(gnrc_pktsnip_t *hdr)
     }
 }
 
-static gnrc_pktsnip_t *_iphc_encode(gnrc_pktsnip_t *pkt,
-                                    const gnrc_netif_hdr_t *netif_hdr,
-                                    gnrc_netif_t *iface)
+static size_t _iphc_compress(gnrc_pktsnip_t *pkt,
+                             const gnrc_netif_hdr_t *netif_hdr,
+                             gnrc_netif_t *iface, uint8_t *iphc_hdr)
 {
-    assert(pkt != NULL);
-    uint8_t *iphc_hdr;
-    gnrc_pktsnip_t *dispatch, *ptr = pkt->next;
-    size_t dispatch_size = 0;
-    uint16_t inline_pos = 0;
+    uint16_t inline_pos = _iphc_ipv6_encode(pkt, netif_hdr, iface, iphc_hdr);
     uint8_t nh;
 
-    dispatch = NULL;    /* use dispatch as temporary pointer for prev */
-    /* determine maximum dispatch size and write protect all headers until
-     * then because they will be removed */
-    while ((ptr != NULL) && _compressible(ptr)) {
-        gnrc_pktsnip_t *tmp = gnrc_pktbuf_start_write(ptr);
-
-        if (tmp == NULL) {
-            DEBUG("6lo iphc: unable to write protect compressible header\n");
-            return NULL;
-        }
-        ptr = tmp;
-        if (dispatch == NULL) {
-            /* pkt was already write protected in gnrc_sixlowpan.c:_send so
-             * we shouldn't do it again */
-            pkt->next = ptr;    /* reset original packet */
-        }
-        else {
-            dispatch->next = ptr;
-        }
-        dispatch_size += ptr->size;
-        dispatch = ptr; /* use dispatch as temporary point for prev */
-        ptr = ptr->next;
-    }
-    /* there should be at least one compressible header in `pkt`, otherwise this
-     * function should not be called */
-    assert(dispatch_size > 0);
-    dispatch = gnrc_pktbuf_add(NULL, NULL, dispatch_size + 1,
-                               GNRC_NETTYPE_SIXLOWPAN);
-
-    if (dispatch == NULL) {
-        DEBUG("6lo iphc: error allocating dispatch space\n");
-        return NULL;
-    }
-
-    iphc_hdr = dispatch->data;
-    inline_pos = _iphc_ipv6_encode(pkt, netif_hdr, iface, iphc_hdr);
-
     if (inline_pos == 0) {
         DEBUG("6lo iphc: error encoding IPv6 header\n");
-        gnrc_pktbuf_release(dispatch);
-        return NULL;
+        return 0;
     }
 
     nh = ((ipv6_hdr_t *)pkt->next->data)->nh;
@@ -1674,8 +1673,7 @@ static gnrc_pktsnip_t *_iphc_encode(gnrc_pktsnip_t *pkt,
         ssize_t local_pos = 0;
         if (pkt->next->next == NULL) {
             DEBUG("6lo iphc: packet next header missing data");
-            gnrc_pktbuf_release(dispatch);
-            return NULL;
+            return 0;
         }
         switch (nh) {
             case PROTNUM_UDP:
@@ -1709,13 +1707,218 @@ static gnrc_pktsnip_t *_iphc_encode(gnrc_pktsnip_t *pkt,
         }
         if (local_pos < 0) {
             DEBUG("6lo iphc: error on compressing next header\n");
-            gnrc_pktbuf_release(dispatch);
-            return NULL;
+            return 0;
         }
         inline_pos += local_pos;
     }
 #endif
 
+    return inline_pos;
+}
+
+#if IPHC_TMPL_SIZE
+static unsigned _iphc_tmpl_idx(const ipv6_hdr_t *ipv6_hdr,
+                               const udp_hdr_t *udp_hdr)
+{
+    uint32_t hash = ipv6_hdr->src.u32[3].u32 ^ ipv6_hdr->dst.u32[0].u32 ^
+                    ipv6_hdr->dst.u32[1].u32 ^ ipv6_hdr->dst.u32[2].u32 ^
+                    ipv6_hdr->dst.u32[3].u32 ^
+                    ((uint32_t)udp_hdr->src_port.u16 << 16) ^
+                    udp_hdr->dst_port.u16;
+
+    hash ^= hash >> 16;
+    hash ^= hash >> 8;
+    return hash & (IPHC_TMPL_SIZE - 1);
+}
+
+static uint16_t _iphc_tmpl_ctxs(const uint8_t *iphc_hdr)
+{
+    uint8_t sci = 0, dci = 0;
+    uint16_t ctxs = 0;
+
+    if (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_CID_EXT) {
+        sci = iphc_hdr[CID_EXT_IDX] >> 4;
+        dci = iphc_hdr[CID_EXT_IDX] & 0x0f;
+    }
+    /* SAC without SAM is the unspecified address, that needs no context */
+    if ((iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_SAC) &&
+        (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_SAM)) {
+        ctxs |= (1U << sci);
+    }
+    if (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_DAC) {
+        ctxs |= (1U << dci);
+    }
+    return ctxs;
+}
+
+static bool _iphc_tmpl_match(const _iphc_tmpl_t *tmpl,
+                             const ipv6_hdr_t *ipv6_hdr,
+                             const udp_hdr_t *udp_hdr,
+                             const gnrc_netif_hdr_t *netif_hdr,
+                             gnrc_netif_t *iface, uint32_t ctx_generation)
+{
+    if ((tmpl->hdr_len == 0) || (tmpl->iface != iface) ||
+        (tmpl->ctx_generation != ctx_generation) ||
+        (tmpl->v_tc_fl.u32 != ipv6_hdr->v_tc_fl.u32) ||
+        (tmpl->hl != ipv6_hdr->hl) ||
+        (tmpl->src_port.u16 != udp_hdr->src_port.u16) ||
+        (tmpl->dst_port.u16 != udp_hdr->dst_port.u16) ||
+        !ipv6_addr_equal(&tmpl->dst, &ipv6_hdr->dst) ||
+        !ipv6_addr_equal(&tmpl->src, &ipv6_hdr->src) ||
+        (tmpl->dst_l2addr_len != netif_hdr->dst_l2addr_len) ||
+        (memcmp(tmpl->dst_l2addr, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                netif_hdr->dst_l2addr_len) != 0)) {
+        return false;
+    }
+    /* the source address may be elided based on the address of the
+     * interface */
+    gnrc_netif_acquire(iface);
+    if ((tmpl->l2addr_len != iface->l2addr_len) ||
+        (memcmp(tmpl->l2addr, iface->l2addr, iface->l2addr_len) != 0)) {
+        gnrc_netif_release(iface);
+        return false;
+    }
+    gnrc_netif_release(iface);
+    /* adding or changing a context changes the generation, but a context
+     * used by the template may also have expired or been removed */
+    for (uint8_t id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
+        if (tmpl->ctxs & (1U << id)) {
+            gnrc_sixlowpan_ctx_t *ctx = gnrc_sixlowpan_ctx_lookup_id(id);
+
+            if ((ctx == NULL) || !(ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void _iphc_tmpl_set(_iphc_tmpl_t *tmpl, const ipv6_hdr_t *ipv6_hdr,
+                           const udp_hdr_t *udp_hdr,
+                           const gnrc_netif_hdr_t *netif_hdr,
+                           gnrc_netif_t *iface, uint32_t ctx_generation)
+{
+    tmpl->iface = iface;
+    tmpl->ctx_generation = ctx_generation;
+    tmpl->v_tc_fl = ipv6_hdr->v_tc_fl;
+    tmpl->src = ipv6_hdr->src;
+    tmpl->dst = ipv6_hdr->dst;
+    tmpl->hl = ipv6_hdr->hl;
+    tmpl->src_port = udp_hdr->src_port;
+    tmpl->dst_port = udp_hdr->dst_port;
+    tmpl->dst_l2addr_len = netif_hdr->dst_l2addr_len;
+    memcpy(tmpl->dst_l2addr, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+           netif_hdr->dst_l2addr_len);
+    gnrc_netif_acquire(iface);
+    tmpl->l2addr_len = iface->l2addr_len;
+    memcpy(tmpl->l2addr, iface->l2addr, iface->l2addr_len);
+    gnrc_netif_release(iface);
+}
+
+static size_t _iphc_tmpl_compress(gnrc_pktsnip_t *pkt,
+                                  const gnrc_netif_hdr_t *netif_hdr,
+                                  gnrc_netif_t *iface, uint8_t *iphc_hdr)
+{
+    gnrc_pktsnip_t *ipv6 = pkt->next, *udp;
+    const ipv6_hdr_t *ipv6_hdr = ipv6->data;
+    const udp_hdr_t *udp_hdr;
+    _iphc_tmpl_t *tmpl;
+    uint32_t ctx_generation;
+    size_t inline_pos;
+
+    /* only UDP directly in IPv6 */
+    if ((ipv6->type != GNRC_NETTYPE_IPV6) ||
+        (ipv6->size != sizeof(ipv6_hdr_t)) ||
+        (ipv6_hdr->nh != PROTNUM_UDP) || (ipv6->next == NULL) ||
+        (ipv6->next->type != GNRC_NETTYPE_UDP) ||
+        (ipv6->next->size != sizeof(udp_hdr_t))) {
+        return _iphc_compress(pkt, netif_hdr, iface, iphc_hdr);
+    }
+    udp = ipv6->next;
+    udp_hdr = udp->data;
+    tmpl = &_tmpls[_iphc_tmpl_idx(ipv6_hdr, udp_hdr)];
+    /* get the generation before compressing, so a change of the contexts
+     * while compressing is noticed */
+    ctx_generation = gnrc_sixlowpan_ctx_generation();
+    if (_iphc_tmpl_match(tmpl, ipv6_hdr, udp_hdr, netif_hdr, iface,
+                         ctx_generation)) {
+        DEBUG("6lo iphc: compress using template\n");
+        memcpy(iphc_hdr, tmpl->hdr, tmpl->hdr_len);
+        inline_pos = tmpl->hdr_len;
+        iphc_hdr[inline_pos++] = udp_hdr->checksum.u8[0];
+        iphc_hdr[inline_pos++] = udp_hdr->checksum.u8[1];
+        gnrc_pktbuf_remove_snip(pkt, udp);
+        return inline_pos;
+    }
+    /* the headers are removed while compressing, so keep the flow first */
+    _iphc_tmpl_set(tmpl, ipv6_hdr, udp_hdr, netif_hdr, iface, ctx_generation);
+    tmpl->hdr_len = 0;
+    inline_pos = _iphc_compress(pkt, netif_hdr, iface, iphc_hdr);
+    if (inline_pos > sizeof(udp_hdr->checksum)) {
+        /* the UDP checksum is always the last field */
+        tmpl->hdr_len = inline_pos - sizeof(udp_hdr->checksum);
+        memcpy(tmpl->hdr, iphc_hdr, tmpl->hdr_len);
+        tmpl->ctxs = _iphc_tmpl_ctxs(iphc_hdr);
+    }
+    return inline_pos;
+}
+#endif  /* IPHC_TMPL_SIZE */
+
+static gnrc_pktsnip_t *_iphc_encode(gnrc_pktsnip_t *pkt,
+                                    const gnrc_netif_hdr_t *netif_hdr,
+                                    gnrc_netif_t *iface)
+{
+    assert(pkt != NULL);
+    uint8_t *iphc_hdr;
+    gnrc_pktsnip_t *dispatch, *ptr = pkt->next;
+    size_t dispatch_size = 0;
+    uint16_t inline_pos = 0;
+
+    dispatch = NULL;    /* use dispatch as temporary pointer for prev */
+    /* determine maximum dispatch size and write protect all headers until
+     * then because they will be removed */
+    while ((ptr != NULL) && _compressible(ptr)) {
+        gnrc_pktsnip_t *tmp = gnrc_pktbuf_start_write(ptr);
+
+        if (tmp == NULL) {
+            DEBUG("6lo iphc: unable to write protect compressible header\n");
+            return NULL;
+        }
+        ptr = tmp;
+        if (dispatch == NULL) {
+            /* pkt was already write protected in gnrc_sixlowpan.c:_send so
+             * we shouldn't do it again */
+            pkt->next = ptr;    /* reset original packet */
+        }
+        else {
+            dispatch->next = ptr;
+        }
+        dispatch_size += ptr->size;
+        dispatch = ptr; /* use dispatch as temporary point for prev */
+        ptr = ptr->next;
+    }
+    /* there should be at least one compressible header in `pkt`, otherwise this
+     * function should not be called */
+    assert(dispatch_size > 0);
+    dispatch = gnrc_pktbuf_add(NULL, NULL, dispatch_size + 1,
+                               GNRC_NETTYPE_SIXLOWPAN);
+
+    if (dispatch == NULL) {
+        DEBUG("6lo iphc: error allocating dispatch space\n");
+        return NULL;
+    }
+
+    iphc_hdr = dispatch->data;
+#if IPHC_TMPL_SIZE
+    inline_pos = _iphc_tmpl_compress(pkt, netif_hdr, iface, iphc_hdr);
+#else
+    inline_pos = _iphc_compress(pkt, netif_hdr, iface, iphc_hdr);
+#endif
+    if (inline_pos == 0) {
+        gnrc_pktbuf_release(dispatch);
+        return NULL;
+    }
+
     /* shrink dispatch allocation to final size */
     /* NOTE: Since this only shrinks the data nothing bad SHOULD happen ;-) */
     gnrc_pktbuf_realloc_data(dispatch, (size_t)inline_pos);
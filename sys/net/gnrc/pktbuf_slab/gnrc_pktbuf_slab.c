@@ -0,0 +1,562 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Packet buffer backend using slabs of fixed size blocks
+ *
+ * The buffer is split into one slab per size class. Each slab keeps its free
+ * blocks in a LIFO list, so allocating and releasing a block takes constant
+ * time. An allocation is served from the smallest class it fits in and falls
+ * back to the larger classes if that one is exhausted.
+ *
+ * @ref gnrc_pktbuf_mark() does not copy, the marked and the remaining data
+ * share the block of the original data. A per-block reference count keeps
+ * track of that, so the block is only released after both are released.
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include "mutex.h"
+#include "od.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+#include "string_utils.h"
+
+#include "pktbuf_internal.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define SLAB_ALIGN              (alignof(max_align_t))
+#define SLAB_ALIGN_UP(size)     (((size) + SLAB_ALIGN - 1) & ~(SLAB_ALIGN - 1))
+
+#define SLAB_SNIP_SIZE          SLAB_ALIGN_UP(sizeof(gnrc_pktsnip_t))
+#define SLAB_SMALL_SIZE         SLAB_ALIGN_UP(CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE)
+#define SLAB_MEDIUM_SIZE        SLAB_ALIGN_UP(CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE)
+#define SLAB_LARGE_SIZE         SLAB_ALIGN_UP(CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE)
+
+#define SLAB_SNIP_BYTES         (SLAB_SNIP_SIZE * CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF)
+#define SLAB_SMALL_BYTES        (SLAB_SMALL_SIZE * CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF)
+#define SLAB_MEDIUM_BYTES       (SLAB_MEDIUM_SIZE * CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF)
+#define SLAB_LARGE_BYTES        (SLAB_LARGE_SIZE * CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF)
+
+#define SLAB_BLOCKS_NUMOF       (CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF + \
+                                 CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF + \
+                                 CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF + \
+                                 CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF)
+
+static_assert((SLAB_SNIP_SIZE <= SLAB_SMALL_SIZE) &&
+              (SLAB_SMALL_SIZE <= SLAB_MEDIUM_SIZE) &&
+              (SLAB_MEDIUM_SIZE <= SLAB_LARGE_SIZE),
+              "size classes of gnrc_pktbuf_slab must be in ascending order");
+static_assert(SLAB_LARGE_SIZE <= UINT16_MAX,
+              "CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE must fit into 16 bits");
+
+/**
+ * @brief   Link of a free block
+ */
+typedef struct _free {
+    struct _free *next;     /**< next free block of the same slab */
+} _free_t;
+
+/**
+ * @brief   Constant properties of a slab
+ */
+typedef struct {
+    uint8_t *start;         /**< first block */
+    uint16_t size;          /**< size of a block */
+    uint16_t numof;         /**< number of blocks */
+    uint16_t first;         /**< index of the first block in _refs */
+    const char *name;       /**< name of the size class */
+} _slab_conf_t;
+
+/**
+ * @brief   State of a slab
+ */
+typedef struct {
+    _free_t *free;          /**< LIFO list of free blocks */
+    uint16_t used;          /**< number of blocks in use */
+#ifdef DEVELHELP
+    uint16_t max_used;      /**< maximum number of blocks in use */
+    uint32_t allocs;        /**< number of allocations */
+    uint32_t failed;        /**< number of failed allocations for this class */
+    size_t bytes;           /**< number of bytes requested in used blocks */
+#endif
+} _slab_t;
+
+enum {
+    SLAB_SNIP,
+    SLAB_SMALL,
+    SLAB_MEDIUM,
+    SLAB_LARGE,
+    SLAB_NUMOF,
+};
+
+static alignas(SLAB_ALIGN) uint8_t _slab_buf[SLAB_SNIP_BYTES + SLAB_SMALL_BYTES +
+                                             SLAB_MEDIUM_BYTES + SLAB_LARGE_BYTES];
+
+static const _slab_conf_t _conf[SLAB_NUMOF] = {
+    [SLAB_SNIP] = {
+        .start = &_slab_buf[0],
+        .size = SLAB_SNIP_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF,
+        .first = 0,
+        .name = "snip",
+    },
+    [SLAB_SMALL] = {
+        .start = &_slab_buf[SLAB_SNIP_BYTES],
+        .size = SLAB_SMALL_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF,
+        .first = CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF,
+        .name = "small",
+    },
+    [SLAB_MEDIUM] = {
+        .start = &_slab_buf[SLAB_SNIP_BYTES + SLAB_SMALL_BYTES],
+        .size = SLAB_MEDIUM_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF,
+        .first = CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF +
+                 CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF,
+        .name = "medium",
+    },
+    [SLAB_LARGE] = {
+        .start = &_slab_buf[SLAB_SNIP_BYTES + SLAB_SMALL_BYTES + SLAB_MEDIUM_BYTES],
+        .size = SLAB_LARGE_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF,
+        .first = CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF +
+                 CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF +
+                 CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF,
+        .name = "large",
+    },
+};
+
+static _slab_t _slabs[SLAB_NUMOF];
+/* number of snips and split data sections referencing a block */
+static uint8_t _refs[SLAB_BLOCKS_NUMOF];
+#ifdef DEVELHELP
+/* number of bytes requested in a block */
+static uint16_t _lens[SLAB_BLOCKS_NUMOF];
+#endif
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+static void *_pktbuf_alloc(size_t size);
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+/* Returns the index of the block ptr points into and stores its slab in
+ * slab_idx, or -1 if ptr is not in the packet buffer */
+static int _block(const void *ptr, unsigned *slab_idx)
+{
+    uintptr_t addr = (uintptr_t)ptr;
+
+    for (unsigned i = 0; i < SLAB_NUMOF; i++) {
+        const _slab_conf_t *conf = &_conf[i];
+        uintptr_t start = (uintptr_t)conf->start;
+
+        if ((addr >= start) && (addr < (start + (conf->size * conf->numof)))) {
+            *slab_idx = i;
+            return conf->first + ((addr - start) / conf->size);
+        }
+    }
+    return -1;
+}
+
+static inline uint8_t *_block_start(unsigned slab_idx, int block)
+{
+    const _slab_conf_t *conf = &_conf[slab_idx];
+
+    return conf->start + ((block - conf->first) * conf->size);
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        memset(_slab_buf, GNRC_PKTBUF_CANARY, sizeof(_slab_buf));
+    }
+    memset(_slabs, 0, sizeof(_slabs));
+    memset(_refs, 0, sizeof(_refs));
+    for (unsigned i = 0; i < SLAB_NUMOF; i++) {
+        const _slab_conf_t *conf = &_conf[i];
+
+        /* push in reverse order, so that blocks are handed out in ascending
+         * order from a fresh buffer. Blocks are aligned to SLAB_ALIGN, cast to
+         * uintptr_t as intermediate step to silence -Wcast-align */
+        for (unsigned j = conf->numof; j > 0; j--) {
+            _free_t *block = (_free_t *)(uintptr_t)(conf->start +
+                                                    ((j - 1) * conf->size));
+            block->next = _slabs[i].free;
+            _slabs[i].free = block;
+        }
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > SLAB_LARGE_SIZE) {
+        DEBUG("pktbuf: size (%" PRIuSIZE ") > largest block (%u)\n",
+              size, (unsigned)SLAB_LARGE_SIZE);
+        return NULL;
+    }
+    mutex_lock(&gnrc_pktbuf_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+    void *new_data_marked;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %" PRIuSIZE ") or pkt == NULL (was %p) or "
+              "size > pkt->size (was %" PRIuSIZE ") or pkt->data == NULL (was %p)\n",
+              size, (void *)pkt, (pkt ? pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    new_data_marked = pkt->data;
+    if (pkt->size != size) {
+        unsigned slab_idx;
+        int block = _block(pkt->data, &slab_idx);
+
+        /* marked and remaining data now share the block */
+        assert((block >= 0) && (_refs[block] < UINT8_MAX));
+        _refs[block]++;
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    else {
+        pkt->data = NULL;
+    }
+    pkt->size -= size;
+    _set_pktsnip(marked_snip, pkt->next, new_data_marked, size, type);
+    pkt->next = marked_snip;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return marked_snip;
+}
+
+/* Resizes data in its block if it is the only user of the block or shrinks */
+static bool _resize_in_place(void *data, size_t old_size, size_t size)
+{
+    unsigned slab_idx;
+    int block = _block(data, &slab_idx);
+    size_t offset;
+
+    assert(block >= 0);
+    offset = (uint8_t *)data - _block_start(slab_idx, block);
+    if ((size > old_size) &&
+        ((_refs[block] > 1) || ((offset + size) > _conf[slab_idx].size))) {
+        return false;
+    }
+#ifdef DEVELHELP
+    if (_refs[block] == 1) {
+        _slabs[slab_idx].bytes -= _lens[block];
+        _lens[block] = offset + size;
+        _slabs[slab_idx].bytes += _lens[block];
+    }
+#endif
+    return true;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && gnrc_pktbuf_contains(pkt->data)));
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+        pkt->data = NULL;
+    }
+    else if ((pkt->data == NULL) || !_resize_in_place(pkt->data, pkt->size, size)) {
+        void *new_data = _pktbuf_alloc(size);
+        if (new_data == NULL) {
+            DEBUG("pktbuf: error allocating new data section\n");
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return ENOMEM;
+        }
+        if (pkt->data != NULL) {            /* if old data exist */
+            memcpy(new_data, pkt->data, (pkt->size < size) ? pkt->size : size);
+        }
+        gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+        pkt->data = new_data;
+    }
+    pkt->size = size;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    while (pkt) {
+        assert(pkt->users + num <= 0xff);
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE &&
+        pkt->users == GNRC_PKTBUF_CANARY) {
+        puts("gnrc_pktbuf: use after free detected\n");
+        DEBUG_BREAKPOINT(3);
+    }
+
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return new;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    printf("packet buffer (slab): first byte: %p, last byte: %p (size: %" PRIuSIZE ")\n",
+           (void *)&_slab_buf[0], (void *)&_slab_buf[sizeof(_slab_buf)],
+           sizeof(_slab_buf));
+    for (unsigned i = 0; i < SLAB_NUMOF; i++) {
+        const _slab_conf_t *conf = &_conf[i];
+        const _slab_t *slab = &_slabs[i];
+
+        printf("  slab %-6s (block size: %4u): used: %3u/%3u, max used: %3u, "
+               "allocs: %" PRIu32 ", failed: %" PRIu32 ", bytes: %" PRIuSIZE "\n",
+               conf->name, conf->size, slab->used, conf->numof, slab->max_used,
+               slab->allocs, slab->failed, slab->bytes);
+    }
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned i = 0; i < SLAB_NUMOF; i++) {
+        if (_slabs[i].used > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    /* Invariants of this implementation:
+     *  - forall block in free list of a slab: block is at a block boundary
+     *                                         of that slab && _refs[block] == 0
+     *  - forall slab: length of free list + used == number of blocks
+     */
+    for (unsigned i = 0; i < SLAB_NUMOF; i++) {
+        const _slab_conf_t *conf = &_conf[i];
+        unsigned free_numof = 0;
+
+        for (_free_t *ptr = _slabs[i].free; ptr != NULL; ptr = ptr->next) {
+            unsigned slab_idx;
+            int block = _block(ptr, &slab_idx);
+
+            if ((block < 0) || (slab_idx != i) ||
+                ((uint8_t *)ptr != _block_start(slab_idx, block)) ||
+                (_refs[block] != 0) || (free_numof >= conf->numof)) {
+                return false;
+            }
+            free_numof++;
+        }
+        if ((free_numof + _slabs[i].used) != conf->numof) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _pktbuf_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            gnrc_pktbuf_free_internal(pkt, sizeof(gnrc_pktsnip_t));
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+static void *_pktbuf_alloc(size_t size)
+{
+    unsigned i = 0;
+
+    /* find the smallest class that fits */
+    while ((i < SLAB_NUMOF) && (size > _conf[i].size)) {
+        i++;
+    }
+#ifdef DEVELHELP
+    unsigned fitting = i;
+#endif
+    /* fall back to larger classes if it is exhausted */
+    while ((i < SLAB_NUMOF) && (_slabs[i].free == NULL)) {
+        i++;
+    }
+    if (i == SLAB_NUMOF) {
+        DEBUG("pktbuf: no block left for %" PRIuSIZE " bytes\n", size);
+#ifdef DEVELHELP
+        if (fitting < SLAB_NUMOF) {
+            _slabs[fitting].failed++;
+        }
+#endif
+        return NULL;
+    }
+
+    _slab_t *slab = &_slabs[i];
+    _free_t *ptr = slab->free;
+    unsigned slab_idx;
+    int block = _block(ptr, &slab_idx);
+
+    slab->free = ptr->next;
+    slab->used++;
+    _refs[block] = 1;
+#ifdef DEVELHELP
+    if (slab->used > slab->max_used) {
+        slab->max_used = slab->used;
+    }
+    slab->allocs++;
+    slab->bytes += size;
+    _lens[block] = size;
+#endif
+
+    const void *mismatch;
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE &&
+        (mismatch = memchk(ptr + 1, GNRC_PKTBUF_CANARY,
+                           _conf[i].size - sizeof(_free_t)))) {
+        printf("[%p] mismatch at offset %"PRIuPTR"/%u"
+               " (ignoring %" PRIuSIZE " initial bytes that were repurposed)\n",
+               (void *)ptr, (uintptr_t)mismatch - (uintptr_t)ptr, _conf[i].size,
+               sizeof(_free_t));
+#ifdef MODULE_OD
+        od_hex_dump(ptr, _conf[i].size, 0);
+#endif
+        assert(0);
+    }
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        /* clear out canary */
+        memset(ptr, ~GNRC_PKTBUF_CANARY, _conf[i].size);
+    }
+
+    return ptr;
+}
+
+void gnrc_pktbuf_free_internal(void *data, size_t size)
+{
+    unsigned slab_idx;
+    int block;
+
+    (void)size;
+    if (data == NULL) {
+        return;
+    }
+    block = _block(data, &slab_idx);
+    assert((block >= 0) && (_refs[block] > 0));
+    if (--_refs[block] > 0) {
+        /* data was split by gnrc_pktbuf_mark() and the other part is still
+         * in use */
+        return;
+    }
+
+    /* Blocks are aligned to SLAB_ALIGN, cast to uintptr_t as intermediate
+     * step to silence -Wcast-align */
+    _free_t *ptr = (_free_t *)(uintptr_t)_block_start(slab_idx, block);
+    _slab_t *slab = &_slabs[slab_idx];
+
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        memset(ptr, GNRC_PKTBUF_CANARY, _conf[slab_idx].size);
+    }
+    ptr->next = slab->free;
+    slab->free = ptr;
+    slab->used--;
+#ifdef DEVELHELP
+    slab->bytes -= _lens[block];
+#endif
+}
+
+bool gnrc_pktbuf_contains(void *ptr)
+{
+    return (&_slab_buf[0] <= (uint8_t *)ptr) &&
+           ((uint8_t *)ptr < &_slab_buf[sizeof(_slab_buf)]);
+}
+
+/** @} */
@@ -197,49 +197,30 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     return 0;
 }
 
-ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
-                       const sock_ip_ep_t *remote, uint8_t nh)
+int gnrc_sock_hdr_build(gnrc_pktsnip_t **pkt, sock_ip_ep_t *local,
+                        const sock_ip_ep_t *remote, uint8_t nh)
 {
-    gnrc_pktsnip_t *pkt;
+    gnrc_pktsnip_t *payload = *pkt;
     kernel_pid_t iface = KERNEL_PID_UNDEF;
-    gnrc_nettype_t type;
-    size_t payload_len = gnrc_pkt_len(payload);
-#ifdef MODULE_GNRC_NETERR
-    unsigned status_subs = 0;
-#endif
-#if IS_USED(MODULE_GNRC_TX_SYNC)
-    gnrc_tx_sync_t tx_sync;
-#endif
 
     if (local->family != remote->family) {
         gnrc_pktbuf_release(payload);
         return -EAFNOSUPPORT;
     }
 
-#if IS_USED(MODULE_GNRC_TX_SYNC)
-    if (gnrc_tx_sync_append(payload, &tx_sync)) {
-        gnrc_pktbuf_release(payload);
-        return -ENOMEM;
-    }
-#endif
-
     switch (local->family) {
 #ifdef SOCK_HAS_IPV6
         case AF_INET6: {
             ipv6_hdr_t *hdr;
-            pkt = gnrc_ipv6_hdr_build(payload, (ipv6_addr_t *)&local->addr.ipv6,
-                                      (ipv6_addr_t *)&remote->addr.ipv6);
-            if (pkt == NULL) {
+            *pkt = gnrc_ipv6_hdr_build(payload, (ipv6_addr_t *)&local->addr.ipv6,
+                                       (ipv6_addr_t *)&remote->addr.ipv6);
+            if (*pkt == NULL) {
                 return -ENOMEM;
             }
             if (payload->type == GNRC_NETTYPE_UNDEF) {
                 payload->type = GNRC_NETTYPE_IPV6;
-                type = GNRC_NETTYPE_IPV6;
             }
-            else {
-                type = payload->type;
-            }
-            hdr = pkt->data;
+            hdr = (*pkt)->data;
             hdr->nh = nh;
             break;
         }
@@ -262,17 +243,44 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
         gnrc_netif_hdr_t *netif_hdr;
 
         if (netif == NULL) {
-            gnrc_pktbuf_release(pkt);
+            gnrc_pktbuf_release(*pkt);
             return -ENOMEM;
         }
         netif_hdr = netif->data;
         netif_hdr->if_pid = iface;
-        pkt = gnrc_pkt_prepend(pkt, netif);
+        *pkt = gnrc_pkt_prepend(*pkt, netif);
+    }
+    return 0;
+}
+
+ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                       const sock_ip_ep_t *remote, uint8_t nh)
+{
+    gnrc_pktsnip_t *pkt = payload;
+    gnrc_nettype_t type;
+    size_t payload_len = gnrc_pkt_len(payload);
+    int err;
+#ifdef MODULE_GNRC_NETERR
+    unsigned status_subs = 0;
+#endif
+#if IS_USED(MODULE_GNRC_TX_SYNC)
+    gnrc_tx_sync_t tx_sync;
+#endif
+
+    if ((err = gnrc_sock_hdr_build(&pkt, local, remote, nh)) < 0) {
+        return err;
     }
+    /* the network layer header was put in front of the payload */
+    type = payload->type;
+
+#if IS_USED(MODULE_GNRC_TX_SYNC)
+    if (gnrc_tx_sync_append(pkt, &tx_sync)) {
+        gnrc_pktbuf_release(pkt);
+        return -ENOMEM;
+    }
+#endif
+
 #ifdef MODULE_GNRC_NETERR
-    /* cppcheck-suppress uninitvar
-     * (reason: pkt is initialized in AF_INET6 case above, otherwise function
-     * will return early) */
     for (gnrc_pktsnip_t *ptr = pkt; ptr != NULL; ptr = ptr->next) {
         /* no error should occur since pkt was created here */
         gnrc_neterr_reg(ptr);
@@ -323,4 +331,25 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
     return payload_len;
 }
 
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+unsigned gnrc_sock_send_batch(gnrc_pktqueue_t *batch)
+{
+    int numof = 0;
+
+    /* the packets skip the transport layer thread, so only the network layer
+     * thread gets woken up */
+#ifdef MODULE_GNRC_IPV6
+    if (gnrc_ipv6_pid != KERNEL_PID_UNDEF) {
+        numof = gnrc_netapi_send_batch(gnrc_ipv6_pid, batch);
+    }
+#endif
+    for (int i = 0; batch != NULL; batch = batch->next, i++) {
+        if (i >= numof) {
+            gnrc_pktbuf_release(batch->pkt);
+        }
+    }
+    return numof;
+}
+#endif
+
 /** @} */
@@ -164,6 +164,31 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt, uint32_t time
  */
 ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
                        const sock_ip_ep_t *remote, uint8_t nh);
+
+/**
+ * @brief   Prepend the network layer headers to a packet internally
+ *
+ * @param[in,out] pkt   The packet. Points to the packet with headers on
+ *                      success.
+ *
+ * @return  0 on success
+ * @return  negative errno on error
+ * @internal
+ */
+int gnrc_sock_hdr_build(gnrc_pktsnip_t **pkt, sock_ip_ep_t *local,
+                        const sock_ip_ep_t *remote, uint8_t nh);
+
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+/**
+ * @brief   Send a batch of packets prepared with gnrc_sock_hdr_build()
+ *          internally
+ *
+ * @return  number of packets from the head of @p batch that were sent, the
+ *          others are released
+ * @internal
+ */
+unsigned gnrc_sock_send_batch(gnrc_pktqueue_t *batch);
+#endif
 /** @internal
  * @}
  */
@@ -58,6 +58,21 @@ extern "C" {
 #ifndef CONFIG_GNRC_SOCK_MBOX_SIZE_EXP
 #define CONFIG_GNRC_SOCK_MBOX_SIZE_EXP      (3)
 #endif
+
+/**
+ * @brief   Maximum number of datagrams @ref sock_udp_send_batch() hands down
+ *          the network stack in one message
+ *
+ *          Larger batches are split. Every datagram of a batch needs a
+ *          @ref gnrc_pktqueue_t on the stack of the sending thread. Only
+ *          used with the `gnrc_netapi_batch` module. With `gnrc_neterr` or
+ *          `gnrc_tx_sync`, the datagrams are sent one by one instead, so that
+ *          errors reported by the lower layers and the TX synchronization
+ *          still apply to every single datagram.
+ */
+#ifndef CONFIG_GNRC_SOCK_UDP_BATCH_SIZE
+#define CONFIG_GNRC_SOCK_UDP_BATCH_SIZE     (16U)
+#endif
 /** @} */
 
 /**
@@ -140,6 +155,41 @@ struct sock_udp {
     uint16_t flags;                        /**< option flags */
 };
 
+#if defined(MODULE_GNRC_SOCK_UDP) || defined(DOXYGEN)
+/**
+ * @brief   Receives a UDP message and lends its packet to the caller
+ *
+ * This is the zero-copy counterpart to @ref sock_udp_recv_buf_aux() for
+ * applications that are aware of @ref net_gnrc_pkt: instead of handing out the
+ * payload slice by slice, the received packet itself is returned. The payload
+ * is the scatter list of the snips from @p pkt up to, but excluding, the
+ * @ref GNRC_NETTYPE_UDP snip, i.e. in the common case just @p pkt. The packet
+ * is lent until the caller releases it with @ref gnrc_pktbuf_release().
+ *
+ * As the packet may be shared with other receivers, it must not be written
+ * to without @ref gnrc_pktbuf_start_write().
+ *
+ * @pre `(sock != NULL) && (pkt != NULL)`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[out] pkt      The received packet. Must be released with
+ *                      @ref gnrc_pktbuf_release() by the caller.
+ * @param[in] timeout   Timeout for receive in microseconds, see
+ *                      @ref sock_udp_recv_aux().
+ * @param[out] remote   Remote end point of the received data.
+ *                      May be NULL, if it is not required by the application.
+ * @param[out] aux      Auxiliary data about the received datagram.
+ *                      May be `NULL`, if it is not required by the application.
+ *
+ * @return  The number of bytes in the payload of @p pkt on success.
+ * @return  The same errors as @ref sock_udp_recv_buf_aux(). @p pkt is not
+ *          set then.
+ */
+ssize_t gnrc_sock_udp_recv_pkt(sock_udp_t *sock, gnrc_pktsnip_t **pkt,
+                               uint32_t timeout, sock_udp_ep_t *remote,
+                               sock_udp_aux_rx_t *aux);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
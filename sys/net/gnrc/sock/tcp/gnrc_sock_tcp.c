@@ -141,6 +141,6 @@ ssize_t sock_tcp_write(sock_tcp_t *sock, const void *data, size_t len)
 
     /* Forward call to gnrc_tcp_send.
      * NOTE: gnrc_tcp_send offers a timeout. By setting it to 0, the call blocks
-     * until at least some data was transmitted. */
+     * until at least some data was copied into the send buffer. */
     return gnrc_tcp_send(sock, data, len, 0);
 }
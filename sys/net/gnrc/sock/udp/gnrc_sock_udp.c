@@ -249,9 +249,9 @@ static bool _accept_remote(const sock_udp_t *sock, const udp_hdr_t *hdr,
     return true;
 }
 
-ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
-                              uint32_t timeout, sock_udp_ep_t *remote,
-                              sock_udp_aux_rx_t *aux)
+ssize_t gnrc_sock_udp_recv_pkt(sock_udp_t *sock, gnrc_pktsnip_t **pkt_out,
+                               uint32_t timeout, sock_udp_ep_t *remote,
+                               sock_udp_aux_rx_t *aux)
 {
     (void)aux;
     gnrc_pktsnip_t *pkt, *udp;
@@ -260,13 +260,7 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
     int res;
     gnrc_sock_recv_aux_t _aux = { 0 };
 
-    assert((sock != NULL) && (data != NULL) && (buf_ctx != NULL));
-    if (*buf_ctx != NULL) {
-        *data = NULL;
-        gnrc_pktbuf_release(*buf_ctx);
-        *buf_ctx = NULL;
-        return 0;
-    }
+    assert((sock != NULL) && (pkt_out != NULL));
     if (sock->local.family == AF_UNSPEC) {
         return -EADDRNOTAVAIL;
     }
@@ -328,23 +322,48 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
         }
     }
 #endif
+    *pkt_out = pkt;
+    return gnrc_pkt_len_upto(pkt, GNRC_NETTYPE_UDP) - udp->size;
+}
+
+ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
+                              uint32_t timeout, sock_udp_ep_t *remote,
+                              sock_udp_aux_rx_t *aux)
+{
+    gnrc_pktsnip_t *pkt;
+    ssize_t res;
+
+    assert((sock != NULL) && (data != NULL) && (buf_ctx != NULL));
+    if (*buf_ctx != NULL) {
+        *data = NULL;
+        gnrc_pktbuf_release(*buf_ctx);
+        *buf_ctx = NULL;
+        return 0;
+    }
+    res = gnrc_sock_udp_recv_pkt(sock, &pkt, timeout, remote, aux);
+    if (res < 0) {
+        return res;
+    }
     *data = pkt->data;
     *buf_ctx = pkt;
-    res = (int)pkt->size;
-    return res;
+    return pkt->size;
 }
 
-ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
-                           const iolist_t *snips,
-                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+/**
+ * @brief   Builds the UDP packet of a datagram to send
+ *
+ * @param[out] local    Local end point of the packet
+ * @param[out] rem      Remote end point of the packet
+ * @param[out] pkt      The UDP packet
+ */
+static int _udp_pkt_build(sock_udp_t *sock, const iolist_t *snips,
+                          const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux,
+                          sock_ip_ep_t *local, sock_udp_ep_t *rem,
+                          gnrc_pktsnip_t **pkt)
 {
     (void)aux;
-    int res;
-    gnrc_pktsnip_t *pkt, *payload = NULL;
+    gnrc_pktsnip_t *payload = NULL;
     uint16_t src_port = 0, dst_port;
-    sock_ip_ep_t local;
-    sock_udp_ep_t remote_cpy;
-    sock_ip_ep_t *rem;
 
     assert((sock != NULL) || (remote != NULL));
 
@@ -373,7 +392,7 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
      * cppcheck is being weird here anyways) */
     if ((sock == NULL) || (sock->local.family == AF_UNSPEC)) {
         /* no sock or sock currently unbound */
-        memset(&local, 0, sizeof(local));
+        memset(local, 0, sizeof(*local));
         if ((src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
             return -EADDRINUSE;
         }
@@ -399,34 +418,34 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
     }
     else {
         src_port = sock->local.port;
-        memcpy(&local, &sock->local, sizeof(local));
+        memcpy(local, &sock->local, sizeof(*local));
     }
 #if IS_USED(MODULE_SOCK_AUX_LOCAL)
     /* user supplied local endpoint takes precedent */
     if ((aux != NULL) && (aux->flags & SOCK_AUX_SET_LOCAL)) {
-        local.family = aux->local.family;
-        local.netif = aux->local.netif;
+        local->family = aux->local.family;
+        local->netif = aux->local.netif;
         src_port = aux->local.port;
-        memcpy(&local.addr, &aux->local.addr, sizeof(local.addr));
+        memcpy(&local->addr, &aux->local.addr, sizeof(local->addr));
 
         aux->flags &= ~SOCK_AUX_SET_LOCAL;
     }
 #endif
     /* sock can't be NULL at this point */
     if (remote == NULL) {
-        rem = (sock_ip_ep_t *)&sock->remote;
+        memcpy(rem, &sock->remote, sizeof(*rem));
         dst_port = sock->remote.port;
     }
     else {
-        rem = (sock_ip_ep_t *)&remote_cpy;
-        gnrc_ep_set(rem, (sock_ip_ep_t *)remote, sizeof(sock_udp_ep_t));
+        gnrc_ep_set((sock_ip_ep_t *)rem, (sock_ip_ep_t *)remote,
+                    sizeof(sock_udp_ep_t));
         dst_port = remote->port;
     }
     /* check for matching address families in local and remote */
-    if (local.family == AF_UNSPEC) {
-        local.family = rem->family;
+    if (local->family == AF_UNSPEC) {
+        local->family = rem->family;
     }
-    else if (local.family != rem->family) {
+    else if (local->family != rem->family) {
         return -EINVAL;
     }
 
@@ -439,12 +458,28 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
     /* copy payload data into payload snip */
     iolist_to_buffer(snips, payload->data, payload->size);
 
-    pkt = gnrc_udp_hdr_build(payload, src_port, dst_port);
-    if (pkt == NULL) {
+    *pkt = gnrc_udp_hdr_build(payload, src_port, dst_port);
+    if (*pkt == NULL) {
         gnrc_pktbuf_release(payload);
         return -ENOMEM;
     }
-    res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
+    return 0;
+}
+
+ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
+                           const iolist_t *snips,
+                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    int res;
+    gnrc_pktsnip_t *pkt;
+    sock_ip_ep_t local;
+    sock_udp_ep_t rem;
+
+    if ((res = _udp_pkt_build(sock, snips, remote, aux, &local, &rem,
+                              &pkt)) < 0) {
+        return res;
+    }
+    res = gnrc_sock_send(pkt, &local, (sock_ip_ep_t *)&rem, PROTNUM_UDP);
     if (res > 0) {
         res -= sizeof(udp_hdr_t);
     }
@@ -457,6 +492,94 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
     return res;
 }
 
+/* gnrc_neterr and gnrc_tx_sync follow a single packet down the stack, so
+ * with them the datagrams are sent one by one */
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH) && !IS_USED(MODULE_GNRC_NETERR) && \
+    !IS_USED(MODULE_GNRC_TX_SYNC)
+#define _SEND_BATCHED   1
+#else
+#define _SEND_BATCHED   0
+#endif
+
+#if _SEND_BATCHED
+/**
+ * @brief   Hands up to CONFIG_GNRC_SOCK_UDP_BATCH_SIZE datagrams down the
+ *          network stack in one message
+ *
+ * @return  Number of datagrams sent or error of the first datagram
+ */
+static ssize_t _send_batch(sock_udp_t *sock, const sock_udp_dgram_t *dgrams,
+                           unsigned num)
+{
+    gnrc_pktqueue_t nodes[CONFIG_GNRC_SOCK_UDP_BATCH_SIZE];
+    gnrc_pktqueue_t *batch = NULL;
+    int res = 0;
+    unsigned numof;
+
+    for (numof = 0; numof < num; numof++) {
+        sock_ip_ep_t local;
+        sock_udp_ep_t rem;
+        gnrc_pktsnip_t *pkt;
+        udp_hdr_t *hdr;
+
+        if ((res = _udp_pkt_build(sock, dgrams[numof].snips,
+                                  dgrams[numof].remote, NULL, &local, &rem,
+                                  &pkt)) < 0) {
+            break;
+        }
+        /* the UDP thread is skipped, so fill in the length here */
+        hdr = pkt->data;
+        hdr->length = byteorder_htons(gnrc_pkt_len(pkt));
+        if ((res = gnrc_sock_hdr_build(&pkt, &local, (sock_ip_ep_t *)&rem,
+                                       PROTNUM_UDP)) < 0) {
+            break;
+        }
+        nodes[numof].pkt = pkt;
+        nodes[numof].next = NULL;
+        gnrc_pktqueue_add(&batch, &nodes[numof]);
+    }
+    if ((batch != NULL) && ((numof = gnrc_sock_send_batch(batch)) == 0)) {
+        /* this should not happen, but just in case */
+        res = -EBADMSG;
+    }
+    return (numof > 0) ? (ssize_t)numof : res;
+}
+#endif
+
+ssize_t sock_udp_send_batch(sock_udp_t *sock, const sock_udp_dgram_t *dgrams,
+                            unsigned num)
+{
+    assert((dgrams != NULL) || (num == 0));
+#if _SEND_BATCHED
+    ssize_t res = 0;
+    unsigned numof = 0;
+
+    while (numof < num) {
+        unsigned chunk = num - numof;
+
+        if (chunk > CONFIG_GNRC_SOCK_UDP_BATCH_SIZE) {
+            chunk = CONFIG_GNRC_SOCK_UDP_BATCH_SIZE;
+        }
+        if ((res = _send_batch(sock, &dgrams[numof], chunk)) <= 0) {
+            break;
+        }
+        numof += res;
+        if ((unsigned)res < chunk) {
+            break;
+        }
+    }
+#ifdef SOCK_HAS_ASYNC
+    if ((numof > 0) && (sock != NULL) && (sock->reg.async_cb.udp)) {
+        sock->reg.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT,
+                               sock->reg.async_cb_arg);
+    }
+#endif
+    return (numof > 0) ? (ssize_t)numof : res;
+#else
+    return sock_udp_send_batch_each(sock, dgrams, num);
+#endif
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
@@ -0,0 +1,103 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/congure.h
+ * @}
+ */
+#include <stdint.h>
+
+#include "clist.h"
+#include "evtimer.h"
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (tcb->congure == NULL) {
+        tcb->congure = _gnrc_tcp_congure_snd_get(tcb);
+        if (tcb->congure == NULL) {
+            TCP_DEBUG_INFO("No CongURE state object available.");
+        }
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_congure_release(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (tcb->congure != NULL) {
+        /* Mark state object as free */
+        tcb->congure->driver = NULL;
+        tcb->congure = NULL;
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+uint32_t _gnrc_tcp_congure_get_wnd(const gnrc_tcp_tcb_t *tcb)
+{
+    return (tcb->congure != NULL) ? tcb->congure->cwnd : UINT32_MAX;
+}
+
+void _gnrc_tcp_congure_report_sent(gnrc_tcp_tcb_t *tcb, uint32_t len)
+{
+    if (tcb->congure != NULL) {
+        tcb->congure->driver->report_msg_sent(tcb->congure, len);
+    }
+}
+
+void _gnrc_tcp_congure_report_ack(gnrc_tcp_tcb_t *tcb, uint32_t seg_ack, uint32_t acked,
+                                  uint16_t seg_wnd, uint32_t pay_len, uint16_t ctl)
+{
+    TCP_DEBUG_ENTER;
+    if (tcb->congure == NULL) {
+        TCP_DEBUG_LEAVE;
+        return;
+    }
+    /* The acknowledged data is reported as a single message */
+    congure_snd_msg_t msg = {
+        .send_time = tcb->rtt_start,
+        .size = acked,
+        .resends = tcb->retries,
+    };
+    congure_snd_ack_t ack = {
+        .recv_time = evtimer_now_msec(),
+        .id = seg_ack,
+        .size = pay_len,
+        .wnd = seg_wnd,
+        .clean = !(ctl & (MSK_SYN | MSK_FIN)),
+    };
+
+    tcb->congure->driver->report_msg_acked(tcb->congure, &msg, &ack);
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_congure_report_timeout(gnrc_tcp_tcb_t *tcb, uint32_t in_flight)
+{
+    TCP_DEBUG_ENTER;
+    if (tcb->congure == NULL) {
+        TCP_DEBUG_LEAVE;
+        return;
+    }
+    /* Everything in flight is considered lost */
+    clist_node_t msgs = { .next = NULL };
+    congure_snd_msg_t msg = {
+        .send_time = tcb->rtt_start,
+        .size = in_flight,
+        .resends = tcb->retries,
+    };
+
+    clist_rpush(&msgs, &msg.super);
+    tcb->congure->driver->report_msgs_timeout(tcb->congure, (congure_snd_msg_t *)msgs.next);
+    TCP_DEBUG_LEAVE;
+}
@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       TCP Reno congestion control for GNRC TCP
+ * @}
+ */
+#include <stdbool.h>
+
+#include "congure/reno.h"
+#include "container.h"
+#include "net/gnrc/tcp/config.h"
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
+
+static void _fr(congure_reno_snd_t *c);
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack);
+
+static congure_reno_snd_t _tcp_congures[CONFIG_GNRC_TCP_SND_BUFFERS];
+static const congure_reno_snd_consts_t _tcp_congure_reno_consts = {
+    .fr = _fr,
+    .same_wnd_adv = _same_wnd_adv,
+    .init_mss = CONFIG_GNRC_TCP_MSS,
+    /* see https://tools.ietf.org/html/rfc5681#section-3.1 */
+    .cwnd_upper = 2190U,
+    .cwnd_lower = 1095U,
+    .init_ssthresh = CONGURE_WND_SIZE_MAX,
+    .frthresh = 3U,
+};
+
+congure_snd_t *_gnrc_tcp_congure_snd_get(gnrc_tcp_tcb_t *tcb)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_tcp_congures); i++) {
+        congure_reno_snd_t *c = &_tcp_congures[i];
+
+        if (c->super.driver == NULL) {
+            congure_reno_snd_setup(c, &_tcp_congure_reno_consts);
+            c->super.driver->init(&c->super, tcb);
+            /* Use the smaller MSS, if the peer announced one */
+            if (tcb->mss > 0 && tcb->mss < CONFIG_GNRC_TCP_MSS) {
+                congure_reno_set_mss(c, tcb->mss);
+            }
+            /* Acknowledgments are identified by their acknowledgment number,
+             * the greatest one received so far acknowledged our SYN */
+            c->last_ack = tcb->iss + 1;
+            return &c->super;
+        }
+    }
+    return NULL;
+}
+
+static void _fr(congure_reno_snd_t *c)
+{
+    gnrc_tcp_tcb_t *tcb = c->super.ctx;
+
+    /* Retransmit only when entering fast retransmit, not on every further
+     * duplicate ACK */
+    if (c->dup_acks == c->consts->frthresh) {
+        tcb->status |= STATUS_FAST_RETRANS;
+    }
+}
+
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack)
+{
+    gnrc_tcp_tcb_t *tcb = c->super.ctx;
+
+    return tcb->snd_wnd == ack->wnd;
+}
@@ -35,6 +35,7 @@
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_rcvbuf.h"
+#include "include/gnrc_tcp_sndbuf.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h" /* IWYU pragma: keep */
@@ -93,8 +94,8 @@ static void _close(gnrc_tcp_tcb_t *tcb)
     /* Setup connection timeout */
     _sched_connection_timeout(&tcb->event_misc, &mbox);
 
-    /* Start connection teardown sequence */
-    _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
+    /* Start connection teardown sequence, delayed until the send buffer is empty */
+    int ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
 
     /* Loop until the connection has been closed */
     state = _gnrc_tcp_fsm_get_state(tcb);
@@ -108,6 +109,11 @@ static void _close(gnrc_tcp_tcb_t *tcb)
 
             case MSG_TYPE_NOTIFY_USER:
                 TCP_DEBUG_INFO("Received MSG_TYPE_NOTIFY_USER.");
+
+                /* Retry teardown, data in the send buffer might be acknowledged */
+                if (ret == -EAGAIN) {
+                    ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
+                }
                 break;
 
             default:
@@ -292,8 +298,9 @@ int gnrc_tcp_ep_from_str(gnrc_tcp_ep_t *ep, const char *str)
 int gnrc_tcp_init(void)
 {
     TCP_DEBUG_ENTER;
-    /* Initialize receive buffers */
+    /* Initialize receive and send buffers */
     _gnrc_tcp_rcvbuf_init();
+    _gnrc_tcp_sndbuf_init();
 
     /* Initialize timers */
     evtimer_init_mbox(&_tcp_mbox_timer);
@@ -685,10 +692,7 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
     msg_t msg_queue[TCP_MSG_QUEUE_SIZE];
     mbox_t mbox = MBOX_INIT(msg_queue, TCP_MSG_QUEUE_SIZE);
     evtimer_mbox_event_t event_user_timeout;
-    evtimer_mbox_event_t event_probe_timeout;
-    uint32_t probe_timeout_duration_ms = 0;
     ssize_t ret = 0;
-    bool probing_mode = false;
     _gnrc_tcp_fsm_state_t state = 0;
 
     /* Lock the TCB for this function call */
@@ -710,7 +714,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         return 0;
     }
 
-    /* Setup messaging */
+    /* Setup messaging before the first attempt, an ACK freeing the send buffer
+     * must be able to notify this call */
     _gnrc_tcp_fsm_set_mbox(tcb, &mbox);
 
     /* Setup connection timeout */
@@ -721,33 +726,20 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                     MSG_TYPE_USER_SPEC_TIMEOUT, &mbox);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
-        state = _gnrc_tcp_fsm_get_state(tcb);
-
+    /* Loop until the send buffer had space for some data */
+    while (ret == 0) {
         /* Check if the connections state is closed. If so, a reset was received */
+        state = _gnrc_tcp_fsm_get_state(tcb);
         if (state == FSM_STATE_CLOSED) {
             TCP_DEBUG_ERROR("-ECONNRESET: Connection was reset by peer.");
             ret = -ECONNRESET;
             break;
         }
 
-        /* If the send window is closed: Setup Probing */
-        if (tcb->snd_wnd <= 0) {
-            /* If this is the first probe: Setup probing duration */
-            if (!probing_mode) {
-                probing_mode = true;
-                probe_timeout_duration_ms = tcb->rto;
-            }
-            /* Setup probe timeout */
-            _unsched_mbox(&event_probe_timeout);
-            _sched_mbox(&event_probe_timeout, probe_timeout_duration_ms,
-                        MSG_TYPE_PROBE_TIMEOUT, &mbox);
-        }
-
-        /* Try to send data in case there nothing has been sent and we are not probing */
-        if (ret == 0 && !probing_mode) {
-            ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+        /* Try to copy data into the send buffer */
+        ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+        if (ret != 0) {
+            break;
         }
 
         /* Wait for responses */
@@ -762,38 +754,16 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
 
             case MSG_TYPE_USER_SPEC_TIMEOUT:
                 TCP_DEBUG_INFO("Received MSG_TYPE_USER_SPEC_TIMEOUT.");
-                _gnrc_tcp_fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
                 TCP_DEBUG_ERROR("-ETIMEDOUT: User specified timeout expired.");
                 ret = -ETIMEDOUT;
                 break;
 
-            case MSG_TYPE_PROBE_TIMEOUT:
-                TCP_DEBUG_INFO("Received MSG_TYPE_PROBE_TIMEOUT.");
-                /* Send probe */
-                _gnrc_tcp_fsm(tcb, FSM_EVENT_SEND_PROBE, NULL, NULL, 0);
-                probe_timeout_duration_ms += probe_timeout_duration_ms;
-
-                /* Boundary check for time interval between probes */
-                if (probe_timeout_duration_ms < CONFIG_GNRC_TCP_PROBE_LOWER_BOUND_MS) {
-                    probe_timeout_duration_ms = CONFIG_GNRC_TCP_PROBE_LOWER_BOUND_MS;
-                }
-                else if (probe_timeout_duration_ms > CONFIG_GNRC_TCP_PROBE_UPPER_BOUND_MS) {
-                    probe_timeout_duration_ms = CONFIG_GNRC_TCP_PROBE_UPPER_BOUND_MS;
-                }
-                break;
-
             case MSG_TYPE_NOTIFY_USER:
                 TCP_DEBUG_INFO("Received MSG_TYPE_NOTIFY_USER.");
 
                 /* Connection is alive: Reset Connection Timeout */
                 _unsched_mbox(&tcb->event_misc);
                 _sched_connection_timeout(&tcb->event_misc, &mbox);
-
-                /* If the window re-opened and we are probing: Stop it */
-                if (tcb->snd_wnd > 0 && probing_mode) {
-                    probing_mode = false;
-                    _unsched_mbox(&event_probe_timeout);
-                }
                 break;
 
             default:
@@ -804,7 +774,6 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
     /* Cleanup */
     _gnrc_tcp_fsm_set_mbox(tcb, NULL);
     _unsched_mbox(&tcb->event_misc);
-    _unsched_mbox(&event_probe_timeout);
     _unsched_mbox(&event_user_timeout);
     mutex_unlock(&(tcb->function_lock));
     TCP_DEBUG_LEAVE;
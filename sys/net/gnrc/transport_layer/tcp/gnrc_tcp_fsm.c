@@ -25,10 +25,12 @@
 #include "evtimer.h"
 #include "evtimer_msg.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_option.h"
 #include "include/gnrc_tcp_rcvbuf.h"
+#include "include/gnrc_tcp_sndbuf.h"
 #include "include/gnrc_tcp_fsm.h"
 
 #ifdef MODULE_GNRC_IPV6
@@ -130,6 +132,208 @@ static int _restart_timewait_timer(gnrc_tcp_tcb_t *tcb)
     return 0;
 }
 
+/**
+ * @brief Sends a pure ACK.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _send_ack(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_pktsnip_t *out_pkt = NULL;
+    uint16_t seq_con = 0;
+    _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
+                        tcb->rcv_nxt, NULL, 0);
+    _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+    TCP_DEBUG_LEAVE;
+}
+
+/**
+ * @brief Get the size of the largest segment that can be sent.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   The segment size in bytes.
+ */
+static uint32_t _get_seg_size(const gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t seg_size = CONFIG_GNRC_TCP_MSS;
+
+    /* Use our own MSS, if the peer didn't announce a smaller one */
+    if (tcb->mss > 0 && tcb->mss < CONFIG_GNRC_TCP_MSS) {
+        seg_size = tcb->mss;
+    }
+#ifdef MODULE_GNRC_TCP_SACK
+    /* The MSS excludes options, leave room for the SACK option (see RFC 6691) */
+    uint8_t sack_len = _gnrc_tcp_option_sack_len(tcb);
+
+    if (seg_size > sack_len) {
+        seg_size -= sack_len;
+    }
+#endif
+    return seg_size;
+}
+
+/**
+ * @brief Sends data from the send buffer as far as the send window permits.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _send_data(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    /* Data is only sent in synchronized states before our FIN */
+    if ((tcb->state != FSM_STATE_ESTABLISHED && tcb->state != FSM_STATE_CLOSE_WAIT) ||
+        tcb->snd_buf_raw == NULL) {
+        TCP_DEBUG_LEAVE;
+        return;
+    }
+
+    /* The send window is open: Stop backing off window probes */
+    if (tcb->snd_wnd > 0) {
+        tcb->probe_timeout = 0;
+    }
+
+    uint32_t seg_size = _get_seg_size(tcb);
+    uint32_t in_flight = tcb->snd_nxt - tcb->snd_una;
+    uint32_t unsent = tcb->snd_buf.avail - in_flight;
+    uint32_t wnd = _gnrc_tcp_congure_get_wnd(tcb);
+
+    /* Data in flight is limited by the send and the congestion window */
+    wnd = (wnd < tcb->snd_wnd) ? wnd : tcb->snd_wnd;
+
+    /* No small segment can be outstanding if nothing is in flight */
+    if (in_flight == 0) {
+        tcb->snd_sml = tcb->snd_una;
+    }
+
+    while (unsent > 0 && in_flight < wnd) {
+        gnrc_pktsnip_t *out_pkt = NULL;
+        uint16_t seq_con = 0;
+
+        /* Calculate segment size */
+        uint32_t len = wnd - in_flight;
+        len = (len < seg_size) ? len : seg_size;
+        len = (len < unsent) ? len : unsent;
+
+        /* Nagle's algorithm (Minshall's variant): Hold back small segments while
+         * a previously sent small segment is unacknowledged */
+        if (!IS_ACTIVE(CONFIG_GNRC_TCP_NO_NAGLE) && len < seg_size &&
+            LSS_32_BIT(tcb->snd_una, tcb->snd_sml)) {
+            break;
+        }
+
+        if (_gnrc_tcp_pkt_build_data(tcb, &out_pkt, &seq_con, in_flight, len) < 0) {
+            break;
+        }
+        /* The first segment in flight starts the retransmission timer */
+        if (in_flight == 0) {
+            _gnrc_tcp_pkt_setup_retransmit_timer(tcb, false);
+        }
+        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+        _gnrc_tcp_congure_report_sent(tcb, len);
+        if (len < seg_size) {
+            tcb->snd_sml = tcb->snd_nxt;
+        }
+        in_flight += len;
+        unsent -= len;
+    }
+
+    /* Nothing could be sent: Try again after a timeout, probe the window if it is closed */
+    if (unsent > 0 && in_flight == 0) {
+        uint32_t timeout = (tcb->probe_timeout > 0) ? tcb->probe_timeout : (uint32_t)tcb->rto;
+
+        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+        _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, timeout,
+                                  MSG_TYPE_RETRANSMISSION, tcb);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+/**
+ * @brief Retransmits a segment from the send buffer.
+ *
+ * @param[in,out] tcb      TCB holding the connection information.
+ * @param[in]     offset   Offset of the segment, relative to tcb->snd_una.
+ * @param[in]     len      Length of the segment.
+ */
+static void _resend_data(gnrc_tcp_tcb_t *tcb, uint32_t offset, uint32_t len)
+{
+    gnrc_pktsnip_t *out_pkt = NULL;
+
+    if (_gnrc_tcp_pkt_build_data(tcb, &out_pkt, NULL, offset, len) == 0) {
+        _gnrc_tcp_pkt_send(tcb, out_pkt, 0, true);
+        _gnrc_tcp_congure_report_sent(tcb, len);
+    }
+}
+
+/**
+ * @brief Retransmits presumably lost data after duplicate acknowledgments.
+ *
+ * Without SACK, the oldest unacknowledged segment is retransmitted. With SACK,
+ * the holes below the highest selectively acknowledged block are retransmitted,
+ * as far as the congestion window permits next to the data still in flight.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _fast_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t seg_size = _get_seg_size(tcb);
+    uint32_t in_flight = tcb->snd_nxt - tcb->snd_una;
+    uint32_t len = (seg_size < in_flight) ? seg_size : in_flight;
+
+#ifdef MODULE_GNRC_TCP_SACK
+    const gnrc_tcp_sack_block_t *blocks = tcb->sack_blocks;
+    uint32_t wnd = _gnrc_tcp_congure_get_wnd(tcb);
+    uint32_t pipe = in_flight;
+    uint32_t budget = 0;
+    uint32_t resent = 0;
+    uint32_t pos = tcb->snd_una;
+
+    /* Selectively acknowledged data in flight has left the network */
+    for (unsigned i = 0; i < CONFIG_GNRC_TCP_SACK_BLOCKS; ++i) {
+        if (LEQ_32_BIT(blocks[i].end, tcb->snd_nxt)) {
+            pipe -= blocks[i].end - blocks[i].start;
+        }
+    }
+    if (wnd > pipe) {
+        budget = wnd - pipe;
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_TCP_SACK_BLOCKS; ++i) {
+        /* Blocks are sorted, empty ones are at the end */
+        if (blocks[i].start == blocks[i].end || LSS_32_BIT(tcb->snd_nxt, blocks[i].end)) {
+            break;
+        }
+        while (LSS_32_BIT(pos, blocks[i].start) && budget > 0) {
+            uint32_t hole = blocks[i].start - pos;
+
+            hole = (hole < seg_size) ? hole : seg_size;
+            hole = (hole < budget) ? hole : budget;
+            _resend_data(tcb, pos - tcb->snd_una, hole);
+            pos += hole;
+            budget -= hole;
+            resent += hole;
+        }
+        if (LSS_32_BIT(pos, blocks[i].end)) {
+            pos = blocks[i].end;
+        }
+    }
+    /* Some hole was retransmitted */
+    if (resent > 0) {
+        TCP_DEBUG_LEAVE;
+        return;
+    }
+    /* The first hole is retransmitted regardless of the window (see RFC 6675) */
+    if (blocks[0].start != blocks[0].end && LEQ_32_BIT(blocks[0].end, tcb->snd_nxt) &&
+        (blocks[0].start - tcb->snd_una) < len) {
+        len = blocks[0].start - tcb->snd_una;
+    }
+#endif
+    _resend_data(tcb, 0, len);
+    TCP_DEBUG_LEAVE;
+}
+
 /**
  * @brief Transition from current FSM state into another state.
  *
@@ -148,8 +352,18 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
 
     switch (state) {
         case FSM_STATE_CLOSED:
-            /* Clear retransmit queue */
+            /* Clear retransmit queue, send buffer and pending acknowledgments */
             _clear_retransmit(tcb);
+            _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+            _gnrc_tcp_eventloop_unsched(&tcb->event_ack);
+            ringbuffer_remove(&tcb->snd_buf, tcb->snd_buf.avail);
+            tcb->acks_pending = 0;
+            tcb->status &= ~(STATUS_RTT_PENDING | STATUS_FAST_RETRANS | STATUS_SACK_PERMITTED);
+            _gnrc_tcp_congure_release(tcb);
+#ifdef MODULE_GNRC_TCP_SACK
+            memset(tcb->sack_blocks, 0, sizeof(tcb->sack_blocks));
+            memset(&tcb->rcv_ooo, 0, sizeof(tcb->rcv_ooo));
+#endif
 
             /* Close connection if not listenng */
             if (!(tcb->status & STATUS_LISTENING))
@@ -159,8 +373,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
                 LL_DELETE(list->head, tcb);
                 mutex_unlock(&list->lock);
 
-                /* Free potentially allocated receive buffer */
+                /* Free potentially allocated receive and send buffer */
                 _gnrc_tcp_rcvbuf_release_buffer(tcb);
+                _gnrc_tcp_sndbuf_release_buffer(tcb);
                 TCP_DEBUG_INFO("Connection closed");
             }
             /* Re-open connection as listenng */
@@ -237,6 +452,7 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             if (tcb->status & STATUS_LISTENING) {
                 _gnrc_tcp_eventloop_unsched(&tcb->event_timeout);
             }
+            _gnrc_tcp_congure_init(tcb);
             tcb->status |= STATUS_NOTIFY_USER;
             break;
 
@@ -258,7 +474,7 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
  * @param[in,out] tcb   TCB holding the connection information.
  *
  * @returns   Zero on success.
- *            -ENOMEM if receive buffer could not be allocated.
+ *            -ENOMEM if receive or send buffer could not be allocated.
  *            -EADDRINUSE if given local port number is already in use.
  */
 static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
@@ -273,6 +489,14 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
         return -ENOMEM;
     }
 
+    /* Allocate send buffer */
+    if (_gnrc_tcp_sndbuf_get_buffer(tcb) == -ENOMEM) {
+        _gnrc_tcp_rcvbuf_release_buffer(tcb);
+        TCP_DEBUG_ERROR("-ENOMEM: Can't allocate send buffer.");
+        TCP_DEBUG_LEAVE;
+        return -ENOMEM;
+    }
+
     tcb->rcv_wnd = CONFIG_GNRC_TCP_DEFAULT_WINDOW;
 
     if (tcb->status & STATUS_LISTENING) {
@@ -283,6 +507,7 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
         /* Active Open, set TCB values, send SYN, T: CLOSED -> SYN_SENT */
         tcb->iss = random_uint32();
         tcb->snd_nxt = tcb->iss;
+        tcb->snd_max = tcb->iss;
         tcb->snd_una = tcb->iss;
 
         /* Transition FSM to SYN_SENT */
@@ -312,32 +537,16 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
  * @param[in,out] buf   Buffer containing data to send.
  * @param[in]     len   Maximum Number of Bytes to send from @p buf.
  *
- * @returns   Number of successfully transmitted bytes.
+ * @returns   Number of bytes copied into the send buffer.
  */
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
-
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
-        /* Calculate segment size */
-        payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
-
-        /* Calculate payload size for this segment */
-        gnrc_pktsnip_t *out_pkt = NULL;
-        uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
-                            tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
-        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
-        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
-        TCP_DEBUG_LEAVE;
-        return payload;
-    }
+    /* Copy as much data into the send buffer as fits, send it if the window permits */
+    int ret = ringbuffer_add(&tcb->snd_buf, buf, len);
+    _send_data(tcb);
     TCP_DEBUG_LEAVE;
-    return 0;
+    return ret;
 }
 
 /**
@@ -382,11 +591,19 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
  * @param[in,out] tcb   TCB holding the connection information.
  *
  * @returns   Zero on success.
+ *            -EAGAIN if the send buffer holds data that was not acknowledged yet.
  */
 static int _fsm_call_close(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
 
+    /* FIN follows after all data in the send buffer was acknowledged */
+    if ((tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_CLOSE_WAIT) &&
+        !ringbuffer_empty(&tcb->snd_buf)) {
+        TCP_DEBUG_LEAVE;
+        return -EAGAIN;
+    }
+
     if (tcb->state == FSM_STATE_SYN_RCVD || tcb->state == FSM_STATE_ESTABLISHED ||
         tcb->state == FSM_STATE_CLOSE_WAIT) {
 
@@ -572,6 +789,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             tcb->iss = random_uint32();
             tcb->snd_una = tcb->iss;
             tcb->snd_nxt = tcb->iss;
+            tcb->snd_max = tcb->iss;
             tcb->snd_wnd = seg_wnd;
 
             /* Send SYN+ACK: seq_no = iss, ack_no = rcv_nxt, T: LISTEN -> SYN_RCVD */
@@ -614,8 +832,8 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             tcb->rcv_nxt = seg_seq + 1;
             tcb->irs = seg_seq;
             if (ctl & MSK_ACK) {
-                tcb->snd_una = seg_ack;
                 _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+                tcb->snd_una = seg_ack;
             }
             /* Set local network layer address accordingly */
 #ifdef MODULE_GNRC_IPV6
@@ -654,6 +872,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     else {
         uint32_t seg_len = _gnrc_tcp_pkt_get_seg_len(in_pkt);
         uint32_t pay_len = _gnrc_tcp_pkt_get_pay_len(in_pkt);
+        bool delay_ack = false;
         /* 1) Verify sequence number ... */
         if (_gnrc_tcp_pkt_chk_seq_num(tcb, seg_seq, pay_len)) {
             /* ... if invalid, and RST not set, reply with pure ACK, return */
@@ -694,7 +913,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
         }
         else {
             if (tcb->state == FSM_STATE_SYN_RCVD) {
-                if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_max)) {
                     tcb->snd_wnd = seg_wnd;
                     tcb->snd_wl1 = seg_seq;
                     tcb->snd_wl2 = seg_ack;
@@ -711,12 +930,32 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_FIN_WAIT_2 || tcb->state == FSM_STATE_CLOSE_WAIT ||
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
                 /* Acknowledge previously sent data */
-                if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
-                    tcb->snd_una = seg_ack;
+                if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_max)) {
+                    if (tcb->pkt_retransmit == NULL && tcb->snd_buf_raw != NULL) {
+                        /* Only data sent since the last retransmission timeout is in flight */
+                        uint32_t acked = LSS_32_BIT(seg_ack, tcb->snd_nxt) ? seg_ack
+                                                                           : tcb->snd_nxt;
+
+                        _gnrc_tcp_congure_report_ack(tcb, seg_ack, acked - tcb->snd_una,
+                                                     seg_wnd, pay_len, ctl);
+                    }
                     _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+                    tcb->snd_una = seg_ack;
+                    if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
+                        tcb->snd_nxt = seg_ack;
+                    }
+                }
+                /* Possibly a duplicate ACK, congestion control decides */
+                else if (seg_ack == tcb->snd_una && tcb->pkt_retransmit == NULL &&
+                         tcb->snd_buf_raw != NULL) {
+                    _gnrc_tcp_congure_report_ack(tcb, seg_ack, 0, seg_wnd, pay_len, ctl);
+                    if (tcb->status & STATUS_FAST_RETRANS) {
+                        tcb->status &= ~STATUS_FAST_RETRANS;
+                        _fast_retransmit(tcb);
+                    }
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
-                else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
+                else if (LSS_32_BIT(tcb->snd_max, seg_ack)) {
                     _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK,
                                         tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
                     _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
@@ -724,7 +963,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                     return 0;
                 }
                 /* Update receive window */
-                if (LEQ_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                if (LEQ_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_max)) {
                     if (LSS_32_BIT(tcb->snd_wl1, seg_seq) || (tcb->snd_wl1 == seg_seq &&
                         LEQ_32_BIT(tcb->snd_wl2, seg_ack))) {
                         tcb->snd_wnd = seg_wnd;
@@ -782,20 +1021,49 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                         tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
                         snp = snp->next;
                     }
+                    /* ACK can be delayed, if all data fit into the receive buffer */
+                    delay_ack = (tcb->rcv_nxt == seg_seq + pay_len);
+#ifdef MODULE_GNRC_TCP_SACK
+                    /* Append out-of-order data, if the gap in front of it was filled.
+                     * ACK immediately while there is a gap (see RFC 5681). */
+                    if (_gnrc_tcp_rcvbuf_append_ooo(tcb)) {
+                        delay_ack = false;
+                    }
+#endif
                     /* Shrink receive window */
                     tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
                     /* Notify owner because new data is available */
                     tcb->status |= STATUS_NOTIFY_USER;
                 }
+#ifdef MODULE_GNRC_TCP_SACK
+                /* Hold out-of-order data and report it to the peer */
+                else if (LSS_32_BIT(tcb->rcv_nxt, seg_seq)) {
+                    _gnrc_tcp_rcvbuf_store_ooo(tcb, snp, seg_seq, pay_len);
+                }
+#endif
                 /* Send ACK, if FIN processing sends ACK already */
-                /* NOTE: this is the place to add payload piggybagging in the future */
                 if (!(ctl & MSK_FIN)) {
-                    _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK,
-                                        tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
-                    _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+                    if (delay_ack) {
+                        tcb->acks_pending += 1;
+                    }
+                    else {
+                        _send_ack(tcb);
+                    }
                 }
             }
         }
+        /* Send buffered data, pending ACKs are piggybacked */
+        _send_data(tcb);
+
+        /* ACK every second segment immediately, otherwise delay ACK (see RFC 1122) */
+        if (tcb->acks_pending >= 2 ||
+            (tcb->acks_pending > 0 && CONFIG_GNRC_TCP_DELAYED_ACK_MS == 0)) {
+            _send_ack(tcb);
+        }
+        else if (tcb->acks_pending > 0 && delay_ack) {
+            _gnrc_tcp_eventloop_sched(&tcb->event_ack, CONFIG_GNRC_TCP_DELAYED_ACK_MS,
+                                      MSG_TYPE_DELAYED_ACK, tcb);
+        }
         /* 7) Check FIN */
         if (ctl & MSK_FIN) {
             if (tcb->state == FSM_STATE_CLOSED || tcb->state == FSM_STATE_LISTEN ||
@@ -847,6 +1115,27 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
     return 0;
 }
 
+/**
+ * @brief FSM handling function for probe sending.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   Zero on success.
+ */
+static int _fsm_send_probe(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_pktsnip_t *out_pkt = NULL;  /* Outgoing packet */
+    uint8_t probe_pay[] = {1};       /* Probe payload */
+
+    /* The probe sends a already acknowledged sequence no. with a garbage byte. */
+    _gnrc_tcp_pkt_build(tcb, &out_pkt, NULL, MSK_ACK, tcb->snd_una - 1,
+                        tcb->rcv_nxt, probe_pay, sizeof(probe_pay));
+    _gnrc_tcp_pkt_send(tcb, out_pkt, 0, false);
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
 /**
  * @brief FSM handling function for retransmissions.
  *
@@ -857,10 +1146,49 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
+    uint32_t in_flight = tcb->snd_nxt - tcb->snd_una;
+
     if (tcb->pkt_retransmit != NULL) {
         _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
         _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
     }
+    /* All data in flight is considered lost: Go back to the oldest unacknowledged
+     * segment, the remaining data is sent again as acknowledgments arrive */
+    else if (tcb->snd_buf_raw != NULL && in_flight > 0) {
+        gnrc_pktsnip_t *out_pkt = NULL;
+        uint32_t len = _get_seg_size(tcb);
+
+        len = (len < in_flight) ? len : in_flight;
+        _gnrc_tcp_congure_report_timeout(tcb, in_flight);
+        _gnrc_tcp_pkt_setup_retransmit_timer(tcb, true);
+        tcb->snd_nxt = tcb->snd_una;
+        if (_gnrc_tcp_pkt_build_data(tcb, &out_pkt, NULL, 0, len) == 0) {
+            _gnrc_tcp_pkt_send(tcb, out_pkt, 0, true);
+            tcb->snd_nxt += len;
+            _gnrc_tcp_congure_report_sent(tcb, len);
+        }
+    }
+    /* Send window is closed: Probe it and double the duration until the next probe.
+     * Probes are no retransmissions, they neither count as retries nor change the RTO. */
+    else if (!ringbuffer_empty(&tcb->snd_buf) && tcb->snd_wnd == 0) {
+        _fsm_send_probe(tcb);
+        if (tcb->probe_timeout == 0) {
+            tcb->probe_timeout = tcb->rto;
+        }
+        tcb->probe_timeout *= 2;
+        if (tcb->probe_timeout < CONFIG_GNRC_TCP_PROBE_LOWER_BOUND_MS) {
+            tcb->probe_timeout = CONFIG_GNRC_TCP_PROBE_LOWER_BOUND_MS;
+        }
+        else if (tcb->probe_timeout > CONFIG_GNRC_TCP_PROBE_UPPER_BOUND_MS) {
+            tcb->probe_timeout = CONFIG_GNRC_TCP_PROBE_UPPER_BOUND_MS;
+        }
+        _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->probe_timeout,
+                                  MSG_TYPE_RETRANSMISSION, tcb);
+    }
+    /* Sending from the send buffer failed before: Try again */
+    else if (!ringbuffer_empty(&tcb->snd_buf)) {
+        _send_data(tcb);
+    }
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
     }
@@ -869,37 +1197,33 @@ static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 }
 
 /**
- * @brief FSM handling function for connection timeout handling.
+ * @brief FSM handling function for delayed acknowledgments.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  *
  * @returns   Zero on success.
  */
-static int _fsm_timeout_connection(gnrc_tcp_tcb_t *tcb)
+static int _fsm_timeout_delayed_ack(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    _transition_to(tcb, FSM_STATE_CLOSED);
+    if (tcb->acks_pending > 0) {
+        _send_ack(tcb);
+    }
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
 /**
- * @brief FSM handling function for probe sending.
+ * @brief FSM handling function for connection timeout handling.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  *
  * @returns   Zero on success.
  */
-static int _fsm_send_probe(gnrc_tcp_tcb_t *tcb)
+static int _fsm_timeout_connection(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    gnrc_pktsnip_t *out_pkt = NULL;  /* Outgoing packet */
-    uint8_t probe_pay[] = {1};       /* Probe payload */
-
-    /* The probe sends a already acknowledged sequence no. with a garbage byte. */
-    _gnrc_tcp_pkt_build(tcb, &out_pkt, NULL, MSK_ACK, tcb->snd_una - 1,
-                        tcb->rcv_nxt, probe_pay, sizeof(probe_pay));
-    _gnrc_tcp_pkt_send(tcb, out_pkt, 0, false);
+    _transition_to(tcb, FSM_STATE_CLOSED);
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -967,8 +1291,8 @@ static int _fsm_unprotected(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
         case FSM_EVENT_TIMEOUT_CONNECTION :
             ret = _fsm_timeout_connection(tcb);
             break;
-        case FSM_EVENT_SEND_PROBE :
-            ret = _fsm_send_probe(tcb);
+        case FSM_EVENT_TIMEOUT_DELAYED_ACK :
+            ret = _fsm_timeout_delayed_ack(tcb);
             break;
         case FSM_EVENT_CLEAR_RETRANSMIT :
             ret = _fsm_clear_retransmit(tcb);
@@ -16,15 +16,93 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  * @}
  */
+#include <string.h>
+
+#include "byteorder.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_option.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#ifdef MODULE_GNRC_TCP_SACK
+/**
+ * @brief Store the valid blocks of a SACK option in ascending order.
+ *
+ * @param[in,out] tcb      TCB holding the connection information.
+ * @param[in]     option   SACK option to parse.
+ */
+static void _parse_sack(gnrc_tcp_tcb_t *tcb, const tcp_hdr_opt_t *option)
+{
+    gnrc_tcp_sack_block_t *blocks = tcb->sack_blocks;
+    unsigned nblocks = (option->length - 2) / TCP_OPTION_LENGTH_SACK_BLOCK;
+
+    for (unsigned i = 0; i < nblocks; ++i) {
+        const uint8_t *val = &option->value[i * TCP_OPTION_LENGTH_SACK_BLOCK];
+        uint32_t start = byteorder_bebuftohl(val);
+        uint32_t end = byteorder_bebuftohl(val + 4);
+
+        /* Ignore blocks that are not inside the data in flight */
+        if (!LSS_32_BIT(tcb->snd_una, start) || !LSS_32_BIT(start, end) ||
+            !LEQ_32_BIT(end, tcb->snd_max)) {
+            continue;
+        }
+
+        /* Insertion sort, the first blocks are the most recent ones and are kept */
+        unsigned pos = CONFIG_GNRC_TCP_SACK_BLOCKS;
+        for (unsigned j = 0; j < CONFIG_GNRC_TCP_SACK_BLOCKS; ++j) {
+            if (blocks[j].start == blocks[j].end || LSS_32_BIT(start, blocks[j].start)) {
+                pos = j;
+                break;
+            }
+        }
+        if (pos == CONFIG_GNRC_TCP_SACK_BLOCKS) {
+            continue;
+        }
+        if (blocks[CONFIG_GNRC_TCP_SACK_BLOCKS - 1].start !=
+            blocks[CONFIG_GNRC_TCP_SACK_BLOCKS - 1].end) {
+            /* Scoreboard is full, drop the new block */
+            continue;
+        }
+        for (unsigned j = CONFIG_GNRC_TCP_SACK_BLOCKS - 1; j > pos; --j) {
+            blocks[j] = blocks[j - 1];
+        }
+        blocks[pos].start = start;
+        blocks[pos].end = end;
+    }
+}
+
+uint8_t _gnrc_tcp_option_sack_len(const gnrc_tcp_tcb_t *tcb)
+{
+    if (!(tcb->status & STATUS_SACK_PERMITTED) || tcb->rcv_ooo.start == tcb->rcv_ooo.end) {
+        return 0;
+    }
+    /* Two NOPs, kind, length and a single block */
+    return 4 + TCP_OPTION_LENGTH_SACK_BLOCK;
+}
+
+void _gnrc_tcp_option_build_sack(const gnrc_tcp_tcb_t *tcb, uint8_t *opt_ptr)
+{
+    opt_ptr[0] = TCP_OPTION_KIND_NOP;
+    opt_ptr[1] = TCP_OPTION_KIND_NOP;
+    opt_ptr[2] = TCP_OPTION_KIND_SACK;
+    opt_ptr[3] = 2 + TCP_OPTION_LENGTH_SACK_BLOCK;
+    byteorder_htobebufl(&opt_ptr[4], tcb->rcv_ooo.start);
+    byteorder_htobebufl(&opt_ptr[8], tcb->rcv_ooo.end);
+}
+#endif
+
 int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
 {
     TCP_DEBUG_ENTER;
+#ifdef MODULE_GNRC_TCP_SACK
+    /* SACK information is only valid for the segment it was received with */
+    memset(tcb->sack_blocks, 0, sizeof(tcb->sack_blocks));
+    if (byteorder_ntohs(hdr->off_ctl) & MSK_SYN) {
+        tcb->status &= ~STATUS_SACK_PERMITTED;
+    }
+#endif
+
     /* Extract offset value. Return if no options are set */
     uint8_t offset = GET_OFFSET(byteorder_ntohs(hdr->off_ctl));
     if (offset <= TCP_HDR_OFFSET_MIN) {
@@ -64,6 +142,33 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                 tcb->mss = (option->value[0] << 8) | option->value[1];
                 break;
 
+#ifdef MODULE_GNRC_TCP_SACK
+            case TCP_OPTION_KIND_SACK_PERMITTED:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_SACK_PERMITTED) {
+                    TCP_DEBUG_ERROR("Invalid SACK permitted option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK permitted option found.");
+                if (byteorder_ntohs(hdr->off_ctl) & MSK_SYN) {
+                    tcb->status |= STATUS_SACK_PERMITTED;
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length < 2 + TCP_OPTION_LENGTH_SACK_BLOCK ||
+                    (option->length - 2) % TCP_OPTION_LENGTH_SACK_BLOCK != 0) {
+                    TCP_DEBUG_ERROR("Invalid SACK option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK option found.");
+                _parse_sack(tcb, option);
+                break;
+#endif
+
             default:
                 if (opt_left >= TCP_OPTION_LENGTH_MIN) {
                     TCP_DEBUG_INFO("Valid, unsupported option found.");
@@ -28,6 +28,7 @@
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_option.h"
 #include "include/gnrc_tcp_pkt.h"
+#include "include/gnrc_tcp_sndbuf.h"
 
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
@@ -145,27 +146,30 @@ int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
     return 0;
 }
 
-int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
-                        uint16_t *seq_con, const uint16_t ctl,
-                        const uint32_t seq_num, const uint32_t ack_num,
-                        void *payload, const size_t payload_len)
+/**
+ * @brief Build a TCP packet around an already allocated payload.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[out]    out_pkt   Pointer to packet to build.
+ * @param[out]    seq_con   Sequence number consumption of built packet.
+ * @param[in]     ctl       Control bits to set in @p out_pkt.
+ * @param[in]     seq_num   Sequence number of the new packet.
+ * @param[in]     ack_num   Acknowledgment number of the new packet.
+ * @param[in]     pay_snp   Payload of the new packet, may be NULL. Released on error.
+ *
+ * @returns   Zero on success.
+ *            -ENOMEM if pktbuf is full.
+ */
+static int _build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
+                  uint16_t *seq_con, const uint16_t ctl,
+                  const uint32_t seq_num, const uint32_t ack_num,
+                  gnrc_pktsnip_t *pay_snp)
 {
     TCP_DEBUG_ENTER;
-    gnrc_pktsnip_t *pay_snp = NULL;
     gnrc_pktsnip_t *tcp_snp = NULL;
     tcp_hdr_t tcp_hdr;
     uint8_t offset = TCP_HDR_OFFSET_MIN;
-
-    /* Add payload, if supplied */
-    if (payload != NULL && payload_len > 0) {
-        pay_snp = gnrc_pktbuf_add(pay_snp, payload, payload_len, GNRC_NETTYPE_UNDEF);
-        if (pay_snp == NULL) {
-            *(out_pkt) = NULL;
-            TCP_DEBUG_ERROR("-ENOMEM: Can't alloc buffer for payload.");
-            TCP_DEBUG_LEAVE;
-            return -ENOMEM;
-        }
-    }
+    size_t payload_len = gnrc_pkt_len(pay_snp);
 
     /* Fill TCP header */
     tcp_hdr.src_port = byteorder_htons(tcb->local_port);
@@ -181,6 +185,21 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     if (ctl & MSK_SYN) {
         offset += 1;
     }
+#ifdef MODULE_GNRC_TCP_SACK
+    /* Permit SACK on an active open or if the peer permitted it */
+    bool sack_permitted = (ctl & MSK_SYN) &&
+                          (!(ctl & MSK_ACK) || (tcb->status & STATUS_SACK_PERMITTED));
+    uint8_t sack_len = 0;
+
+    if (sack_permitted) {
+        offset += 1;
+    }
+    /* Add SACK option if out-of-order data was received */
+    else if ((ctl & MSK_ACK) && !(ctl & (MSK_SYN | MSK_RST))) {
+        sack_len = _gnrc_tcp_option_sack_len(tcb);
+        offset += sack_len / sizeof(network_uint32_t);
+    }
+#endif
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(
         _gnrc_tcp_option_build_offset_control(offset, ctl));
@@ -217,9 +236,21 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                     _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
 
                 memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                opt_ptr += sizeof(mss_option);
             }
             /* Increase opt_ptr and decrease opt_left, if other options are added */
             /* NOTE: Add additional options here */
+#ifdef MODULE_GNRC_TCP_SACK
+            if (sack_permitted) {
+                network_uint32_t sack_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_sack_permitted());
+
+                memcpy(opt_ptr, &sack_option, sizeof(sack_option));
+            }
+            else if (sack_len > 0) {
+                _gnrc_tcp_option_build_sack(tcb, opt_ptr);
+            }
+#endif
         }
         *(out_pkt) = tcp_snp;
     }
@@ -275,6 +306,56 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     return 0;
 }
 
+int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
+                        uint16_t *seq_con, const uint16_t ctl,
+                        const uint32_t seq_num, const uint32_t ack_num,
+                        void *payload, const size_t payload_len)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_pktsnip_t *pay_snp = NULL;
+
+    /* Add payload, if supplied */
+    if (payload != NULL && payload_len > 0) {
+        pay_snp = gnrc_pktbuf_add(pay_snp, payload, payload_len, GNRC_NETTYPE_UNDEF);
+        if (pay_snp == NULL) {
+            *(out_pkt) = NULL;
+            TCP_DEBUG_ERROR("-ENOMEM: Can't alloc buffer for payload.");
+            TCP_DEBUG_LEAVE;
+            return -ENOMEM;
+        }
+    }
+    int res = _build(tcb, out_pkt, seq_con, ctl, seq_num, ack_num, pay_snp);
+    TCP_DEBUG_LEAVE;
+    return res;
+}
+
+int _gnrc_tcp_pkt_build_data(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
+                             uint16_t *seq_con, const size_t offset,
+                             const size_t len)
+{
+    TCP_DEBUG_ENTER;
+    uint16_t ctl = MSK_ACK;
+
+    /* Copy the payload straight from the send buffer into the packet buffer */
+    gnrc_pktsnip_t *pay_snp = gnrc_pktbuf_add(NULL, NULL, len, GNRC_NETTYPE_UNDEF);
+    if (pay_snp == NULL) {
+        *(out_pkt) = NULL;
+        TCP_DEBUG_ERROR("-ENOMEM: Can't alloc buffer for payload.");
+        TCP_DEBUG_LEAVE;
+        return -ENOMEM;
+    }
+    _gnrc_tcp_sndbuf_read(tcb, offset, pay_snp->data, len);
+
+    /* Push, if this segment empties the send buffer */
+    if (offset + len == tcb->snd_buf.avail) {
+        ctl |= MSK_PSH;
+    }
+    int res = _build(tcb, out_pkt, seq_con, ctl, tcb->snd_una + offset,
+                     tcb->rcv_nxt, pay_snp);
+    TCP_DEBUG_LEAVE;
+    return res;
+}
+
 int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
                        const uint16_t seq_con, const bool retransmit)
 {
@@ -285,16 +366,33 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
         return -EINVAL;
     }
 
-    /* If this is no retransmission, advance sequence number and measure time */
+    /* If this is no retransmission, advance sequence number and measure time.
+     * Only one segment at a time is timed for rtt estimation, data sent again
+     * after a retransmission timeout is not timed. */
     if (!retransmit) {
-        tcb->retries = 0;
+        if (seq_con > 0 && !(tcb->status & STATUS_RTT_PENDING) &&
+            tcb->snd_nxt == tcb->snd_max) {
+            tcb->status |= STATUS_RTT_PENDING;
+            tcb->rtt_start = evtimer_now_msec();
+            tcb->rtt_seq = tcb->snd_nxt + seq_con;
+        }
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
+        if (LSS_32_BIT(tcb->snd_max, tcb->snd_nxt)) {
+            tcb->snd_max = tcb->snd_nxt;
+        }
     }
+    /* Do not measure time if a segment was retransmitted (Karns Algorithm) */
     else {
+        tcb->status &= ~STATUS_RTT_PENDING;
         tcb->retries += 1;
     }
 
+    /* Every segment acknowledges all data received so far */
+    if (tcb->acks_pending > 0) {
+        tcb->acks_pending = 0;
+        _gnrc_tcp_eventloop_unsched(&tcb->event_ack);
+    }
+
     /* Pass packet down the network stack */
     if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_TCP, GNRC_NETREG_DEMUX_CTX_ALL,
                                    out_pkt)) {
@@ -419,6 +517,14 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
     tcb->pkt_retransmit = pkt;
     gnrc_pktbuf_hold(pkt, 1);
 
+    _gnrc_tcp_pkt_setup_retransmit_timer(tcb, retransmit);
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+void _gnrc_tcp_pkt_setup_retransmit_timer(gnrc_tcp_tcb_t *tcb, const bool retransmit)
+{
+    TCP_DEBUG_ENTER;
     /* RTO adjustment */
     if (!retransmit) {
         /* If this is the first transmission: rto is 1 sec (Lower Bound) */
@@ -451,10 +557,44 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
     }
 
     /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
     _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
                               MSG_TYPE_RETRANSMISSION, tcb);
     TCP_DEBUG_LEAVE;
-    return 0;
+}
+
+/**
+ * @brief Updates the round trip time estimation.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     ack   Acknowledgment number of the received segment.
+ */
+static void _update_rtt(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
+{
+    /* Use time only if the timed segment was acknowledged */
+    if (!(tcb->status & STATUS_RTT_PENDING) || LSS_32_BIT(ack, tcb->rtt_seq)) {
+        return;
+    }
+    tcb->status &= ~STATUS_RTT_PENDING;
+
+    /* Measure round trip time */
+    int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
+
+    /* Use time only if there was no timer overflow */
+    if (rtt > 0) {
+        /* If this is the first sample taken */
+        if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
+            tcb->srtt = rtt;
+            tcb->rtt_var = (rtt >> 1);
+        }
+        /* If this is a subsequent sample */
+        else {
+            tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
+            tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
+            tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
+            tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
+        }
+    }
 }
 
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
@@ -464,11 +604,29 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
     gnrc_pktsnip_t *snp = NULL;
     tcp_hdr_t *hdr;
 
-    /* Retransmission queue is empty. Nothing to ACK there */
+    /* Retransmission queue is empty: Acknowledge data in the send buffer */
     if (tcb->pkt_retransmit == NULL) {
-        TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
+        if (tcb->snd_buf_raw == NULL || LEQ_32_BIT(ack, tcb->snd_una)) {
+            TCP_DEBUG_ERROR("-ENODATA: No data to acknowledge.");
+            TCP_DEBUG_LEAVE;
+            return -ENODATA;
+        }
+        ringbuffer_remove(&tcb->snd_buf, ack - tcb->snd_una);
+        tcb->retries = 0;
+        _update_rtt(tcb, ack);
+
+        /* Stop timer if everything was acknowledged, restart it otherwise */
+        if (LEQ_32_BIT(tcb->snd_max, ack)) {
+            _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+        }
+        else {
+            _gnrc_tcp_pkt_setup_retransmit_timer(tcb, false);
+        }
+
+        /* Signal user that there is space in the send buffer */
+        tcb->status |= STATUS_NOTIFY_USER;
         TCP_DEBUG_LEAVE;
-        return -ENODATA;
+        return 0;
     }
 
     snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
@@ -484,30 +642,13 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
     seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
         tcb->pkt_retransmit) - 1;
 
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
+    /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
     if (LSS_32_BIT(seg, ack)) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
         gnrc_pktbuf_release(tcb->pkt_retransmit);
         tcb->pkt_retransmit = NULL;
-
-        /* Measure round trip time */
-        int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
-
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
-            /* If this is the first sample taken */
-            if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
-                tcb->srtt = rtt;
-                tcb->rtt_var = (rtt >> 1);
-            }
-            /* If this is a subsequent sample */
-            else {
-                tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
-                tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
-                tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
-                tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
-            }
-        }
+        tcb->retries = 0;
+        _update_rtt(tcb, ack);
     }
     TCP_DEBUG_LEAVE;
     return 0;
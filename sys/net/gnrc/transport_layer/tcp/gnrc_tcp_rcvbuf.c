@@ -15,9 +15,11 @@
  *
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
+#include <assert.h>
 #include <errno.h>
 #include <mutex.h>
 #include <stdint.h>
+#include <string.h>
 #include "net/gnrc/tcp/config.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_rcvbuf.h"
@@ -124,3 +126,89 @@ void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
     }
     TCP_DEBUG_LEAVE;
 }
+
+#ifdef MODULE_GNRC_TCP_SACK
+/**
+ * @brief Copy data into the free space of the receive buffer without adding it.
+ *
+ * @pre @p offset + @p len does not exceed the free space of the receive buffer.
+ *
+ * @param[in,out] rb       Receive buffer.
+ * @param[in]     offset   Offset of the first byte to write, relative to the end of the data.
+ * @param[in]     buf      Data to copy.
+ * @param[in]     len      Number of bytes to copy.
+ */
+static void _write_ahead(ringbuffer_t *rb, size_t offset, const void *buf, size_t len)
+{
+    assert(offset + len <= ringbuffer_get_free(rb));
+
+    /* The free space wraps around the end of the buffer at most once */
+    size_t start = (rb->start + rb->avail + offset) % rb->size;
+    size_t part = rb->size - start;
+
+    if (part >= len) {
+        memcpy(&rb->buf[start], buf, len);
+    }
+    else {
+        memcpy(&rb->buf[start], buf, part);
+        memcpy(rb->buf, (const uint8_t *)buf + part, len - part);
+    }
+}
+
+void _gnrc_tcp_rcvbuf_store_ooo(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *snp, uint32_t seg_seq,
+                                uint32_t pay_len)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_tcp_sack_block_t *ooo = &tcb->rcv_ooo;
+    uint32_t seg_end = seg_seq + pay_len;
+
+    /* Data must fit into the receive buffer */
+    if ((seg_end - tcb->rcv_nxt) > ringbuffer_get_free(&tcb->rcv_buf)) {
+        TCP_DEBUG_LEAVE;
+        return;
+    }
+    if (ooo->start == ooo->end) {
+        ooo->start = seg_seq;
+        ooo->end = seg_end;
+    }
+    else if (LEQ_32_BIT(seg_seq, ooo->end) && LEQ_32_BIT(ooo->start, seg_end)) {
+        ooo->start = LSS_32_BIT(seg_seq, ooo->start) ? seg_seq : ooo->start;
+        ooo->end = LSS_32_BIT(ooo->end, seg_end) ? seg_end : ooo->end;
+    }
+    else {
+        TCP_DEBUG_LEAVE;
+        return;
+    }
+
+    /* Copy payload behind the gap */
+    uint32_t offset = seg_seq - tcb->rcv_nxt;
+    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
+        _write_ahead(&tcb->rcv_buf, offset, snp->data, snp->size);
+        offset += snp->size;
+        snp = snp->next;
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+bool _gnrc_tcp_rcvbuf_append_ooo(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_tcp_sack_block_t *ooo = &tcb->rcv_ooo;
+
+    if (ooo->start == ooo->end) {
+        TCP_DEBUG_LEAVE;
+        return false;
+    }
+    if (LEQ_32_BIT(ooo->start, tcb->rcv_nxt)) {
+        /* The held data is already in place behind the received data, the
+         * ring buffer only needs to take it over */
+        if (LSS_32_BIT(tcb->rcv_nxt, ooo->end)) {
+            tcb->rcv_buf.avail += ooo->end - tcb->rcv_nxt;
+            tcb->rcv_nxt = ooo->end;
+        }
+        ooo->start = ooo->end;
+    }
+    TCP_DEBUG_LEAVE;
+    return true;
+}
+#endif
@@ -0,0 +1,143 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/sndbuf.h
+ * @}
+ */
+#include <assert.h>
+#include <errno.h>
+#include <mutex.h>
+#include <stdint.h>
+#include <string.h>
+#include "net/gnrc/tcp/config.h"
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_sndbuf.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief Send buffer entry.
+ */
+typedef struct {
+    uint8_t used;                                 /**< Flag: Is buffer in use? */
+    uint8_t buffer[CONFIG_GNRC_TCP_SND_BUF_SIZE]; /**< Send buffer storage */
+} _sndbuf_entry_t;
+
+/**
+ * @brief Struct holding send buffers.
+ */
+typedef struct {
+    mutex_t lock;                                         /**< Access lock */
+    _sndbuf_entry_t entries[CONFIG_GNRC_TCP_SND_BUFFERS]; /**< Buffers */
+} _sndbuf_t;
+
+/**
+ * @brief Internal struct holding send buffers.
+ */
+static _sndbuf_t _static_buf;
+
+/**
+ * @brief Allocate send buffer.
+ *
+ * @returns   Not NULL if a send buffer was allocated.
+ *            NULL if allocation failed.
+ */
+static void *_sndbuf_alloc(void)
+{
+    TCP_DEBUG_ENTER;
+    void *result = NULL;
+    mutex_lock(&(_static_buf.lock));
+    for (size_t i = 0; i < CONFIG_GNRC_TCP_SND_BUFFERS; ++i) {
+        if (_static_buf.entries[i].used == 0) {
+            _static_buf.entries[i].used = 1;
+            result = (void *)(_static_buf.entries[i].buffer);
+            break;
+        }
+    }
+    mutex_unlock(&(_static_buf.lock));
+    TCP_DEBUG_LEAVE;
+    return result;
+}
+
+/**
+ * @brief Release send buffer.
+ *
+ * @param[in] buf   Buffer to release.
+ */
+static void _sndbuf_free(void * const buf)
+{
+    TCP_DEBUG_ENTER;
+    mutex_lock(&(_static_buf.lock));
+    for (size_t i = 0; i < CONFIG_GNRC_TCP_SND_BUFFERS; ++i) {
+        if ((_static_buf.entries[i].used == 1) && (buf == _static_buf.entries[i].buffer)) {
+            _static_buf.entries[i].used = 0;
+        }
+    }
+    mutex_unlock(&(_static_buf.lock));
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_sndbuf_init(void)
+{
+    TCP_DEBUG_ENTER;
+    mutex_init(&(_static_buf.lock));
+    for (size_t i = 0; i < CONFIG_GNRC_TCP_SND_BUFFERS; ++i) {
+        _static_buf.entries[i].used = 0;
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+int _gnrc_tcp_sndbuf_get_buffer(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (tcb->snd_buf_raw == NULL) {
+        tcb->snd_buf_raw = _sndbuf_alloc();
+        if (tcb->snd_buf_raw == NULL) {
+            TCP_DEBUG_ERROR("-ENOMEM: Failed to allocate send buffer.");
+            TCP_DEBUG_LEAVE;
+            return -ENOMEM;
+        }
+    }
+    ringbuffer_init(&tcb->snd_buf, (char *) tcb->snd_buf_raw, CONFIG_GNRC_TCP_SND_BUF_SIZE);
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+void _gnrc_tcp_sndbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (tcb->snd_buf_raw != NULL) {
+        _sndbuf_free(tcb->snd_buf_raw);
+        tcb->snd_buf_raw = NULL;
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_sndbuf_read(const gnrc_tcp_tcb_t *tcb, size_t offset, void *buf,
+                           size_t len)
+{
+    TCP_DEBUG_ENTER;
+    const ringbuffer_t *rb = &tcb->snd_buf;
+    assert(offset + len <= rb->avail);
+
+    /* The requested data wraps around the end of the buffer at most once */
+    size_t start = (rb->start + offset) % rb->size;
+    size_t part = rb->size - start;
+
+    if (part >= len) {
+        memcpy(buf, &rb->buf[start], len);
+    }
+    else {
+        memcpy(buf, &rb->buf[start], part);
+        memcpy((uint8_t *)buf + part, rb->buf, len - part);
+    }
+    TCP_DEBUG_LEAVE;
+}
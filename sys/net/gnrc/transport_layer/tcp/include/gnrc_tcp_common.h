@@ -44,6 +44,9 @@ extern "C" {
 #define STATUS_NOTIFY_USER    (1 << 2) /**< Internal: Status bitmask NOTIFY_USER */
 #define STATUS_ACCEPTED       (1 << 3) /**< Internal: Status bitmask ACCEPTED */
 #define STATUS_LOCKED         (1 << 4) /**< Internal: Status bitmask LOCKED */
+#define STATUS_RTT_PENDING    (1 << 5) /**< Internal: Status bitmask RTT_PENDING */
+#define STATUS_FAST_RETRANS   (1 << 6) /**< Internal: Status bitmask FAST_RETRANS */
+#define STATUS_SACK_PERMITTED (1 << 7) /**< Internal: Status bitmask SACK_PERMITTED */
 /** @} */
 
 /**
@@ -78,11 +81,11 @@ extern "C" {
  * @{
  */
 #define MSG_TYPE_CONNECTION_TIMEOUT (GNRC_NETAPI_MSG_TYPE_ACK + 101) /**< Internal: message id */
-#define MSG_TYPE_PROBE_TIMEOUT      (GNRC_NETAPI_MSG_TYPE_ACK + 102) /**< Internal: message id */
 #define MSG_TYPE_USER_SPEC_TIMEOUT  (GNRC_NETAPI_MSG_TYPE_ACK + 103) /**< Internal: message id */
 #define MSG_TYPE_RETRANSMISSION     (GNRC_NETAPI_MSG_TYPE_ACK + 104) /**< Internal: message id */
 #define MSG_TYPE_TIMEWAIT           (GNRC_NETAPI_MSG_TYPE_ACK + 105) /**< Internal: message id */
 #define MSG_TYPE_NOTIFY_USER        (GNRC_NETAPI_MSG_TYPE_ACK + 106) /**< Internal: message id */
+#define MSG_TYPE_DELAYED_ACK        (GNRC_NETAPI_MSG_TYPE_ACK + 107) /**< Internal: message id */
 /** @} */
 
 /**
@@ -0,0 +1,150 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       Congestion control for GNRC TCP using @ref sys_congure.
+ *
+ * When module `gnrc_tcp_congure` is used, the amount of data in flight is
+ * limited by the congestion window of a CongURE state object. The flavor of
+ * congestion control is selected by a sub-module, e.g. `gnrc_tcp_congure_reno`
+ * (the default). All window sizes are in bytes.
+ *
+ * Without module `gnrc_tcp_congure`, all functions are no-ops and the
+ * congestion window is unlimited.
+ */
+
+#include <stdint.h>
+
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(MODULE_GNRC_TCP_CONGURE) || defined(DOXYGEN)
+/**
+ * @brief Retrieve a CongURE state object from a pool of free objects.
+ *
+ * Needs to be defined by each CongURE implementation `congure_x` as the
+ * sub-module `gnrc_tcp_congure_x`. It sets up and initializes the object for
+ * @p tcb, congure_snd_t::driver == NULL marks an object as free.
+ *
+ * Backends signal that segments have to be retransmitted right away by setting
+ * STATUS_FAST_RETRANS in tcb->status.
+ *
+ * @param[in] tcb   TCB the state object is used for.
+ *
+ * @returns   A CongURE state object on success.
+ *            NULL, if no free CongURE state object is available.
+ */
+congure_snd_t *_gnrc_tcp_congure_snd_get(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Assign a CongURE state object to a TCB, once the connection is established.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Release the CongURE state object of a TCB.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_congure_release(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Get the congestion window.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   The congestion window in bytes, UINT32_MAX if there is none.
+ */
+uint32_t _gnrc_tcp_congure_get_wnd(const gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Report that data from the send buffer was sent.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     len   Number of bytes sent.
+ */
+void _gnrc_tcp_congure_report_sent(gnrc_tcp_tcb_t *tcb, uint32_t len);
+
+/**
+ * @brief Report a received acknowledgment, including duplicate ones.
+ *
+ * @pre tcb->snd_una and tcb->snd_wnd are not updated yet.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     seg_ack   Acknowledgment number of the received segment.
+ * @param[in]     acked     Number of bytes from the send buffer acknowledged.
+ * @param[in]     seg_wnd   Window advertised by the received segment.
+ * @param[in]     pay_len   Payload length of the received segment.
+ * @param[in]     ctl       Control bits of the received segment.
+ */
+void _gnrc_tcp_congure_report_ack(gnrc_tcp_tcb_t *tcb, uint32_t seg_ack, uint32_t acked,
+                                  uint16_t seg_wnd, uint32_t pay_len, uint16_t ctl);
+
+/**
+ * @brief Report that the retransmission timer expired.
+ *
+ * @param[in,out] tcb         TCB holding the connection information.
+ * @param[in]     in_flight   Number of bytes in flight, that are considered lost.
+ */
+void _gnrc_tcp_congure_report_timeout(gnrc_tcp_tcb_t *tcb, uint32_t in_flight);
+#else
+static inline void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+}
+
+static inline void _gnrc_tcp_congure_release(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+}
+
+static inline uint32_t _gnrc_tcp_congure_get_wnd(const gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+    return UINT32_MAX;
+}
+
+static inline void _gnrc_tcp_congure_report_sent(gnrc_tcp_tcb_t *tcb, uint32_t len)
+{
+    (void)tcb;
+    (void)len;
+}
+
+static inline void _gnrc_tcp_congure_report_ack(gnrc_tcp_tcb_t *tcb, uint32_t seg_ack,
+                                                uint32_t acked, uint16_t seg_wnd,
+                                                uint32_t pay_len, uint16_t ctl)
+{
+    (void)tcb;
+    (void)seg_ack;
+    (void)acked;
+    (void)seg_wnd;
+    (void)pay_len;
+    (void)ctl;
+}
+
+static inline void _gnrc_tcp_congure_report_timeout(gnrc_tcp_tcb_t *tcb, uint32_t in_flight)
+{
+    (void)tcb;
+    (void)in_flight;
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
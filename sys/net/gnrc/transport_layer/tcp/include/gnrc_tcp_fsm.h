@@ -58,7 +58,7 @@ typedef enum {
     FSM_EVENT_TIMEOUT_TIMEWAIT,   /* Timeout: timewait */
     FSM_EVENT_TIMEOUT_RETRANSMIT, /* Timeout: retransmit */
     FSM_EVENT_TIMEOUT_CONNECTION, /* Timeout: connection */
-    FSM_EVENT_SEND_PROBE,         /* Send zero window probe */
+    FSM_EVENT_TIMEOUT_DELAYED_ACK, /* Timeout: delayed acknowledgment */
     FSM_EVENT_CLEAR_RETRANSMIT    /* Clear retransmission mechanism */
 } _gnrc_tcp_fsm_event_t;
 
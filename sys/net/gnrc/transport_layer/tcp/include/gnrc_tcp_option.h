@@ -41,6 +41,43 @@ static inline uint32_t _gnrc_tcp_option_build_mss(uint16_t mss)
             ((uint32_t) TCP_OPTION_LENGTH_MSS << 16) | mss);
 }
 
+#if defined(MODULE_GNRC_TCP_SACK) || defined(DOXYGEN)
+/**
+ * @brief Helper function to build the SACK permitted option, preceded by two NOPs.
+ *
+ * @returns   SACK permitted option value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_sack_permitted(void)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK_PERMITTED << 8) | TCP_OPTION_LENGTH_SACK_PERMITTED);
+}
+
+/**
+ * @brief Get the size of the SACK option to send.
+ *
+ * A SACK option is sent if the peer permitted it and out-of-order data
+ * is held in the receive buffer.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Size of the SACK option in bytes, a multiple of four.
+ *            Zero if no SACK option is sent.
+ */
+uint8_t _gnrc_tcp_option_sack_len(const gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Write the SACK option, preceded by two NOPs.
+ *
+ * @pre _gnrc_tcp_option_sack_len() returned a value greater than zero.
+ *
+ * @param[in]  tcb       TCB holding the connection information.
+ * @param[out] opt_ptr   Option field to write to.
+ */
+void _gnrc_tcp_option_build_sack(const gnrc_tcp_tcb_t *tcb, uint8_t *opt_ptr);
+#endif
+
 /**
  * @brief Helper function to build the combined option and control flag field.
  *
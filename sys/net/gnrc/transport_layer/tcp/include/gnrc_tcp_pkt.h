@@ -62,6 +62,23 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                         const uint32_t seq_num, const uint32_t ack_num,
                         void *payload, const size_t payload_len);
 
+/**
+ * @brief Build and allocate a data segment from the send buffer.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[out]    out_pkt   Pointer to packet to build.
+ * @param[out]    seq_con   Sequence number consumption of built packet.
+ * @param[in]     offset    Offset of the payload in the send buffer,
+ *                          relative to tcb->snd_una.
+ * @param[in]     len       Payload size.
+ *
+ * @returns   Zero on success.
+ *            -ENOMEM if pktbuf is full.
+ */
+int _gnrc_tcp_pkt_build_data(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
+                             uint16_t *seq_con, const size_t offset,
+                             const size_t len);
+
 /**
  * @brief Sends packet to peer.
  *
@@ -122,7 +139,18 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief (Re-)starts the retransmission timer.
+ *
+ * @param[in,out] tcb          TCB holding the connection information.
+ * @param[in]     retransmit   Flag used to indicate a retransmission, this
+ *                             doubles the retransmission timeout.
+ */
+void _gnrc_tcp_pkt_setup_retransmit_timer(gnrc_tcp_tcb_t *tcb, const bool retransmit);
+
+/**
+ * @brief Acknowledges and removes packet or data from the retransmission mechanism.
+ *
+ * @pre tcb->snd_una was not advanced to @p ack yet.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
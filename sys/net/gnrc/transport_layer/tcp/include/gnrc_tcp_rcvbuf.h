@@ -19,6 +19,11 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "net/gnrc/pkt.h"
 #include "net/gnrc/tcp/tcb.h"
 
 #ifdef __cplusplus
@@ -47,6 +52,36 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
  */
 void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
 
+#if defined(MODULE_GNRC_TCP_SACK) || defined(DOXYGEN)
+/**
+ * @brief Hold out-of-order data in the free space of the receive buffer.
+ *
+ * Only a single contiguous block of out-of-order data (tcb->rcv_ooo) is held,
+ * segments that neither overlap nor touch it and segments that do not fit
+ * into the receive buffer are dropped.
+ *
+ * @param[in,out] tcb       TCB holding the receive buffer.
+ * @param[in]     snp       First payload snip of the received segment.
+ * @param[in]     seg_seq   Sequence number of the received segment, after tcb->rcv_nxt.
+ * @param[in]     pay_len   Payload length of the received segment.
+ */
+void _gnrc_tcp_rcvbuf_store_ooo(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *snp, uint32_t seg_seq,
+                                uint32_t pay_len);
+
+/**
+ * @brief Append held out-of-order data once the gap in front of it is filled.
+ *
+ * Advances tcb->rcv_nxt to the end of the held data, if in-order data was
+ * received up to or beyond its start.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ *
+ * @returns   true, if out-of-order data was held before the call.
+ *            false otherwise.
+ */
+bool _gnrc_tcp_rcvbuf_append_ooo(gnrc_tcp_tcb_t *tcb);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
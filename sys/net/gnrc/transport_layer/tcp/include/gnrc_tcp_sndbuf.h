@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       Functions for allocating, freeing and reading the send buffer.
+ */
+
+#include <stddef.h>
+
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initializes global send buffer.
+ */
+void _gnrc_tcp_sndbuf_init(void);
+
+/**
+ * @brief Allocate send buffer and assign it to TCB.
+ *
+ * @param[in,out] tcb   TCB that acquires send buffer.
+ *
+ * @returns   Zero  on success.
+ *            -ENOMEM if all send buffers are currently used.
+ */
+int _gnrc_tcp_sndbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Release allocated send buffer.
+ *
+ * @param[in,out] tcb   TCB holding the send buffer that should be released.
+ */
+void _gnrc_tcp_sndbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Copy data out of the send buffer without removing it.
+ *
+ * @pre @p offset + @p len does not exceed the number of bytes in the send buffer.
+ *
+ * @param[in]  tcb      TCB holding the send buffer.
+ * @param[in]  offset   Offset of the first byte to copy, relative to tcb->snd_una.
+ * @param[out] buf      Buffer to copy the data into.
+ * @param[in]  len      Number of bytes to copy.
+ */
+void _gnrc_tcp_sndbuf_read(const gnrc_tcp_tcb_t *tcb, size_t offset, void *buf,
+                           size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -30,6 +30,9 @@
 #include "net/gnrc.h"
 #include "net/gnrc/icmpv6/error.h"
 #include "net/inet_csum.h"
+#ifdef MODULE_GNRC_NETAPI_SINGLE_THREAD
+#include "net/gnrc/netapi/single_thread.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -39,11 +42,18 @@
  */
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 
+#if IS_USED(MODULE_GNRC_NETAPI_SINGLE_THREAD)
+/**
+ * @brief   UDP as a layer of the shared GNRC thread
+ */
+static gnrc_netapi_single_thread_layer_t _layer;
+#else
 /**
  * @brief   Allocate memory for the UDP thread's stack
  */
 static char _stack[GNRC_UDP_STACK_SIZE + DEBUG_EXTRA_STACKSIZE];
 static msg_t _msg_queue[GNRC_UDP_MSG_QUEUE_SIZE];
+#endif
 
 /**
  * @brief   Calculate the UDP checksum dependent on the network protocol
@@ -217,10 +227,32 @@ static void _send(gnrc_pktsnip_t *pkt)
     }
 }
 
+static void _handle_msg(msg_t *msg, msg_t *reply)
+{
+    switch (msg->type) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV\n");
+            _receive(msg->content.ptr);
+            break;
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND\n");
+            _send(msg->content.ptr);
+            break;
+        case GNRC_NETAPI_MSG_TYPE_SET:
+        case GNRC_NETAPI_MSG_TYPE_GET:
+            msg_reply(msg, reply);
+            break;
+        default:
+            DEBUG("udp: received unidentified message\n");
+            break;
+    }
+}
+
+#if !IS_USED(MODULE_GNRC_NETAPI_SINGLE_THREAD)
 static void *_event_loop(void *arg)
 {
     (void)arg;
-    msg_t msg, reply;
+    msg_t msgs[CONFIG_GNRC_NETAPI_MSG_BATCH_SIZE], reply;
     gnrc_netreg_entry_t netreg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             thread_getpid());
     /* preset reply message */
@@ -233,29 +265,17 @@ static void *_event_loop(void *arg)
 
     /* dispatch NETAPI messages */
     while (1) {
-        msg_receive(&msg);
-        switch (msg.type) {
-            case GNRC_NETAPI_MSG_TYPE_RCV:
-                DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV\n");
-                _receive(msg.content.ptr);
-                break;
-            case GNRC_NETAPI_MSG_TYPE_SND:
-                DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND\n");
-                _send(msg.content.ptr);
-                break;
-            case GNRC_NETAPI_MSG_TYPE_SET:
-            case GNRC_NETAPI_MSG_TYPE_GET:
-                msg_reply(&msg, &reply);
-                break;
-            default:
-                DEBUG("udp: received unidentified message\n");
-                break;
+        unsigned num = msg_receive_batch(msgs, ARRAY_SIZE(msgs));
+
+        for (unsigned i = 0; i < num; i++) {
+            _handle_msg(&msgs[i], &reply);
         }
     }
 
     /* never reached */
     return NULL;
 }
+#endif
 
 int gnrc_udp_calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr)
 {
@@ -301,9 +321,14 @@ int gnrc_udp_init(void)
 {
     /* check if thread is already running */
     if (_pid == KERNEL_PID_UNDEF) {
+#if IS_USED(MODULE_GNRC_NETAPI_SINGLE_THREAD)
+        _pid = gnrc_netapi_single_thread_register(&_layer, GNRC_NETTYPE_UDP,
+                                                  _handle_msg);
+#else
         /* start UDP thread */
         _pid = thread_create(_stack, sizeof(_stack), GNRC_UDP_PRIO,
                              0, _event_loop, NULL, "udp");
+#endif
     }
     return _pid;
 }
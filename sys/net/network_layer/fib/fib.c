@@ -68,6 +68,296 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
     *target = xtimer_now_usec64() + (ms * US_PER_MS);
 }
 
+#if IS_USED(MODULE_FIB_INDEXED)
+/* entries are linked by their index + 1, so 0 ends a list */
+#define FIB_IDX_NIL (0U)
+
+static_assert(!(CONFIG_FIB_INDEXED_BUCKETS & (CONFIG_FIB_INDEXED_BUCKETS - 1)),
+              "CONFIG_FIB_INDEXED_BUCKETS must be a power of 2");
+
+static const uint8_t fib_idx_zeros[UNIVERSAL_ADDRESS_SIZE];
+
+/**
+ * @brief adds bytes to an FNV-1a hash
+ */
+static uint32_t fib_idx_hash(uint32_t hash, const uint8_t *bytes, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+/**
+ * @brief returns the bucket for the hash of the first @p len bytes of an
+ *        address of @p addr_size bytes
+ */
+static unsigned fib_idx_bucket(uint32_t hash, size_t addr_size, size_t len)
+{
+    hash ^= (addr_size << 8) | len;
+    hash *= 16777619U;
+    return (hash ^ (hash >> 16)) & (CONFIG_FIB_INDEXED_BUCKETS - 1);
+}
+
+static unsigned fib_idx_exact_bucket(const uint8_t *addr, size_t addr_size)
+{
+    return fib_idx_bucket(fib_idx_hash(2166136261U, addr, addr_size),
+                          addr_size, addr_size);
+}
+
+/**
+ * @brief returns the number of full bytes of the prefix of an entry
+ *
+ * A prefix entry only matches addresses that equal it in these bytes, the
+ * remaining bits are checked by universal_address_compare().
+ *
+ * @return -1 if the entry is not found by its prefix
+ */
+static int fib_idx_prefix_bytes(const fib_entry_t *entry)
+{
+    uint32_t prefix_len = (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK)
+                          >> FIB_FLAG_NET_PREFIX_SHIFT;
+    size_t size = entry->global->address_size;
+
+    /* all zeros addresses are default routes and found as exact match */
+    if ((prefix_len == 0) || ((prefix_len >> 3) >= size) ||
+        (memcmp(entry->global->address, fib_idx_zeros, size) == 0)) {
+        return -1;
+    }
+    return prefix_len >> 3;
+}
+
+static uint16_t *fib_idx_prefix_head(fib_table_t *table, const fib_entry_t *entry,
+                                     size_t len)
+{
+    uint32_t hash = fib_idx_hash(2166136261U, entry->global->address, len);
+
+    return &table->idx_prefix[fib_idx_bucket(hash, entry->global->address_size,
+                                             len)];
+}
+
+static inline uint64_t fib_idx_heap_key(fib_table_t *table, unsigned pos)
+{
+    return table->data.entries[table->data.entries[pos].heap_entry].lifetime;
+}
+
+static void fib_idx_heap_set(fib_table_t *table, unsigned pos, unsigned i)
+{
+    table->data.entries[pos].heap_entry = i;
+    table->data.entries[i].heap_pos = pos;
+}
+
+/**
+ * @brief moves the entry at @p pos of the lifetime heap to its place
+ */
+static void fib_idx_heap_sift(fib_table_t *table, unsigned pos)
+{
+    unsigned i = table->data.entries[pos].heap_entry;
+    uint64_t key = table->data.entries[i].lifetime;
+
+    /* up */
+    while ((pos > 0) && (fib_idx_heap_key(table, (pos - 1) / 2) > key)) {
+        fib_idx_heap_set(table, pos,
+                         table->data.entries[(pos - 1) / 2].heap_entry);
+        pos = (pos - 1) / 2;
+    }
+    /* down */
+    for (unsigned child = 2 * pos + 1; child < table->idx_heap_len;
+         child = 2 * pos + 1) {
+        if ((child + 1 < table->idx_heap_len) &&
+            (fib_idx_heap_key(table, child + 1) < fib_idx_heap_key(table, child))) {
+            child++;
+        }
+        if (fib_idx_heap_key(table, child) >= key) {
+            break;
+        }
+        fib_idx_heap_set(table, pos, table->data.entries[child].heap_entry);
+        pos = child;
+    }
+    fib_idx_heap_set(table, pos, i);
+}
+
+/**
+ * @brief adds an entry to the lifetime heap, if it expires
+ */
+static void fib_idx_heap_add(fib_table_t *table, size_t i)
+{
+    if (table->data.entries[i].lifetime != FIB_LIFETIME_NO_EXPIRE) {
+        fib_idx_heap_set(table, table->idx_heap_len++, i);
+        fib_idx_heap_sift(table, table->idx_heap_len - 1);
+    }
+}
+
+/**
+ * @brief removes an entry from the lifetime heap, if it expires
+ */
+static void fib_idx_heap_del(fib_table_t *table, size_t i)
+{
+    if (table->data.entries[i].lifetime != FIB_LIFETIME_NO_EXPIRE) {
+        unsigned pos = table->data.entries[i].heap_pos;
+
+        if (pos != --table->idx_heap_len) {
+            fib_idx_heap_set(table, pos,
+                             table->data.entries[table->idx_heap_len].heap_entry);
+            fib_idx_heap_sift(table, pos);
+        }
+    }
+}
+
+/**
+ * @brief indexes a new entry, taken from the free list
+ */
+static void fib_idx_add(fib_table_t *table, size_t i)
+{
+    fib_entry_t *entry = &table->data.entries[i];
+    uint16_t *head = &table->idx_exact[fib_idx_exact_bucket(entry->global->address,
+                                                            entry->global->address_size)];
+    int len = fib_idx_prefix_bytes(entry);
+
+    assert(table->idx_free == i + 1);
+    table->idx_free = entry->exact_next;
+    entry->exact_next = *head;
+    *head = i + 1;
+    if (len >= 0) {
+        head = fib_idx_prefix_head(table, entry, len);
+        entry->prefix_next = *head;
+        *head = i + 1;
+        table->idx_prefix_numof[len]++;
+    }
+    fib_idx_heap_add(table, i);
+}
+
+/**
+ * @brief removes an entry from the index and puts it on the free list
+ */
+static void fib_idx_del(fib_table_t *table, size_t i)
+{
+    fib_entry_t *entry = &table->data.entries[i];
+    uint16_t *link = &table->idx_exact[fib_idx_exact_bucket(entry->global->address,
+                                                            entry->global->address_size)];
+    int len = fib_idx_prefix_bytes(entry);
+
+    while (*link != i + 1) {
+        link = &table->data.entries[*link - 1].exact_next;
+    }
+    *link = entry->exact_next;
+    if (len >= 0) {
+        link = fib_idx_prefix_head(table, entry, len);
+        while (*link != i + 1) {
+            link = &table->data.entries[*link - 1].prefix_next;
+        }
+        *link = entry->prefix_next;
+        table->idx_prefix_numof[len]--;
+    }
+    fib_idx_heap_del(table, i);
+    entry->exact_next = table->idx_free;
+    table->idx_free = i + 1;
+}
+
+/**
+ * @brief resets the index of a single hop table with all entries unused
+ */
+static void fib_idx_init(fib_table_t *table)
+{
+    assert(table->size < UINT16_MAX);
+    memset(table->idx_exact, 0, sizeof(table->idx_exact));
+    memset(table->idx_prefix, 0, sizeof(table->idx_prefix));
+    memset(table->idx_prefix_numof, 0, sizeof(table->idx_prefix_numof));
+    table->idx_heap_len = 0;
+    table->idx_free = FIB_IDX_NIL;
+    for (size_t i = table->size; i > 0; i--) {
+        table->data.entries[i - 1].exact_next = table->idx_free;
+        table->idx_free = i;
+    }
+}
+
+static int fib_remove(fib_table_t *table, fib_entry_t *entry);
+
+/**
+ * @brief removes all entries with a lifetime before @p now
+ */
+static void fib_idx_expire(fib_table_t *table, uint64_t now)
+{
+    while ((table->idx_heap_len > 0) && (fib_idx_heap_key(table, 0) < now)) {
+        fib_remove(table, &table->data.entries[table->data.entries[0].heap_entry]);
+    }
+}
+
+static fib_entry_t *fib_idx_get_exact(fib_table_t *table, const uint8_t *addr,
+                                      size_t addr_size)
+{
+    for (uint16_t n = table->idx_exact[fib_idx_exact_bucket(addr, addr_size)];
+         n != FIB_IDX_NIL; n = table->data.entries[n - 1].exact_next) {
+        fib_entry_t *entry = &table->data.entries[n - 1];
+
+        if ((entry->global->address_size == addr_size) &&
+            (memcmp(entry->global->address, addr, addr_size) == 0)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief indexed version of the search in fib_find_entry()
+ *
+ * Selects the same entry as the linear search: an exact match, else the
+ * prefix entry with the longest match as reported by
+ * universal_address_compare() (the first one on ties), else the default
+ * route.
+ */
+static int fib_idx_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
+                              bool is_all_zeros_addr, fib_entry_t **entry)
+{
+    fib_entry_t *res;
+    size_t prefix_size = 0;
+    uint32_t hash = 2166136261U;
+
+    if (dst_size > UNIVERSAL_ADDRESS_SIZE) {
+        return -EHOSTUNREACH;
+    }
+    /* for an all zeros dst, this is also the default route */
+    if ((res = fib_idx_get_exact(table, dst, dst_size)) != NULL) {
+        *entry = res;
+        return 1;
+    }
+    for (size_t len = 0; len < dst_size; len++) {
+        if (table->idx_prefix_numof[len] > 0) {
+            uint16_t n = table->idx_prefix[fib_idx_bucket(hash, dst_size, len)];
+
+            for (; n != FIB_IDX_NIL; n = table->data.entries[n - 1].prefix_next) {
+                fib_entry_t *tmp = &table->data.entries[n - 1];
+                size_t match_size = dst_size << 3;
+                uint32_t global_prefix_len = (tmp->global_flags & FIB_FLAG_NET_PREFIX_MASK)
+                                             >> FIB_FLAG_NET_PREFIX_SHIFT;
+
+                if (((global_prefix_len >> 3) != len) ||
+                    (universal_address_compare(tmp->global, dst, &match_size)
+                     != UNIVERSAL_ADDRESS_MATCHING_PREFIX) ||
+                    (match_size < global_prefix_len)) {
+                    continue;
+                }
+                if ((match_size > prefix_size) ||
+                    ((match_size == prefix_size) && (tmp < res))) {
+                    res = tmp;
+                    prefix_size = match_size;
+                }
+            }
+        }
+        hash = fib_idx_hash(hash, &dst[len], 1);
+    }
+    if ((res == NULL) && !is_all_zeros_addr) {
+        res = fib_idx_get_exact(table, fib_idx_zeros, dst_size);
+    }
+    if (res == NULL) {
+        return -EHOSTUNREACH;
+    }
+    *entry = res;
+    return 0;
+}
+#endif /* MODULE_FIB_INDEXED */
+
 /**
  * @brief returns pointer to the entry for the given destination address
  *
@@ -107,6 +397,17 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
         }
     }
 
+#if IS_USED(MODULE_FIB_INDEXED)
+    (void)prefix_size;
+    (void)match_size;
+    fib_idx_expire(table, now);
+    ret = fib_idx_find_entry(table, dst, dst_size, is_all_zeros_addr, &entry_arr[0]);
+    if (ret == 1) {
+        *entry_arr_size = 1;
+        return 1;
+    }
+    count = (ret == 0);
+#else
     for (size_t i = 0; i < table->size; ++i) {
 
         /* autoinvalidate if the entry lifetime is not set to not expire */
@@ -178,6 +479,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
             }
         }
     }
+#endif
 
     if (IS_ACTIVE(ENABLE_DEBUG)) {
         if (count > 0) {
@@ -196,6 +498,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
 /**
  * @brief updates the next hop the lifetime and the interface id for a given entry
  *
+ * @param[in] table          the FIB table containing the entry
  * @param[in] entry          the entry to be updated
  * @param[in] next_hop       the next hop address to be updated
  * @param[in] next_hop_size  the next hop address size
@@ -205,7 +508,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
  * @return 0 if the entry has been updated
  *         -ENOMEM if the entry cannot be updated due to insufficient RAM
  */
-static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
+static int fib_upd_entry(fib_table_t *table, fib_entry_t *entry, uint8_t *next_hop,
                          size_t next_hop_size, uint32_t next_hop_flags,
                          uint32_t lifetime)
 {
@@ -219,12 +522,20 @@ static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
     entry->next_hop = container;
     entry->next_hop_flags = next_hop_flags;
 
+#if IS_USED(MODULE_FIB_INDEXED)
+    fib_idx_heap_del(table, entry - table->data.entries);
+#else
+    (void)table;
+#endif
     if (lifetime != (uint32_t)FIB_LIFETIME_NO_EXPIRE) {
         fib_lifetime_to_absolute(lifetime, &entry->lifetime);
     }
     else {
         entry->lifetime = FIB_LIFETIME_NO_EXPIRE;
     }
+#if IS_USED(MODULE_FIB_INDEXED)
+    fib_idx_heap_add(table, entry - table->data.entries);
+#endif
 
     return 0;
 }
@@ -250,6 +561,38 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                             uint8_t *next_hop, size_t next_hop_size, uint32_t
                             next_hop_flags, uint32_t lifetime)
 {
+#if IS_USED(MODULE_FIB_INDEXED)
+    size_t i;
+    fib_entry_t *entry;
+
+    if (table->idx_free == FIB_IDX_NIL) {
+        return -ENOMEM;
+    }
+    i = table->idx_free - 1;
+    entry = &table->data.entries[i];
+    entry->global = universal_address_add(dst, dst_size);
+    if (entry->global == NULL) {
+        return -ENOMEM;
+    }
+    entry->next_hop = universal_address_add(next_hop, next_hop_size);
+    if (entry->next_hop == NULL) {
+        universal_address_rem(entry->global);
+        entry->global = NULL;
+        return -ENOMEM;
+    }
+    entry->global_flags = dst_flags;
+    entry->next_hop_flags = next_hop_flags;
+    entry->iface_id = iface_id;
+    if (lifetime != (uint32_t) FIB_LIFETIME_NO_EXPIRE) {
+        fib_lifetime_to_absolute(lifetime, &entry->lifetime);
+    }
+    else {
+        entry->lifetime = FIB_LIFETIME_NO_EXPIRE;
+    }
+    fib_idx_add(table, i);
+
+    return 0;
+#else
     for (size_t i = 0; i < table->size; ++i) {
         if (table->data.entries[i].lifetime == 0) {
 
@@ -278,17 +621,27 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
     }
 
     return -ENOMEM;
+#endif
 }
 
 /**
  * @brief removes the given entry
  *
+ * @param[in] table the FIB table containing the entry
  * @param[in] entry the entry to be removed
  *
  * @return 0 on success
  */
-static int fib_remove(fib_entry_t *entry)
+static int fib_remove(fib_table_t *table, fib_entry_t *entry)
 {
+#if IS_USED(MODULE_FIB_INDEXED)
+    if (entry->lifetime != 0) {
+        fib_idx_del(table, entry - table->data.entries);
+    }
+#else
+    (void)table;
+#endif
+
     if (entry->global != NULL) {
         universal_address_rem(entry->global);
     }
@@ -408,7 +761,7 @@ int fib_add_entry(fib_table_t *table,
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
     }
     else {
         ret = fib_create_entry(table, iface_id, dst, dst_size, dst_flags,
@@ -438,7 +791,7 @@ int fib_update_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
     if (fib_find_entry(table, dst, dst_size, &(entry[0]), &count) == 1) {
         DEBUG("[fib_update_entry] found entry: %p\n", (void *)(entry[0]));
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -462,7 +815,7 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        fib_remove(entry[0]);
+        fib_remove(table, entry[0]);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -482,7 +835,7 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
     for (size_t i = 0; i < table->size; ++i) {
         if ((interface == KERNEL_PID_UNDEF) ||
             (interface == table->data.entries[i].iface_id)) {
-            fib_remove(&table->data.entries[i]);
+            fib_remove(table, &table->data.entries[i]);
         }
     }
 
@@ -603,6 +956,9 @@ void fib_init(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+#if IS_USED(MODULE_FIB_INDEXED)
+        fib_idx_init(table);
+#endif
     }
     universal_address_init();
     mutex_unlock(&(table->mtx_access));
@@ -628,6 +984,9 @@ void fib_deinit(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+#if IS_USED(MODULE_FIB_INDEXED)
+        fib_idx_init(table);
+#endif
     }
     universal_address_reset();
     mutex_unlock(&(table->mtx_access));
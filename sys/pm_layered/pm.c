@@ -24,6 +24,9 @@
 #include "irq.h"
 #include "periph/pm.h"
 #include "pm_layered.h"
+#if IS_USED(MODULE_PM_LAYERED_STATS)
+#include "ztimer.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -55,6 +58,81 @@
  */
 static pm_blocker_t pm_blocker = { .blockers = PM_BLOCKER_INITIAL };
 
+#if IS_USED(MODULE_PM_LAYERED_STATS)
+static pm_stats_t _stats;
+static uint32_t _stats_last;
+static bool _stats_clock_acquired;
+static bool _wakeup_pending;
+
+/* must be called with interrupts disabled, at least once per wraparound of
+ * PM_LAYERED_STATS_CLOCK */
+static uint32_t _stats_advance(void)
+{
+    if (!_stats_clock_acquired) {
+        /* never released, as the clock has to run across the sleep periods
+         * it measures */
+        ztimer_acquire(PM_LAYERED_STATS_CLOCK);
+        _stats_last = ztimer_now(PM_LAYERED_STATS_CLOCK);
+        _stats_clock_acquired = true;
+    }
+
+    uint32_t now = ztimer_now(PM_LAYERED_STATS_CLOCK);
+    uint32_t elapsed = now - _stats_last;
+
+    _stats_last = now;
+    _stats.period_us += (uint64_t)elapsed * PM_LAYERED_STATS_US_PER_TICK;
+
+    return elapsed;
+}
+
+static void _stats_sleep(unsigned mode)
+{
+    if (_wakeup_pending) {
+        /* nobody claimed the last wakeup */
+        _wakeup_pending = false;
+        _stats.wakeups[PM_WAKEUP_SRC_UNKNOWN]++;
+    }
+
+    _stats_advance();
+    pm_set(mode);
+    _stats.residency_us[mode] += (uint64_t)_stats_advance()
+                                 * PM_LAYERED_STATS_US_PER_TICK;
+    _stats.entries[mode]++;
+    _wakeup_pending = true;
+}
+
+void pm_stats_wakeup(unsigned source)
+{
+    if (source >= CONFIG_PM_LAYERED_STATS_WAKEUP_NUMOF) {
+        source = PM_WAKEUP_SRC_UNKNOWN;
+    }
+
+    unsigned state = irq_disable();
+    if (_wakeup_pending) {
+        _wakeup_pending = false;
+        _stats.wakeups[source]++;
+    }
+    irq_restore(state);
+}
+
+void pm_stats_get(pm_stats_t *stats)
+{
+    unsigned state = irq_disable();
+    _stats_advance();
+    *stats = _stats;
+    irq_restore(state);
+}
+
+void pm_stats_reset(void)
+{
+    unsigned state = irq_disable();
+    _stats_advance();
+    _stats = (pm_stats_t){ 0 };
+    _wakeup_pending = false;
+    irq_restore(state);
+}
+#endif
+
 void pm_set_lowest(void)
 {
     unsigned mode = PM_NUM_MODES;
@@ -69,7 +147,11 @@ void pm_set_lowest(void)
     }
 
     if (mode != PM_NUM_MODES) {
+#if IS_USED(MODULE_PM_LAYERED_STATS)
+        _stats_sleep(mode);
+#else
         pm_set(mode);
+#endif
     }
     irq_restore(state);
 }
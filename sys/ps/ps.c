@@ -27,7 +27,6 @@
 
 #ifdef MODULE_SCHEDSTATISTICS
 #include "schedstatistics.h"
-#include "ztimer.h"
 #endif
 
 #ifdef MODULE_TLSF_MALLOC
@@ -77,13 +76,16 @@ void ps(void)
 
 #ifdef MODULE_SCHEDSTATISTICS
     uint64_t rt_sum = 0;
+    schedstats_t stats;
     if (!IS_ACTIVE(MODULE_CORE_IDLE_THREAD)) {
-        rt_sum = sched_pidlist[KERNEL_PID_UNDEF].runtime_us;
+        schedstats_get(KERNEL_PID_UNDEF, &stats);
+        rt_sum = stats.runtime_us;
     }
     for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
         thread_t *p = thread_get(i);
         if (p != NULL) {
-            rt_sum += sched_pidlist[i].runtime_us;
+            schedstats_get(i, &stats);
+            rt_sum += stats.runtime_us;
         }
     }
 #endif /* MODULE_SCHEDSTATISTICS */
@@ -104,11 +106,12 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
             /* multiply with 100 for percentage and to avoid floats/doubles */
-            uint64_t runtime_us = sched_pidlist[i].runtime_us * 100;
-            uint32_t ztimer_us = {sched_pidlist[i].runtime_us};
+            schedstats_get(i, &stats);
+            uint64_t runtime_us = stats.runtime_us * 100;
+            uint32_t ztimer_us = stats.runtime_us;
             unsigned runtime_major = runtime_us / rt_sum;
             unsigned runtime_minor = ((runtime_us % rt_sum) * 1000) / rt_sum;
-            unsigned switches = sched_pidlist[i].schedules;
+            unsigned switches = stats.schedules;
 #endif
             printf("\t%3" PRIkernel_pid
 #ifdef CONFIG_THREAD_NAMES
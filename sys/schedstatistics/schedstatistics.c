@@ -21,10 +21,27 @@
  * @}
  */
 
+#include <errno.h>
+
+#include "cpu.h"
+#include "irq.h"
 #include "sched.h"
 #include "schedstatistics.h"
 #include "thread.h"
-#include "ztimer.h"
+#include "time_units.h"
+
+#if IS_USED(MODULE_SCHEDSTATISTICS_CYCLES) && defined(DWT_CTRL_CYCCNTENA_Msk)
+#  include "periph_conf.h"
+#  define SCHEDSTAT_DWT         1
+#  define SCHEDSTAT_TICKS_PER_SEC   ((uint64_t)CLOCK_CORECLOCK)
+#elif IS_USED(MODULE_SCHEDSTATISTICS_CYCLES) && defined(CPU_NATIVE)
+#  include <time.h>
+#  define SCHEDSTAT_MONOTONIC   1
+#  define SCHEDSTAT_TICKS_PER_SEC   US_PER_SEC
+#else
+#  include "ztimer.h"
+#  define SCHEDSTAT_TICKS_PER_SEC   US_PER_SEC
+#endif
 
 /**
  * When core_idle_thread is not active, the KERNEL_PID_UNDEF is used to track
@@ -32,30 +49,107 @@
  */
 schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 
+static inline uint32_t _now(void)
+{
+#if SCHEDSTAT_DWT
+    return DWT->CYCCNT;
+#elif SCHEDSTAT_MONOTONIC
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * US_PER_SEC + ts.tv_nsec / NS_PER_US;
+#else
+    return ztimer_now(ZTIMER_USEC);
+#endif
+}
+
+static uint64_t _ticks_to_us(uint64_t ticks)
+{
+    if (SCHEDSTAT_TICKS_PER_SEC == US_PER_SEC) {
+        return ticks;
+    }
+    return (ticks / SCHEDSTAT_TICKS_PER_SEC) * US_PER_SEC
+           + ((ticks % SCHEDSTAT_TICKS_PER_SEC) * US_PER_SEC)
+             / SCHEDSTAT_TICKS_PER_SEC;
+}
+
 void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
 {
-    uint32_t now = ztimer_now(ZTIMER_USEC);
+    uint32_t now = _now();
 
     /* Update active thread stats */
     if (!IS_USED(MODULE_CORE_IDLE_THREAD) || active_thread != KERNEL_PID_UNDEF) {
         schedstat_t *active_stat = &sched_pidlist[active_thread];
-        active_stat->runtime_us += now - active_stat->laststart;
+        active_stat->runtime += now - active_stat->laststart;
+        active_stat->laststart = now;
+
+        thread_t *thread = thread_get(active_thread);
+        if (thread) {
+            /* sched_run() already changed the status of a still runnable
+             * thread from running to pending */
+            if (thread->status == STATUS_PENDING) {
+                active_stat->preemptions++;
+            }
+            active_stat->blocked_on = thread->status;
+        }
     }
 
     /* Update next_thread stats */
     if (!IS_USED(MODULE_CORE_IDLE_THREAD) || next_thread != KERNEL_PID_UNDEF) {
         schedstat_t *next_stat = &sched_pidlist[next_thread];
+        uint32_t waited = now - next_stat->laststart;
+
+        switch (next_stat->blocked_on) {
+        case STATUS_MUTEX_BLOCKED:
+            next_stat->mutex_wait += waited;
+            break;
+        case STATUS_RECEIVE_BLOCKED:
+        case STATUS_SEND_BLOCKED:
+        case STATUS_REPLY_BLOCKED:
+            next_stat->msg_wait += waited;
+            break;
+        default:
+            break;
+        }
+        next_stat->blocked_on = STATUS_RUNNING;
         next_stat->laststart = now;
         next_stat->schedules++;
     }
 }
 
+int schedstats_get(kernel_pid_t pid, schedstats_t *out)
+{
+    if ((pid < 0) || (pid > KERNEL_PID_LAST)) {
+        return -EINVAL;
+    }
+
+    unsigned state = irq_disable();
+    schedstat_t stat = sched_pidlist[pid];
+    irq_restore(state);
+
+    *out = (schedstats_t){
+        .runtime_us = _ticks_to_us(stat.runtime),
+        .mutex_wait_us = _ticks_to_us(stat.mutex_wait),
+        .msg_wait_us = _ticks_to_us(stat.msg_wait),
+        .schedules = stat.schedules,
+        .preemptions = stat.preemptions,
+    };
+
+    return 0;
+}
+
 void init_schedstatistics(void)
 {
+#if SCHEDSTAT_DWT
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
     /* Init laststart for the thread starting schedstatistics since the callback
        wasn't registered when it was first scheduled */
     schedstat_t *active_stat = &sched_pidlist[thread_getpid()];
-    active_stat->laststart = ztimer_now(ZTIMER_USEC);
+    active_stat->laststart = _now();
     active_stat->schedules = 1;
+    active_stat->blocked_on = STATUS_RUNNING;
     sched_register_cb(sched_statistics_cb);
 }
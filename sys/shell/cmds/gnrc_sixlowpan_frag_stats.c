@@ -30,7 +30,10 @@ static int _gnrc_6lo_frag_stats(int argc, char **argv)
     printf("rbuf full: %u\n", stats->rbuf_full);
     printf("frag full: %u\n", stats->frag_full);
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
-    printf("VRB full: %u\n", stats->vrb_full);
+    printf("VRB full: %u, evictions: %u\n", stats->vrb_full,
+           stats->vrb_evictions);
+    printf("VRB lookups: hits: %u, misses: %u\n", stats->vrb_hits,
+           stats->vrb_misses);
 #endif
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR_STATS
     gnrc_sixlowpan_frag_sfr_stats_t sfr;
@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to control the kernel event tracer
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ktrace.h"
+#include "shell.h"
+
+#define BYTES_PER_LINE  (32U)
+
+typedef struct {
+    uint8_t line[BYTES_PER_LINE];
+    unsigned pos;
+} _hexdump_t;
+
+static void _flush(_hexdump_t *hd)
+{
+    for (unsigned i = 0; i < hd->pos; i++) {
+        printf("%02x", hd->line[i]);
+    }
+    puts("");
+    hd->pos = 0;
+}
+
+static void _write(const void *data, size_t len, void *arg)
+{
+    _hexdump_t *hd = arg;
+    const uint8_t *bytes = data;
+
+    for (size_t i = 0; i < len; i++) {
+        hd->line[hd->pos++] = bytes[i];
+        if (hd->pos == BYTES_PER_LINE) {
+            _flush(hd);
+        }
+    }
+}
+
+static int _ktrace_handler(int argc, char **argv)
+{
+    if (argc != 2) {
+        goto usage;
+    }
+
+    if (!strcmp(argv[1], "start")) {
+        ktrace_start();
+    }
+    else if (!strcmp(argv[1], "stop")) {
+        ktrace_stop();
+    }
+    else if (!strcmp(argv[1], "reset")) {
+        ktrace_reset();
+    }
+    else if (!strcmp(argv[1], "dump")) {
+        _hexdump_t hd = { .pos = 0 };
+
+        puts("ktrace: begin");
+        ktrace_dump(_write, &hd);
+        if (hd.pos) {
+            _flush(&hd);
+        }
+        puts("ktrace: end");
+    }
+    else {
+        goto usage;
+    }
+
+    return 0;
+
+usage:
+    printf("usage: %s {start|stop|reset|dump}\n", argv[0]);
+    return 1;
+}
+
+SHELL_COMMAND(ktrace, "Control the kernel event tracer", _ktrace_handler);
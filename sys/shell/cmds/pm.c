@@ -20,18 +20,27 @@
  * @}
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "periph/pm.h"
 #include "shell.h"
+#include "time_units.h"
 
 #ifdef MODULE_PM_LAYERED
 #include "pm_layered.h"
 
 #endif /* MODULE_PM_LAYERED */
 
+#ifdef MODULE_PM_LAYERED_STATS
+static unsigned _permille(uint64_t part, uint64_t total)
+{
+    return total ? (part * 1000) / total : 0;
+}
+#endif /* MODULE_PM_LAYERED_STATS */
+
 static void _print_usage(void) {
     puts("Usage:");
 #ifdef MODULE_PM_LAYERED
@@ -40,6 +49,9 @@ static void _print_usage(void) {
     puts("\tpm block <mode>: manually block power mode");
     puts("\tpm unblock <mode>: manually unblock power mode");
 #endif /* MODULE_PM_LAYERED */
+#ifdef MODULE_PM_LAYERED_STATS
+    puts("\tpm stats [reset]: display or reset time spent per power mode");
+#endif /* MODULE_PM_LAYERED_STATS */
     puts("\tpm off: call pm_off()");
 }
 
@@ -140,6 +152,40 @@ static int cmd_show(char *arg)
 }
 #endif /* MODULE_PM_LAYERED */
 
+#ifdef MODULE_PM_LAYERED_STATS
+static int cmd_stats(void)
+{
+    pm_stats_t stats;
+    uint64_t sleeping = 0;
+
+    pm_stats_get(&stats);
+
+    /* printf() might not support 64 bit integers, print milliseconds */
+    printf("period: %" PRIu32 " ms\n", (uint32_t)(stats.period_us / US_PER_MS));
+    for (unsigned i = 0; i < PM_NUM_MODES; i++) {
+        unsigned permille = _permille(stats.residency_us[i], stats.period_us);
+
+        sleeping += stats.residency_us[i];
+        printf("mode %u: %" PRIu32 " ms (%u.%u %%), %" PRIu32 " entries\n", i,
+               (uint32_t)(stats.residency_us[i] / US_PER_MS),
+               permille / 10, permille % 10, stats.entries[i]);
+    }
+    printf("active: %" PRIu32 " ms\n",
+           (uint32_t)((stats.period_us - sleeping) / US_PER_MS));
+
+    printf("wakeups: unknown %" PRIu32 ", ztimer %" PRIu32,
+           stats.wakeups[PM_WAKEUP_SRC_UNKNOWN],
+           stats.wakeups[PM_WAKEUP_SRC_ZTIMER]);
+    for (unsigned i = PM_WAKEUP_SRC_USER;
+         i < CONFIG_PM_LAYERED_STATS_WAKEUP_NUMOF; i++) {
+        printf(", src%u %" PRIu32, i, stats.wakeups[i]);
+    }
+    puts("");
+
+    return 0;
+}
+#endif /* MODULE_PM_LAYERED_STATS */
+
 static int cmd_off(char *arg)
 {
     (void)arg;
@@ -191,6 +237,21 @@ static int _pm_handler(int argc, char **argv)
     }
 #endif /* MODULE_PM_LAYERED */
 
+#ifdef MODULE_PM_LAYERED_STATS
+    if (!strcmp(argv[1], "stats")) {
+        if ((argc == 3) && !strcmp(argv[2], "reset")) {
+            pm_stats_reset();
+            return 0;
+        }
+        if (argc != 2) {
+            puts("usage: pm stats [reset]");
+            return 1;
+        }
+
+        return cmd_stats();
+    }
+#endif /* MODULE_PM_LAYERED_STATS */
+
     if (!strcmp(argv[1], "off")) {
         return cmd_off(NULL);
     }
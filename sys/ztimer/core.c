@@ -28,10 +28,13 @@
 
 #include "kernel_defines.h"
 #include "irq.h"
-#if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
+#if (MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND) || MODULE_PM_LAYERED_STATS
 #include "pm_layered.h"
 #endif
 #include "ztimer.h"
+#if MODULE_ZTIMER_HEAP
+#include "ztimer/heap.h"
+#endif
 #include "log.h"
 
 #define ENABLE_DEBUG 0
@@ -43,6 +46,27 @@ static void _ztimer_update(ztimer_clock_t *clock);
 static void _ztimer_print(const ztimer_clock_t *clock);
 static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock);
 
+static inline bool _uses_heap(const ztimer_clock_t *clock)
+{
+#if MODULE_ZTIMER_HEAP
+    return clock->heap;
+#else
+    (void)clock;
+    return false;
+#endif
+}
+
+/* returns the offset of the next timer to expire relative to the clock's base */
+static inline uint32_t _head_offset(const ztimer_clock_t *clock)
+{
+#if MODULE_ZTIMER_HEAP
+    if (clock->heap) {
+        return ztimer_heap_head_offset(clock);
+    }
+#endif
+    return clock->list.next->offset;
+}
+
 #ifdef MODULE_ZTIMER_EXTEND
 static inline uint32_t _min_u32(uint32_t a, uint32_t b)
 {
@@ -117,6 +141,11 @@ static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
     if (!clock->list.next) {
         return 0;
     }
+#if MODULE_ZTIMER_HEAP
+    else if (clock->heap) {
+        return ztimer_heap_contains(clock, &t->base);
+    }
+#endif
     else {
         return (t->base.next || &t->base == clock->last);
     }
@@ -227,6 +256,13 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
     }
 #endif
 
+#if MODULE_ZTIMER_HEAP
+    if (clock->heap) {
+        ztimer_heap_add(clock, entry);
+        return;
+    }
+#endif
+
     /* Jump past all entries which are set to an earlier target than the new entry */
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
@@ -291,6 +327,13 @@ static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock)
 
     ztimer_base_t *entry = clock->list.next;
 
+#if MODULE_ZTIMER_HEAP
+    if (clock->heap) {
+        ztimer_heap_advance(clock, diff);
+        entry = NULL;
+    }
+#endif
+
     DEBUG(
         "clock %p: _ztimer_update_head_offset(): diff=%" PRIu32 " old head %p\n",
         (void *)clock, diff, (void *)entry);
@@ -335,7 +378,15 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
     assert(_is_set(clock, (ztimer_t *)entry));
 
-    while (list->next) {
+#if MODULE_ZTIMER_HEAP
+    if (clock->heap) {
+        ztimer_heap_del(clock, entry);
+        was_removed = true;
+        list = NULL;
+    }
+#endif
+
+    while (list && list->next) {
         ztimer_base_t *list_entry = list->next;
         if (list_entry == entry) {
             if (entry == clock->last) {
@@ -371,6 +422,19 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
 static ztimer_t *_now_next(ztimer_clock_t *clock)
 {
+#if MODULE_ZTIMER_HEAP
+    if (clock->heap) {
+        ztimer_base_t *entry = ztimer_heap_pop_expired(clock);
+#  if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
+        if (entry && !clock->list.next &&
+            clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+            pm_unblock(clock->block_pm_mode);
+        }
+#  endif
+        return (ztimer_t *)entry;
+    }
+#endif
+
     ztimer_base_t *entry = clock->list.next;
 
     if (entry && (entry->offset == 0)) {
@@ -401,7 +465,7 @@ static void _ztimer_update(ztimer_clock_t *clock)
     if (clock->max_value < UINT32_MAX) {
         if (clock->list.next) {
             clock->ops->set(clock,
-                            _min_u32(clock->list.next->offset,
+                            _min_u32(_head_offset(clock),
                                      clock->max_value >> 1));
         }
         else {
@@ -413,7 +477,7 @@ static void _ztimer_update(ztimer_clock_t *clock)
     }
     else {
         if (clock->list.next) {
-            clock->ops->set(clock, clock->list.next->offset);
+            clock->ops->set(clock, _head_offset(clock));
         }
         else {
             clock->ops->cancel(clock);
@@ -425,6 +489,10 @@ void ztimer_handler(ztimer_clock_t *clock)
 {
     bool no_clock_user_left = false;
 
+#if MODULE_PM_LAYERED_STATS
+    pm_stats_wakeup(PM_WAKEUP_SRC_ZTIMER);
+#endif
+
     DEBUG("ztimer_handler(): %p now=%" PRIu32 "\n", (void *)clock, clock->ops->now(
               clock));
     if (IS_ACTIVE(ENABLE_DEBUG)) {
@@ -437,7 +505,7 @@ void ztimer_handler(ztimer_clock_t *clock)
         uint32_t now = ztimer_now(clock);
 
         if (clock->list.next) {
-            uint32_t target = clock->list.offset + clock->list.next->offset;
+            uint32_t target = clock->list.offset + _head_offset(clock);
             int32_t diff = (int32_t)(target - now);
             if (diff > 0) {
                 DEBUG("ztimer_handler(): %p postponing by %" PRIi32 "\n",
@@ -462,8 +530,17 @@ void ztimer_handler(ztimer_clock_t *clock)
 #endif
 
     if (clock->list.next) {
-        clock->list.offset += clock->list.next->offset;
-        clock->list.next->offset = 0;
+        uint32_t head_offset = _head_offset(clock);
+
+        clock->list.offset += head_offset;
+        if (_uses_heap(clock)) {
+#if MODULE_ZTIMER_HEAP
+            ztimer_heap_advance(clock, head_offset);
+#endif
+        }
+        else {
+            clock->list.next->offset = 0;
+        }
 
         ztimer_t *entry = _now_next(clock);
         while (entry) {
@@ -506,6 +583,14 @@ static void _ztimer_print(const ztimer_clock_t *clock)
     const ztimer_base_t *entry = &clock->list;
     uint32_t last_offset = 0;
 
+    if (_uses_heap(clock)) {
+        /* only the heap's root is in order */
+        printf("0x%08" PRIxPTR ":%" PRIu32 " heap root 0x%08" PRIxPTR ":%" PRIu32 "\n",
+               (uintptr_t)entry, entry->offset, (uintptr_t)entry->next,
+               entry->next ? _head_offset(clock) : 0);
+        return;
+    }
+
     do {
         printf("0x%08" PRIxPTR ":%" PRIu32 "(%" PRIu32 ")%s", (uintptr_t)entry,
                entry->offset, entry->offset +
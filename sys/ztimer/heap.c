@@ -0,0 +1,236 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_ztimer_heap
+ * @{
+ *
+ * @file
+ * @brief       ztimer pairing heap timer queue implementation
+ *
+ * On heap clocks, `clock->list.next` points to the root of a pairing heap.
+ * Within the heap, `ztimer_base_t::next` links siblings, `child` points to the
+ * leftmost child and `prev` to either the left sibling or, for the leftmost
+ * child, the parent. `offset` holds the absolute target of a timer, counted
+ * from an epoch that lies `clock->heap_elapsed` ticks before the clock's base.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdint.h>
+
+#include "irq.h"
+#include "ztimer.h"
+#include "ztimer/heap.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* rebase all keys once the epoch becomes older than this */
+#define REBASE_THRESHOLD    (1LU << 31)
+
+static ztimer_base_t *_meld(ztimer_base_t *a, ztimer_base_t *b)
+{
+    if (!a) {
+        return b;
+    }
+    if (!b) {
+        return a;
+    }
+    if (b->offset < a->offset) {
+        ztimer_base_t *tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    /* make b the leftmost child of a */
+    b->prev = a;
+    b->next = a->child;
+    if (a->child) {
+        a->child->prev = b;
+    }
+    a->child = b;
+
+    return a;
+}
+
+static ztimer_base_t *_merge_pairs(ztimer_base_t *first)
+{
+    ztimer_base_t *pairs = NULL;
+
+    /* first pass: meld siblings pairwise from left to right, collecting
+     * the results in reverse order */
+    while (first) {
+        ztimer_base_t *a = first;
+        ztimer_base_t *b = a->next;
+
+        first = b ? b->next : NULL;
+        a->next = a->prev = NULL;
+        if (b) {
+            b->next = b->prev = NULL;
+        }
+        a = _meld(a, b);
+        a->next = pairs;
+        pairs = a;
+    }
+
+    /* second pass: meld the results from right to left */
+    ztimer_base_t *root = NULL;
+    while (pairs) {
+        ztimer_base_t *next = pairs->next;
+        pairs->next = NULL;
+        root = _meld(root, pairs);
+        pairs = next;
+    }
+
+    return root;
+}
+
+static void _rebase(ztimer_clock_t *clock)
+{
+    uint32_t elapsed = clock->heap_elapsed;
+    ztimer_base_t *node = clock->list.next;
+
+    DEBUG("ztimer_heap: %p rebasing by %" PRIu32 "\n", (void *)clock, elapsed);
+
+    /* Subtracting the same value from all keys keeps the heap ordered. Keys
+     * that have already expired are clamped to zero, which is fine as their
+     * ancestors have expired as well. */
+    while (node) {
+        node->offset = (node->offset > elapsed) ? node->offset - elapsed : 0;
+        if (node->child) {
+            node = node->child;
+            continue;
+        }
+        /* climb up until there is a right sibling to continue with */
+        while (node && !node->next) {
+            while (node->prev && node->prev->child != node) {
+                node = node->prev;
+            }
+            node = node->prev;
+        }
+        if (node) {
+            node = node->next;
+        }
+    }
+
+    clock->heap_elapsed = 0;
+}
+
+void ztimer_heap_add(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    if (!clock->list.next) {
+        /* heap is empty, move the epoch to the current base */
+        clock->heap_elapsed = 0;
+    }
+    else if (entry->offset > UINT32_MAX - clock->heap_elapsed) {
+        _rebase(clock);
+    }
+
+    entry->offset += clock->heap_elapsed;
+    entry->next = entry->prev = entry->child = NULL;
+    clock->list.next = _meld(clock->list.next, entry);
+
+    DEBUG("ztimer_heap_add() %p key %" PRIu32 "\n", (void *)entry,
+          entry->offset);
+}
+
+void ztimer_heap_del(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    assert(ztimer_heap_contains(clock, entry));
+
+    ztimer_base_t *sub = _merge_pairs(entry->child);
+
+    if (entry == clock->list.next) {
+        clock->list.next = sub;
+    }
+    else {
+        /* cut entry out of its sibling list */
+        if (entry->prev->child == entry) {
+            entry->prev->child = entry->next;
+        }
+        else {
+            entry->prev->next = entry->next;
+        }
+        if (entry->next) {
+            entry->next->prev = entry->prev;
+        }
+        clock->list.next = _meld(clock->list.next, sub);
+    }
+
+    /* reset the entry's pointers so ztimer_is_set() considers it unset */
+    entry->next = entry->prev = entry->child = NULL;
+}
+
+ztimer_base_t *ztimer_heap_pop_expired(ztimer_clock_t *clock)
+{
+    ztimer_base_t *root = clock->list.next;
+
+    if (!root || (ztimer_heap_head_offset(clock) != 0)) {
+        return NULL;
+    }
+
+    clock->list.next = _merge_pairs(root->child);
+    root->child = NULL;
+
+    return root;
+}
+
+uint32_t ztimer_heap_head_offset(const ztimer_clock_t *clock)
+{
+    const ztimer_base_t *root = clock->list.next;
+
+    assert(root);
+
+    return (root->offset > clock->heap_elapsed)
+           ? root->offset - clock->heap_elapsed
+           : 0;
+}
+
+void ztimer_heap_advance(ztimer_clock_t *clock, uint32_t diff)
+{
+    if (!clock->list.next) {
+        clock->heap_elapsed = 0;
+        return;
+    }
+
+    if (diff > UINT32_MAX - clock->heap_elapsed) {
+        /* the epoch is reset to the current base by rebasing */
+        _rebase(clock);
+    }
+    clock->heap_elapsed += diff;
+
+    if (clock->heap_elapsed >= REBASE_THRESHOLD) {
+        _rebase(clock);
+    }
+}
+
+void ztimer_clock_use_heap(ztimer_clock_t *clock)
+{
+    unsigned state = irq_disable();
+
+    if (!clock->heap) {
+        ztimer_base_t *entry = clock->list.next;
+        uint32_t target = 0;
+
+        clock->list.next = NULL;
+        clock->last = NULL;
+        clock->heap = true;
+
+        /* move all timers over, converting their delta encoded offsets */
+        while (entry) {
+            ztimer_base_t *next = entry->next;
+
+            target += entry->offset;
+            entry->offset = target;
+            ztimer_heap_add(clock, entry);
+            entry = next;
+        }
+    }
+
+    irq_restore(state);
+}
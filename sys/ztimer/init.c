@@ -51,6 +51,9 @@
 #include "ztimer/periph_rtt.h"
 #include "ztimer/periph_rtc.h"
 #include "ztimer/config.h"
+#if MODULE_ZTIMER_HEAP
+#include "ztimer/heap.h"
+#endif
 
 /* both 'stdio_rtt' and 'stdio_semihosting' rely on ztimer for stdio output,
    so not output is possible before 'ztimer' has been initiated, silence all
@@ -448,4 +451,26 @@ void ztimer_init(void)
                              FREQ_1HZ, ZTIMER_SEC_CONVERT_LOWER_FREQ);
 #  endif
 #endif
+
+/* Step 6: select timer queue implementation of ztimers requested */
+#if MODULE_ZTIMER_HEAP
+#  if MODULE_ZTIMER_USEC
+    if (CONFIG_ZTIMER_USEC_HEAP) {
+        LOG_DEBUG("ztimer_init(): ZTIMER_USEC using heap\n");
+        ztimer_clock_use_heap(ZTIMER_USEC);
+    }
+#  endif
+#  if MODULE_ZTIMER_MSEC
+    if (CONFIG_ZTIMER_MSEC_HEAP) {
+        LOG_DEBUG("ztimer_init(): ZTIMER_MSEC using heap\n");
+        ztimer_clock_use_heap(ZTIMER_MSEC);
+    }
+#  endif
+#  if MODULE_ZTIMER_SEC
+    if (CONFIG_ZTIMER_SEC_HEAP) {
+        LOG_DEBUG("ztimer_init(): ZTIMER_SEC using heap\n");
+        ztimer_clock_use_heap(ZTIMER_SEC);
+    }
+#  endif
+#endif
 }
@@ -0,0 +1,157 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       FIB lookup benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "net/fib.h"
+#include "net/ipv6/addr.h"
+#include "random.h"
+#include "ztimer.h"
+
+#ifndef ITERATIONS
+#define ITERATIONS          (100000U)
+#endif
+
+#define IFACE               (1U)
+#define PREFIXES_NUMOF      (4U)
+/* the use count of a universal address is limited to 255 routes */
+#define NEXT_HOPS_NUMOF     (16U)
+#define LIFETIME_MS         (3600U * 1000U)
+/* host routes, prefix routes and the default route */
+#define FIB_NUMOF           (ROUTES_NUMOF + PREFIXES_NUMOF + 1)
+
+/* fixed seed, so runs are comparable */
+#define SEED                (0x7f4a7c15U)
+
+static fib_entry_t _entries[FIB_NUMOF];
+static fib_table_t _fib = { .data.entries = _entries,
+                            .table_type = FIB_TABLE_TYPE_SH,
+                            .size = FIB_NUMOF };
+
+/* 2001:db8:0:<i % PREFIXES_NUMOF>::/64 */
+static void _prefix(ipv6_addr_t *addr, unsigned i)
+{
+    ipv6_addr_set_unspecified(addr);
+    addr->u8[0] = 0x20;
+    addr->u8[1] = 0x01;
+    addr->u8[2] = 0x0d;
+    addr->u8[3] = 0xb8;
+    addr->u8[7] = i % PREFIXES_NUMOF;
+}
+
+static void _route(ipv6_addr_t *addr, unsigned i)
+{
+    _prefix(addr, i);
+    /* spread the routes, like the IIDs of the nodes */
+    addr->u32[2].u32 = i * 0x9e3779b9;
+    addr->u32[3].u32 = i + 1;
+}
+
+/* fe80::<i % NEXT_HOPS_NUMOF + 1> */
+static void _next_hop(ipv6_addr_t *addr, unsigned i)
+{
+    ipv6_addr_set_unspecified(addr);
+    addr->u8[0] = 0xfe;
+    addr->u8[1] = 0x80;
+    addr->u8[15] = (i % NEXT_HOPS_NUMOF) + 1;
+}
+
+static int _add(ipv6_addr_t *dst, unsigned prefix_len, unsigned i)
+{
+    ipv6_addr_t next_hop;
+
+    _next_hop(&next_hop, i);
+    return fib_add_entry(&_fib, IFACE, dst->u8, sizeof(*dst),
+                         prefix_len << FIB_FLAG_NET_PREFIX_SHIFT,
+                         next_hop.u8, sizeof(next_hop), 0, LIFETIME_MS);
+}
+
+static int _bench(unsigned numof)
+{
+    ipv6_addr_t dst, next_hop;
+    kernel_pid_t iface;
+    uint32_t flags;
+    uint32_t start, lookup, refresh;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        size_t next_hop_size = sizeof(next_hop);
+        uint32_t r = random_uint32();
+
+        /* every other destination has no host route */
+        _route(&dst, (r & 1) ? ((r >> 1) % numof) : (numof + (r >> 1) % numof));
+        if (fib_get_next_hop(&_fib, &iface, next_hop.u8, &next_hop_size,
+                             &flags, dst.u8, sizeof(dst), 0) < 0) {
+            return -1;
+        }
+    }
+    lookup = ztimer_now(ZTIMER_USEC) - start;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        unsigned route = random_uint32_range(0, numof);
+
+        _route(&dst, route);
+        _next_hop(&next_hop, route);
+        if (fib_update_entry(&_fib, dst.u8, sizeof(dst), next_hop.u8,
+                             sizeof(next_hop), 0, LIFETIME_MS) < 0) {
+            return -1;
+        }
+    }
+    refresh = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("{ \"routes\" : %u, \"lookup\" : %" PRIu32 ", \"refresh\" : %" PRIu32
+           " }\n", numof, (uint32_t)(((uint64_t)lookup * 1000) / ITERATIONS),
+           (uint32_t)(((uint64_t)refresh * 1000) / ITERATIONS));
+    return 0;
+}
+
+int main(void)
+{
+    ipv6_addr_t dst;
+    unsigned numof = 0;
+
+    random_init(SEED);
+
+    printf("FIB benchmark (%s)\n",
+           IS_USED(MODULE_FIB_INDEXED) ? "indexed" : "linear");
+
+    fib_init(&_fib);
+    ipv6_addr_set_unspecified(&dst);
+    _add(&dst, 0, 0);
+    for (unsigned i = 0; i < PREFIXES_NUMOF; i++) {
+        _prefix(&dst, i);
+        _add(&dst, 64, i);
+    }
+    for (unsigned target = 16; numof < ROUTES_NUMOF; target *= 4) {
+        for (; (numof < target) && (numof < ROUTES_NUMOF); numof++) {
+            _route(&dst, numof);
+            if (_add(&dst, IPV6_ADDR_BIT_LEN, numof) < 0) {
+                puts("FAILURE");
+                return 1;
+            }
+        }
+        if (_bench(numof) < 0) {
+            puts("FAILURE");
+            return 1;
+        }
+    }
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,152 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       GNRC IPv6 destination cache benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ethernet.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/netdev_test.h"
+#include "net/sock/udp.h"
+#include "ztimer.h"
+
+#ifndef ITERATIONS
+#define ITERATIONS          (10000U)
+#endif
+
+#define PORT                (12345U)
+
+static const unsigned _destinations[] = { 1, 4, 8, 32 };
+static const uint8_t _router_l2addr[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    return iolist_size(iolist);
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    static const uint8_t addr[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+
+    (void)dev;
+    (void)max_len;
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+static int _setup(void)
+{
+    ipv6_addr_t addr;
+
+    netdev_test_setup(&_netdev, 0);
+    netdev_test_set_send_cb(&_netdev, _send);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    if (gnrc_netif_ethernet_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                   GNRC_NETIF_PRIO, "bench_eth",
+                                   &_netdev.netdev.netdev) < 0) {
+        return -1;
+    }
+    /* a global address to send from */
+    ipv6_addr_from_str(&addr, "2001:db8::1");
+    if (gnrc_netif_ipv6_addr_add(&_netif, &addr, 64,
+                                 GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) < 0) {
+        return -1;
+    }
+    /* the default router is a known neighbor, so no neighbor discovery is
+     * needed */
+    ipv6_addr_from_str(&addr, "fe80::2");
+    if ((gnrc_ipv6_nib_nc_set(&addr, _netif.pid, _router_l2addr,
+                              sizeof(_router_l2addr)) < 0) ||
+        (gnrc_ipv6_nib_ft_add(NULL, 0, &addr, _netif.pid, 0) < 0)) {
+        return -1;
+    }
+    return 0;
+}
+
+static int _bench(sock_udp_t *sock, unsigned numof)
+{
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = PORT };
+    ipv6_addr_t *dst = (ipv6_addr_t *)&remote.addr.ipv6;
+    uint8_t buf[8] = { 0 };
+    uint32_t start, send;
+
+    ipv6_addr_from_str(dst, "2001:db8:1::");
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        /* off-link destinations in turn */
+        dst->u8[15] = i % numof;
+        if (sock_udp_send(sock, buf, sizeof(buf), &remote) < 0) {
+            return -1;
+        }
+    }
+    send = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("{ \"destinations\" : %u, \"send\" : %" PRIu32 " }\n", numof,
+           (uint32_t)(((uint64_t)send * 1000) / ITERATIONS));
+    return 0;
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = { .family = AF_INET6, .port = PORT };
+    sock_udp_t sock;
+
+    printf("GNRC IPv6 destination cache benchmark (%u entries)\n",
+           (unsigned)CONFIG_GNRC_IPV6_DST_CACHE_SIZE);
+
+    if ((_setup() < 0) || (sock_udp_create(&sock, &local, NULL, 0) < 0)) {
+        puts("FAILURE");
+        return 1;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_destinations); i++) {
+        if (_bench(&sock, _destinations[i]) < 0) {
+            puts("FAILURE");
+            return 1;
+        }
+    }
+
+    puts("SUCCESS");
+
+    return 0;
+}
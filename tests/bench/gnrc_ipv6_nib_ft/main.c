@@ -0,0 +1,101 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       NIB forwarding table lookup benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "random.h"
+#include "ztimer.h"
+
+#ifndef ITERATIONS
+#define ITERATIONS          (100000U)
+#endif
+
+#define IFACE               (1U)
+/* one off-link entry is used by the prefix route */
+#define ROUTES_MAX          (CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF - 1)
+
+/* downward routes of a RPL non-storing root: host routes in one prefix */
+/* fixed seed, so runs are comparable */
+#define SEED                (0x7f4a7c15U)
+
+static const ipv6_addr_t _pfx = { .u8 = { 0x20, 0x01, 0x0d, 0xb8 } };
+static const ipv6_addr_t _next_hop = { .u8 = { 0xfe, 0x80, [15] = 0x01 } };
+
+static void _route(ipv6_addr_t *addr, unsigned i)
+{
+    *addr = _pfx;
+    /* spread the routes, like the IIDs of the nodes */
+    addr->u32[2].u32 = i * 0x9e3779b9;
+    addr->u32[3].u32 = i + 1;
+}
+
+static int _bench(unsigned numof)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    ipv6_addr_t dst;
+    uint32_t start, time;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        _route(&dst, random_uint32_range(0, numof));
+        if ((gnrc_ipv6_nib_ft_get(&dst, NULL, &fte) < 0) ||
+            (fte.dst_len != IPV6_ADDR_BIT_LEN)) {
+            return -1;
+        }
+    }
+    time = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("{ \"routes\" : %u, \"lookup\" : %" PRIu32 " }\n",
+           numof, (uint32_t)(((uint64_t)time * 1000) / ITERATIONS));
+    return 0;
+}
+
+int main(void)
+{
+    unsigned numof = 0;
+
+    random_init(SEED);
+
+    printf("NIB forwarding table benchmark (%s)\n",
+           CONFIG_GNRC_IPV6_NIB_OFFL_TRIE ? "trie" : "linear");
+
+    gnrc_ipv6_nib_init();
+    /* the prefix itself, which all lookups also match */
+    gnrc_ipv6_nib_ft_add(&_pfx, 64, &_next_hop, IFACE, 0);
+    for (unsigned target = 16; numof < ROUTES_MAX; target *= 4) {
+        for (; (numof < target) && (numof < ROUTES_MAX); numof++) {
+            ipv6_addr_t dst;
+
+            _route(&dst, numof);
+            if (gnrc_ipv6_nib_ft_add(&dst, IPV6_ADDR_BIT_LEN, &_next_hop,
+                                     IFACE, 0) < 0) {
+                puts("FAILURE");
+                return 1;
+            }
+        }
+        if (_bench(numof) < 0) {
+            puts("FAILURE");
+            return 1;
+        }
+    }
+
+    puts("SUCCESS");
+
+    return 0;
+}
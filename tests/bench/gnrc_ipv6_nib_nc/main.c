@@ -0,0 +1,163 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       NIB neighbor cache lookup benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ethernet.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/netdev_test.h"
+#include "random.h"
+#include "ztimer.h"
+
+#ifndef ITERATIONS
+#define ITERATIONS          (100000U)
+#endif
+
+/* fixed seed, so runs are comparable */
+#define SEED                (0x7f4a7c15U)
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    static const uint8_t addr[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+
+    (void)dev;
+    (void)max_len;
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+static void _neighbor(ipv6_addr_t *addr, uint8_t *l2addr, unsigned i)
+{
+    /* spread the neighbors, like their link-layer addresses */
+    uint32_t id = i * 0x9e3779b9;
+
+    l2addr[0] = 0x02;
+    l2addr[1] = 0x00;
+    memcpy(&l2addr[2], &id, sizeof(id));
+    ipv6_addr_set_link_local_prefix(addr);
+    addr->u8[8] = l2addr[0] ^ 0x02;
+    addr->u8[9] = l2addr[1];
+    addr->u8[10] = l2addr[2];
+    addr->u8[11] = 0xff;
+    addr->u8[12] = 0xfe;
+    addr->u8[13] = l2addr[3];
+    addr->u8[14] = l2addr[4];
+    addr->u8[15] = l2addr[5];
+}
+
+static int _bench(unsigned numof)
+{
+    gnrc_ipv6_nib_nc_t nce;
+    ipv6_addr_t dst;
+    uint8_t l2addr[ETHERNET_ADDR_LEN];
+    uint32_t start, next_hop, by_l2addr;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        _neighbor(&dst, l2addr, random_uint32_range(0, numof));
+        if ((gnrc_ipv6_nib_get_next_hop_l2addr(&dst, &_netif, NULL,
+                                               &nce) < 0) ||
+            (memcmp(nce.l2addr, l2addr, sizeof(l2addr)) != 0)) {
+            return -1;
+        }
+    }
+    next_hop = ztimer_now(ZTIMER_USEC) - start;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        _neighbor(&dst, l2addr, random_uint32_range(0, numof));
+        if (!gnrc_ipv6_nib_nc_get_by_l2addr(0, l2addr, sizeof(l2addr), &nce) ||
+            !ipv6_addr_equal(&nce.ipv6, &dst)) {
+            return -1;
+        }
+    }
+    by_l2addr = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("{ \"neighbors\" : %u, \"next_hop\" : %" PRIu32 ", "
+           "\"by_l2addr\" : %" PRIu32 " }\n", numof,
+           (uint32_t)(((uint64_t)next_hop * 1000) / ITERATIONS),
+           (uint32_t)(((uint64_t)by_l2addr * 1000) / ITERATIONS));
+    return 0;
+}
+
+int main(void)
+{
+    unsigned numof = 0;
+
+    random_init(SEED);
+
+    printf("NIB neighbor cache benchmark (%s)\n",
+           CONFIG_GNRC_IPV6_NIB_NC_HASH ? "hash" : "linear");
+
+    netdev_test_setup(&_netdev, 0);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    if (gnrc_netif_ethernet_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                   GNRC_NETIF_PRIO, "bench_eth",
+                                   &_netdev.netdev.netdev) < 0) {
+        puts("FAILURE");
+        return 1;
+    }
+    for (unsigned target = 16; numof < CONFIG_GNRC_IPV6_NIB_NUMOF;
+         target *= 2) {
+        for (; (numof < target) && (numof < CONFIG_GNRC_IPV6_NIB_NUMOF);
+             numof++) {
+            ipv6_addr_t addr;
+            uint8_t l2addr[ETHERNET_ADDR_LEN];
+
+            _neighbor(&addr, l2addr, numof);
+            if (gnrc_ipv6_nib_nc_set(&addr, _netif.pid, l2addr,
+                                     sizeof(l2addr)) < 0) {
+                puts("FAILURE");
+                return 1;
+            }
+        }
+        if (_bench(numof) < 0) {
+            puts("FAILURE");
+            return 1;
+        }
+    }
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       GNRC single thread benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/sock/udp.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef ITERATIONS
+#define ITERATIONS          (10000U)
+#endif
+
+#define PORT                (12345U)
+
+static const char *_layers[] = { "udp", "ipv6", "6lo", "gnrc" };
+
+static bool _is_layer(const thread_t *thread)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_layers); i++) {
+        if (strcmp(thread_get_name(thread), _layers[i]) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = { .family = AF_INET6, .port = PORT };
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = PORT };
+    sock_udp_t sock;
+    uint8_t buf[8] = { 0 };
+    unsigned threads = 0;
+    size_t stack = 0, stack_used = 0;
+    uint32_t start, rtt;
+
+    printf("GNRC single thread benchmark (%s)\n",
+           IS_USED(MODULE_GNRC_NETAPI_SINGLE_THREAD) ? "single thread"
+                                                     : "thread per layer");
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+    if (sock_udp_create(&sock, &local, NULL, 0) < 0) {
+        puts("FAILURE");
+        return 1;
+    }
+
+    /* send a datagram down the stack and back up via the loopback address */
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        if ((sock_udp_send(&sock, buf, sizeof(buf), &remote) < 0) ||
+            (sock_udp_recv(&sock, buf, sizeof(buf), SOCK_NO_TIMEOUT, NULL) < 0)) {
+            puts("FAILURE");
+            return 1;
+        }
+    }
+    rtt = ztimer_now(ZTIMER_USEC) - start;
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        const thread_t *thread = thread_get(pid);
+
+        if ((thread != NULL) && _is_layer(thread)) {
+            threads++;
+            stack += thread_get_stacksize(thread);
+            stack_used += thread_get_stacksize(thread) -
+                          thread_measure_stack_free(thread);
+        }
+    }
+
+    printf("{ \"rtt\" : %" PRIu32 ", \"threads\" : %u, \"stack\" : %u, "
+           "\"stack_used\" : %u }\n",
+           (uint32_t)(((uint64_t)rtt * 1000) / ITERATIONS), threads,
+           (unsigned)stack, (unsigned)stack_used);
+
+    puts("SUCCESS");
+
+    return 0;
+}
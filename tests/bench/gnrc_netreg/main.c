@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       GNRC network protocol registry dispatch benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "container.h"
+#include "msg.h"
+#include "net/gnrc/netreg.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef ITERATIONS
+#define ITERATIONS          (100000U)
+#endif
+
+#define PORT_BASE           (49152U)
+
+static const unsigned _numof[] = { 1, 4, 16, 32, 64 };
+static gnrc_netreg_entry_t _entries[64];
+static msg_t _msg_queue[2];
+static unsigned _found;
+
+/* what gnrc_netapi_dispatch() does for a received datagram */
+static void _dispatch(uint32_t port)
+{
+    gnrc_netreg_acquire_shared();
+    if (gnrc_netreg_num(GNRC_NETTYPE_UDP, port) > 0) {
+        for (gnrc_netreg_entry_t *e = gnrc_netreg_lookup(GNRC_NETTYPE_UDP, port);
+             e != NULL; e = gnrc_netreg_getnext(e)) {
+            _found++;
+        }
+    }
+    gnrc_netreg_release_shared();
+}
+
+int main(void)
+{
+    /* only threads with a message queue may register */
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+
+    printf("gnrc_netreg benchmark (%s)\n",
+           IS_USED(MODULE_GNRC_NETREG_HASHED) ? "hashed" : "list");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_numof); i++) {
+        unsigned numof = _numof[i];
+        uint32_t start, time;
+
+        gnrc_netreg_init();
+        for (unsigned j = 0; j < numof; j++) {
+            gnrc_netreg_entry_init_pid(&_entries[j], PORT_BASE + j,
+                                       thread_getpid());
+            gnrc_netreg_register(GNRC_NETTYPE_UDP, &_entries[j]);
+        }
+
+        _found = 0;
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned j = 0; j < ITERATIONS; j++) {
+            _dispatch(PORT_BASE + (j % numof));
+        }
+        time = ztimer_now(ZTIMER_USEC) - start;
+
+        printf("{ \"registrations\" : %u, \"dispatch\" : %" PRIu32 " }\n",
+               numof, (uint32_t)(((uint64_t)time * 1000) / ITERATIONS));
+        if (_found != ITERATIONS) {
+            puts("FAILURE");
+            return 1;
+        }
+    }
+
+    puts("SUCCESS");
+
+    return 0;
+}
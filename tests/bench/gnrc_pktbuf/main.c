@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       GNRC packet buffer allocation benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "net/gnrc/pktbuf.h"
+#include "random.h"
+#include "ztimer.h"
+
+#ifndef ITERATIONS
+#define ITERATIONS          (100000U)
+#endif
+
+/* number of packets in flight */
+#define WINDOW              (4U)
+
+#define NETIF_HDR_SIZE      (24U)
+#define IPV6_HDR_SIZE       (40U)
+#define UDP_HDR_SIZE        (8U)
+#define MAX_FRAME_SIZE      (1280U)
+
+/* fixed seed, so runs are comparable */
+#define SEED                (0x7f4a7c15U)
+
+static gnrc_pktsnip_t *_window[WINDOW];
+static unsigned _ops;
+static unsigned _failed;
+
+/* mostly small frames with occasional full-MTU packets */
+static size_t _rand_size(size_t min)
+{
+    uint32_t r = random_uint32();
+    size_t max;
+
+    switch (r % 8) {
+    case 0:
+        max = MAX_FRAME_SIZE;
+        break;
+    case 1:
+    case 2:
+        max = 127;
+        break;
+    default:
+        max = 64;
+        break;
+    }
+    return min + ((r >> 3) % (max - min));
+}
+
+static gnrc_pktsnip_t *_add(gnrc_pktsnip_t *next, size_t size)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(next, NULL, size, GNRC_NETTYPE_UNDEF);
+
+    _ops++;
+    if (pkt == NULL) {
+        _failed++;
+        gnrc_pktbuf_release(next);
+    }
+    return pkt;
+}
+
+/* received frame: the layers mark their headers in the frame */
+static gnrc_pktsnip_t *_rx(void)
+{
+    gnrc_pktsnip_t *pkt = _add(NULL, _rand_size(IPV6_HDR_SIZE + UDP_HDR_SIZE));
+
+    if (pkt == NULL) {
+        return NULL;
+    }
+    if ((gnrc_pktbuf_mark(pkt, IPV6_HDR_SIZE, GNRC_NETTYPE_UNDEF) == NULL) ||
+        (gnrc_pktbuf_mark(pkt, UDP_HDR_SIZE, GNRC_NETTYPE_UNDEF) == NULL)) {
+        _failed++;
+    }
+    _ops += 2;
+    return _add(pkt, NETIF_HDR_SIZE);
+}
+
+/* sent packet: the layers prepend their headers to the payload */
+static gnrc_pktsnip_t *_tx(void)
+{
+    gnrc_pktsnip_t *pkt = _add(NULL, _rand_size(IPV6_HDR_SIZE + UDP_HDR_SIZE) -
+                                     IPV6_HDR_SIZE - UDP_HDR_SIZE + 1);
+
+    if ((pkt == NULL) || ((pkt = _add(pkt, UDP_HDR_SIZE)) == NULL)) {
+        return NULL;
+    }
+    if ((pkt = _add(pkt, IPV6_HDR_SIZE)) == NULL) {
+        return NULL;
+    }
+    return _add(pkt, NETIF_HDR_SIZE);
+}
+
+int main(void)
+{
+    uint32_t start, time;
+
+    random_init(SEED);
+
+    puts("gnrc_pktbuf benchmark");
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        unsigned slot = random_uint32_range(0, WINDOW);
+
+        gnrc_pktbuf_release(_window[slot]);
+        _ops++;
+        _window[slot] = (random_uint32() & 1) ? _rx() : _tx();
+    }
+    time = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("pktbuf latency: backend: %s, ops: %u, avg: %" PRIu32 " ns, failed: %u\n",
+           GNRC_PKTBUF_BACKEND, _ops,
+           (uint32_t)(((uint64_t)time * 1000) / _ops), _failed);
+
+#ifdef DEVELHELP
+    /* state with WINDOW packets in flight */
+    gnrc_pktbuf_stats();
+#endif
+    for (unsigned slot = 0; slot < WINDOW; slot++) {
+        gnrc_pktbuf_release(_window[slot]);
+    }
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,224 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       6LoWPAN header compression benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/sixlowpan/config.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/gnrc/udp.h"
+#include "net/ieee802154.h"
+#include "net/netdev_test.h"
+#include "ztimer.h"
+
+#ifndef ITERATIONS
+#define ITERATIONS          (10000U)
+#endif
+
+#define PORT                (5683U)
+
+static const uint8_t _l2addr[] = { 0x2a, 0xab, 0xdc, 0x15, 0x54, 0x01, 0x64, 0x79 };
+static const uint8_t _dst_l2addr[] = { 0x5a, 0x9d, 0x93, 0x86, 0x22, 0x08, 0x65, 0x79 };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static uint8_t _ref[IEEE802154_FRAME_LEN_MAX];
+static size_t _ref_len;
+static unsigned _mismatches;
+static bool _check;
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    uint8_t frame[IEEE802154_FRAME_LEN_MAX];
+    size_t len = 0;
+
+    (void)dev;
+    if (!_check) {
+        return iolist_size(iolist);
+    }
+    /* skip the MAC header, its sequence number changes with every frame */
+    for (const iolist_t *ptr = iolist->iol_next; ptr != NULL;
+         ptr = ptr->iol_next) {
+        memcpy(&frame[len], ptr->iol_base, ptr->iol_len);
+        len += ptr->iol_len;
+    }
+    if (_ref_len == 0) {
+        memcpy(_ref, frame, len);
+        _ref_len = len;
+    }
+    else if ((len != _ref_len) || (memcmp(frame, _ref, len) != 0)) {
+        _mismatches++;
+    }
+    return iolist_size(iolist);
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = IEEE802154_FRAME_LEN_MAX;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = sizeof(_l2addr);
+    return sizeof(uint16_t);
+}
+
+static int _get_address_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    memcpy(value, _l2addr, sizeof(_l2addr));
+    return sizeof(_l2addr);
+}
+
+static void _addr(ipv6_addr_t *addr, const ipv6_addr_t *prefix,
+                  const uint8_t *l2addr)
+{
+    *addr = *prefix;
+    memcpy(&addr->u8[8], l2addr, 8);
+    addr->u8[8] ^= 0x02;
+}
+
+static gnrc_pktsnip_t *_build(const ipv6_addr_t *src, const ipv6_addr_t *dst)
+{
+    static const uint8_t payload[] = { 0x50, 0x01, 0x12, 0x34,
+                                       0xb1, 0x61, 0x62, 0x63 };
+    gnrc_pktsnip_t *pkt, *udp, *ipv6, *netif_hdr;
+    udp_hdr_t *udp_hdr;
+    ipv6_hdr_t *ipv6_hdr;
+
+    pkt = gnrc_pktbuf_add(NULL, payload, sizeof(payload), GNRC_NETTYPE_UNDEF);
+    udp = gnrc_udp_hdr_build(pkt, PORT, PORT);
+    ipv6 = gnrc_ipv6_hdr_build(udp, src, dst);
+    netif_hdr = gnrc_netif_hdr_build(NULL, 0, _dst_l2addr,
+                                     sizeof(_dst_l2addr));
+    if ((pkt == NULL) || (udp == NULL) || (ipv6 == NULL) ||
+        (netif_hdr == NULL)) {
+        return NULL;
+    }
+    udp_hdr = udp->data;
+    udp_hdr->length = byteorder_htons(gnrc_pkt_len(udp));
+    udp_hdr->checksum = byteorder_htons(0xcafe);
+    ipv6_hdr = ipv6->data;
+    ipv6_hdr->len = udp_hdr->length;
+    ipv6_hdr->nh = PROTNUM_UDP;
+    ipv6_hdr->hl = 64;
+    gnrc_netif_hdr_set_netif(netif_hdr->data, &_netif);
+    netif_hdr->next = ipv6;
+    return netif_hdr;
+}
+
+static int _bench(const char *flow, const ipv6_addr_t *prefix)
+{
+    ipv6_addr_t src, dst;
+    uint32_t start, send, raw;
+
+    _addr(&src, prefix, _l2addr);
+    _addr(&dst, prefix, _dst_l2addr);
+
+    /* send the datagrams uncompressed to get the time without IPHC */
+    _check = false;
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        gnrc_pktsnip_t *pkt = _build(&src, &dst);
+
+        if ((pkt == NULL) || (gnrc_netif_send(&_netif, pkt) < 1)) {
+            return -1;
+        }
+    }
+    raw = ztimer_now(ZTIMER_USEC) - start;
+
+    _check = true;
+    _ref_len = 0;
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        gnrc_pktsnip_t *pkt = _build(&src, &dst);
+
+        if (pkt == NULL) {
+            return -1;
+        }
+        gnrc_sixlowpan_iphc_send(pkt, NULL, 0);
+    }
+    send = ztimer_now(ZTIMER_USEC) - start;
+
+    if ((_ref_len == 0) || (_mismatches > 0)) {
+        return -1;
+    }
+    printf("{ \"flow\" : \"%s\", \"send\" : %" PRIu32 ", "
+           "\"encode\" : %" PRId32 " }\n", flow,
+           (uint32_t)(((uint64_t)send * 1000) / ITERATIONS),
+           (int32_t)(((int64_t)send - raw) * 1000 / ITERATIONS));
+    return 0;
+}
+
+int main(void)
+{
+    ipv6_addr_t link_local = IPV6_ADDR_LINK_LOCAL_PREFIX;
+    ipv6_addr_t global;
+
+    printf("6LoWPAN header compression benchmark (%u templates)\n",
+           (unsigned)CONFIG_GNRC_SIXLOWPAN_IPHC_TMPL_SIZE);
+
+    ipv6_addr_from_str(&global, "2001:db8::");
+    netdev_test_setup(&_netdev, 0);
+    netdev_test_set_send_cb(&_netdev, _send);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS_LONG, _get_address_long);
+    if ((gnrc_netif_ieee802154_create(&_netif, _netif_stack,
+                                      sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                      "bench_154", &_netdev.netdev.netdev) < 0) ||
+        (gnrc_sixlowpan_ctx_update(0, &global, 64, UINT16_MAX, true) == NULL) ||
+        (_bench("link_local", &link_local) < 0) ||
+        (_bench("context", &global) < 0)) {
+        puts("FAILURE");
+        return 1;
+    }
+
+    puts("SUCCESS");
+
+    return 0;
+}
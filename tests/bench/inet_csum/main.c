@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Internet checksum throughput benchmark
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "container.h"
+#include "net/inet_csum.h"
+#include "ztimer.h"
+
+/* number of bytes to checksum per measurement */
+#ifndef BYTES_PER_RUN
+#define BYTES_PER_RUN       (1024UL * 1024UL)
+#endif
+
+static const uint16_t _sizes[] = { 8, 40, 64, 128, 256, 512, 1280 };
+static uint8_t _buf[1280 + 1];
+
+/* the former implementation, summing up one 16 bit word per iteration */
+static uint16_t _csum_bytewise(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if (len & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+/* returns the throughput in bytes per ms */
+static uint32_t _run(uint16_t (*csum)(uint16_t, const uint8_t *, uint16_t),
+                     const uint8_t *buf, uint16_t size, uint16_t *result)
+{
+    unsigned runs = BYTES_PER_RUN / size;
+    uint16_t sum = 0;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < runs; i++) {
+        sum = csum(sum, buf, size);
+    }
+
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+    *result = sum;
+    return ((uint64_t)runs * size * 1000) / (time ? time : 1);
+}
+
+int main(void)
+{
+    bool equal = true;
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = (i * 167) + 13;
+    }
+
+    puts("Throughput in bytes per ms");
+    for (unsigned offset = 0; offset < 2; offset++) {
+        for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+            uint16_t res_bytewise, res_csum;
+            uint32_t bytewise = _run(_csum_bytewise, &_buf[offset], _sizes[i],
+                                     &res_bytewise);
+            uint32_t csum = _run(inet_csum, &_buf[offset], _sizes[i],
+                                 &res_csum);
+
+            printf("{ \"size\" : %u, \"offset\" : %u, \"bytewise\" : %" PRIu32
+                   ", \"inet_csum\" : %" PRIu32 " }\n",
+                   _sizes[i], offset, bytewise, csum);
+            equal = equal && (res_bytewise == res_csum);
+        }
+    }
+
+    puts(equal ? "SUCCESS" : "FAILURE");
+
+    return 0;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+SIZES = (8, 40, 64, 128, 256, 512, 1280)
+
+
+def testfunc(child):
+    for offset in (0, 1):
+        for size in SIZES:
+            child.expect(r"{ \"size\" : %d, \"offset\" : %d, "
+                         r"\"bytewise\" : \d+, \"inet_csum\" : \d+ }"
+                         % (size, offset))
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
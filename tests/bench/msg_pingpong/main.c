@@ -29,7 +29,14 @@
 #define TEST_DURATION_US    (1000000U)
 #endif
 
+#ifndef QUEUE_SIZE
+#define QUEUE_SIZE          (16U)
+#endif
+
 static char _stack[THREAD_STACKSIZE_MAIN];
+static char _queued_stack[THREAD_STACKSIZE_MAIN];
+static msg_t _queue[QUEUE_SIZE];
+static kernel_pid_t _main_pid;
 
 static void _timer_callback(void *_flag)
 {
@@ -49,6 +56,37 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
+static void *_queued_thread(void *arg)
+{
+    (void)arg;
+
+#if MODULE_CORE_MSG_SPSC
+    msg_init_queue_spsc(_queue, QUEUE_SIZE);
+#else
+    msg_init_queue(_queue, QUEUE_SIZE);
+#endif
+
+    while (1) {
+        /* queue is empty, let the sender (re)fill it */
+        thread_wakeup(_main_pid);
+
+        msg_t test;
+        do {
+            msg_receive(&test);
+        } while (msg_avail());
+    }
+
+    return NULL;
+}
+
+static void _print_result(const char *name, uint32_t n)
+{
+    printf("{ \"%s\" : %"PRIu32, name, n);
+    printf(", \"ticks\" : %"PRIu32,
+           (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n);
+    puts(" }");
+}
+
 int main(void)
 {
     puts("main starting");
@@ -78,10 +116,38 @@ int main(void)
         n++;
     }
 
-    printf("{ \"result\" : %"PRIu32, n);
-    printf(", \"ticks\" : %"PRIu32,
-           (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n);
-    puts(" }");
+    _print_result("result", n);
+
+    /* Second round: the receiver has a lower priority and a message queue, so
+     * messages are sent in bursts of QUEUE_SIZE without context switches in
+     * between. This measures the cost of the message queue itself. */
+    _main_pid = thread_getpid();
+    other = thread_create(_queued_stack,
+                          sizeof(_queued_stack),
+                          (THREAD_PRIORITY_MAIN + 1),
+                          0,
+                          _queued_thread,
+                          NULL,
+                          "queued_thread");
+    /* wait for the receiver to initialize its queue */
+    thread_sleep();
+    n = 0;
+
+    atomic_flag_test_and_set(&flag);
+    xtimer_set(&timer, TEST_DURATION_US);
+
+    while (atomic_flag_test_and_set(&flag)) {
+        msg_t test;
+        if (msg_try_send(&test, other) == 1) {
+            n++;
+        }
+        else {
+            /* queue is full, sleep until the receiver has drained it */
+            thread_sleep();
+        }
+    }
+
+    _print_result("result_queued", n);
 
     return 0;
 }
@@ -0,0 +1,166 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Reader-writer lock vs. mutex benchmark with 95/5 read/write mix
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "rwlock.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION
+#define TEST_DURATION       (1000000U)
+#endif
+
+#define WORKER_NUMOF        (4U)
+#define DATA_NUMOF          (8U)
+/* one write every WRITE_INTERVAL accesses, i.e. 5 % writes */
+#define WRITE_INTERVAL      (20U)
+
+typedef struct {
+    const char *name;
+    void (*rdlock)(void);
+    void (*rdunlock)(void);
+    void (*wrlock)(void);
+    void (*wrunlock)(void);
+} lock_ops_t;
+
+static char _stacks[WORKER_NUMOF][THREAD_STACKSIZE_SMALL];
+static volatile bool _stop;
+static uint32_t _accesses;
+static unsigned _inconsistent;
+static uint32_t _data[DATA_NUMOF];
+
+static mutex_t _mutex = MUTEX_INIT;
+static rwlock_t _rwlock = RWLOCK_INIT;
+
+static void _mutex_lock(void)
+{
+    mutex_lock(&_mutex);
+}
+
+static void _mutex_unlock(void)
+{
+    mutex_unlock(&_mutex);
+}
+
+static void _rwlock_rdlock(void)
+{
+    rwlock_rdlock(&_rwlock);
+}
+
+static void _rwlock_rdunlock(void)
+{
+    rwlock_rdunlock(&_rwlock);
+}
+
+static void _rwlock_wrlock(void)
+{
+    rwlock_wrlock(&_rwlock);
+}
+
+static void _rwlock_wrunlock(void)
+{
+    rwlock_wrunlock(&_rwlock);
+}
+
+static const lock_ops_t _locks[] = {
+    {
+        .name = "mutex",
+        .rdlock = _mutex_lock, .rdunlock = _mutex_unlock,
+        .wrlock = _mutex_lock, .wrunlock = _mutex_unlock,
+    },
+    {
+        .name = "rwlock",
+        .rdlock = _rwlock_rdlock, .rdunlock = _rwlock_rdunlock,
+        .wrlock = _rwlock_wrlock, .wrunlock = _rwlock_wrunlock,
+    },
+};
+
+static void _timer_callback(void *arg)
+{
+    (void)arg;
+
+    _stop = true;
+}
+
+static void *_worker(void *arg)
+{
+    const lock_ops_t *ops = arg;
+    /* spread the writes of the workers */
+    unsigned n = thread_getpid();
+
+    while (!_stop) {
+        if ((++n % WRITE_INTERVAL) == 0) {
+            ops->wrlock();
+            for (unsigned i = 0; i < DATA_NUMOF; i++) {
+                _data[i]++;
+            }
+            thread_yield();
+            ops->wrunlock();
+        }
+        else {
+            ops->rdlock();
+            uint32_t first = _data[0];
+            thread_yield();
+            for (unsigned i = 1; i < DATA_NUMOF; i++) {
+                if (_data[i] != first) {
+                    _inconsistent++;
+                }
+            }
+            ops->rdunlock();
+        }
+        _accesses++;
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    printf("main starting\n");
+
+    for (unsigned l = 0; l < ARRAY_SIZE(_locks); l++) {
+        ztimer_t timer = { .callback = _timer_callback };
+
+        _stop = false;
+        _accesses = 0;
+
+        for (unsigned i = 0; i < WORKER_NUMOF; i++) {
+            thread_create(_stacks[i], sizeof(_stacks[i]),
+                          THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_WOUT_YIELD,
+                          _worker, (void *)&_locks[l], "worker");
+        }
+
+        ztimer_set(ZTIMER_USEC, &timer, TEST_DURATION);
+        /* the workers keep running until the timer stops them and they
+         * exit, only then main gets scheduled again */
+        thread_yield_higher();
+
+        printf("{ \"lock\" : \"%s\", \"result\" : %" PRIu32 " }\n",
+               _locks[l].name, _accesses);
+    }
+
+    if (_inconsistent) {
+        puts("FAILURE: inconsistent data read");
+        return 1;
+    }
+
+    puts("SUCCESS");
+
+    return 0;
+}
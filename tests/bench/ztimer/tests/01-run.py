@@ -12,10 +12,10 @@ from testrunner import run
 
 def testfunc(child):
     child.expect_exact("ztimer benchmark application.\r\n")
-    for i in range(13):
-        child.expect(r"\s+[\w() _\+]+\s+\d+ / \d+ = \d+\r\n")
-
-    child.expect_exact("done.\r\n")
+    # the number of results depends on NUMOF_TIMERS
+    while child.expect([r"\s+[\w() _\+]+\s+\d+ / \d+ = \d+\r\n",
+                        r"done.\r\n"]) == 0:
+        pass
 
 
 if __name__ == "__main__":
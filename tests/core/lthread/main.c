@@ -0,0 +1,135 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for light threads
+ *
+ * Ten service light threads of two priorities share two stacks. A light
+ * thread of lower priority than main gets preempted by one of higher priority
+ * posted from an ISR.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "lthread.h"
+#include "mutex.h"
+#include "ztimer.h"
+
+#define SERVICE_NUMOF       (10U)
+#define PRIO_HIGH           (THREAD_PRIORITY_MAIN - 2)
+#define PRIO_MEDIUM         (THREAD_PRIORITY_MAIN - 1)
+#define PRIO_LOW            (THREAD_PRIORITY_MAIN + 1)
+
+static char _stack_high[THREAD_STACKSIZE_DEFAULT];
+static char _stack_medium[THREAD_STACKSIZE_DEFAULT];
+static char _stack_low[THREAD_STACKSIZE_DEFAULT];
+
+static lthread_t _services[SERVICE_NUMOF];
+static unsigned _runs[SERVICE_NUMOF];
+
+static lthread_t _low;
+static lthread_t _preempting;
+static mutex_t _done = MUTEX_INIT_LOCKED;
+static volatile bool _preempted;
+static bool _low_saw_preemption;
+
+static void _service(void *arg)
+{
+    unsigned idx = (uintptr_t)arg;
+
+    /* use some stack */
+    volatile uint8_t buf[64];
+    buf[sizeof(buf) - 1] = idx;
+    _runs[buf[sizeof(buf) - 1]]++;
+
+    /* post ourselves once, this must result in exactly one more run */
+    if (_runs[idx] == 1) {
+        lthread_post(&_services[idx]);
+    }
+}
+
+static void _preempting_func(void *arg)
+{
+    (void)arg;
+    _preempted = true;
+}
+
+static void _low_func(void *arg)
+{
+    (void)arg;
+
+    /* busy wait until preempted by a light thread posted from an ISR */
+    while (!_preempted) {}
+    _low_saw_preemption = true;
+    mutex_unlock(&_done);
+}
+
+static void _timer_cb(void *arg)
+{
+    (void)arg;
+    lthread_post(&_preempting);
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < SERVICE_NUMOF; i++) {
+        bool high = i < SERVICE_NUMOF / 2;
+        kernel_pid_t pid = lthread_create(&_services[i],
+                                          high ? _stack_high : _stack_medium,
+                                          sizeof(_stack_high),
+                                          high ? PRIO_HIGH : PRIO_MEDIUM,
+                                          _service, (void *)(uintptr_t)i,
+                                          "service");
+        if (pid < 0) {
+            puts("FAILURE: lthread_create()");
+            return 1;
+        }
+    }
+    lthread_create(&_low, _stack_low, sizeof(_stack_low), PRIO_LOW,
+                   _low_func, NULL, "low");
+    lthread_create(&_preempting, _stack_medium, sizeof(_stack_medium),
+                   PRIO_MEDIUM, _preempting_func, NULL, "preempting");
+
+    puts("posting services");
+    for (unsigned i = 0; i < SERVICE_NUMOF; i++) {
+        lthread_post(&_services[i]);
+    }
+    for (unsigned i = 0; i < SERVICE_NUMOF; i++) {
+        if (_runs[i] != 2) {
+            printf("FAILURE: service %u ran %u times\n", i, _runs[i]);
+            return 1;
+        }
+    }
+
+    puts("preempting a light thread from an ISR");
+    ztimer_t timer = { .callback = _timer_cb };
+    ztimer_set(ZTIMER_MSEC, &timer, 10);
+    lthread_post(&_low);
+    mutex_lock(&_done);
+    if (!_low_saw_preemption) {
+        puts("FAILURE: low priority light thread did not complete");
+        return 1;
+    }
+
+    /* 12 light threads use three stacks */
+    const char *stacks[] = { _stack_high, _stack_medium, _stack_low };
+    for (unsigned i = 0; i < ARRAY_SIZE(stacks); i++) {
+        printf("shared stack %u: %u of %u bytes used\n", i,
+               (unsigned)(sizeof(_stack_high)
+                          - measure_stack_free_internal(stacks[i],
+                                                        sizeof(_stack_high))),
+               (unsigned)sizeof(_stack_high));
+    }
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Test application for single producer message queues
+ *
+ * Sends a sequence of messages to a receiver with a lower priority, which
+ * makes the sender block on the full queue, and to a receiver with a higher
+ * priority, which has to be woken up for every message.
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
+
+#define QUEUE_SIZE      (4U)
+#define NUMOF_MSGS      (100U)
+#define NUMOF_RECEIVERS (2U)
+
+static char _stacks[NUMOF_RECEIVERS][THREAD_STACKSIZE_DEFAULT];
+static msg_t _queues[NUMOF_RECEIVERS][QUEUE_SIZE];
+static unsigned _received[NUMOF_RECEIVERS];
+static kernel_pid_t _main_pid;
+static bool _failed;
+
+static void *_receiver(void *arg)
+{
+    unsigned idx = (uintptr_t)arg;
+
+    msg_init_queue_spsc(_queues[idx], QUEUE_SIZE);
+
+    while (1) {
+        msg_t msg;
+        msg_receive(&msg);
+        if (msg.content.value != _received[idx]) {
+            printf("receiver %u: expected %u, got %u\n", idx, _received[idx],
+                   (unsigned)msg.content.value);
+            _failed = true;
+        }
+        if (++_received[idx] == NUMOF_MSGS) {
+            thread_wakeup(_main_pid);
+        }
+    }
+
+    return NULL;
+}
+
+static void _run(unsigned idx, uint8_t prio)
+{
+    kernel_pid_t pid = thread_create(_stacks[idx], sizeof(_stacks[idx]), prio,
+                                     0, _receiver, (void *)(uintptr_t)idx,
+                                     "receiver");
+
+    for (unsigned i = 0; i < NUMOF_MSGS; i++) {
+        msg_t msg = { .content.value = i };
+        msg_send(&msg, pid);
+    }
+
+    if (_received[idx] != NUMOF_MSGS) {
+        thread_sleep();
+    }
+    printf("receiver %u: got %u messages\n", idx, _received[idx]);
+}
+
+int main(void)
+{
+    _main_pid = thread_getpid();
+
+    puts("[START]");
+
+    _run(0, THREAD_PRIORITY_MAIN + 1);
+    _run(1, THREAD_PRIORITY_MAIN - 1);
+
+    if (_failed) {
+        puts("[FAILED]");
+        return 1;
+    }
+
+    puts("[SUCCESS]");
+    return 0;
+}
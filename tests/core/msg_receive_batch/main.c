@@ -0,0 +1,182 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Test application for receiving queued messages in a batch
+ *
+ * Fills the message queue of the main thread with messages to itself and
+ * receives them in batches of different sizes. Senders of a higher priority
+ * block on the full queue and have to be moved into the space a batch frees,
+ * a sender of a lower priority has to wake up a batch blocking on the empty
+ * queue.
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
+
+#define QUEUE_SIZE      (4U)
+#define NUMOF_SENDERS   (3U)
+#define SENDER_VALUE    (100U)
+#define REPLY_VALUE     (200U)
+
+static char _stacks[NUMOF_SENDERS][THREAD_STACKSIZE_DEFAULT];
+static msg_t _queue[QUEUE_SIZE];
+static kernel_pid_t _main_pid;
+static bool _sent[NUMOF_SENDERS];
+static uint32_t _reply;
+static bool _failed;
+
+static void _check(bool cond, const char *what)
+{
+    if (!cond) {
+        printf("failed: %s\n", what);
+        _failed = true;
+    }
+}
+
+static void *_sender(void *arg)
+{
+    unsigned idx = (uintptr_t)arg;
+    msg_t msg = { .content.value = SENDER_VALUE + idx };
+
+    msg_send(&msg, _main_pid);
+    _sent[idx] = true;
+
+    return NULL;
+}
+
+static void *_requester(void *arg)
+{
+    unsigned idx = (uintptr_t)arg;
+    msg_t msg = { .content.value = SENDER_VALUE + idx };
+    msg_t reply;
+
+    msg_send_receive(&msg, &reply, _main_pid);
+    _reply = reply.content.value;
+    _sent[idx] = true;
+
+    return NULL;
+}
+
+static kernel_pid_t _create(unsigned idx, uint8_t prio, thread_task_func_t task)
+{
+    return thread_create(_stacks[idx], sizeof(_stacks[idx]), prio, 0, task,
+                         (void *)(uintptr_t)idx, "sender");
+}
+
+static void _fill(uint32_t first)
+{
+    for (unsigned i = 0; i < QUEUE_SIZE; i++) {
+        msg_t msg = { .content.value = first + i };
+
+        msg_send_to_self(&msg);
+    }
+}
+
+static bool _check_values(const msg_t *msgs, unsigned numof, uint32_t first)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        if (msgs[i].content.value != first + i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void _test_fifo(void)
+{
+    msg_t msgs[2 * QUEUE_SIZE];
+
+    /* more space than queued messages */
+    _fill(0);
+    _check(msg_receive_batch(msgs, ARRAY_SIZE(msgs)) == QUEUE_SIZE,
+           "all queued messages received");
+    _check(_check_values(msgs, QUEUE_SIZE, 0), "order of a full queue");
+
+    /* less space than queued messages, continues where the last batch ended */
+    _fill(QUEUE_SIZE);
+    _check(msg_receive_batch(msgs, 1) == 1, "batch limited to one");
+    _check(_check_values(msgs, 1, QUEUE_SIZE), "order of a limited batch");
+    _check(msg_receive_batch(msgs, ARRAY_SIZE(msgs)) == QUEUE_SIZE - 1,
+           "rest of the queue received");
+    _check(_check_values(msgs, QUEUE_SIZE - 1, QUEUE_SIZE + 1),
+           "order of the rest of the queue");
+    _check(msg_avail() == 0, "queue empty");
+}
+
+static void _test_blocked_senders(void)
+{
+    msg_t msgs[2 * QUEUE_SIZE];
+    msg_t reply = { .content.value = REPLY_VALUE };
+
+    /* both senders preempt main and block on the full queue */
+    _fill(0);
+    _create(0, THREAD_PRIORITY_MAIN - 1, _sender);
+    kernel_pid_t requester = _create(1, THREAD_PRIORITY_MAIN - 1, _requester);
+    _check(!_sent[0] && !_sent[1], "senders blocked on the full queue");
+
+    /* the freed slots take the messages of both senders, the sender of
+     * higher priority returns before the batch does */
+    _check(msg_receive_batch(msgs, 2) == 2, "batch limited to two");
+    _check(_check_values(msgs, 2, 0), "order before the senders");
+    _check(_sent[0], "woken sender of higher priority ran");
+    _check(!_sent[1], "requester still waits for the reply");
+    _check(thread_getstatus(requester) == STATUS_REPLY_BLOCKED,
+           "requester reply blocked");
+    _check(msg_avail() == QUEUE_SIZE, "sender messages queued");
+
+    /* the messages of the senders follow the ones queued before */
+    _check(msg_receive_batch(msgs, ARRAY_SIZE(msgs)) == QUEUE_SIZE,
+           "queue with sender messages received");
+    _check(_check_values(msgs, 2, 2), "order before the sender messages");
+    _check(_check_values(&msgs[2], 2, SENDER_VALUE), "order of sender messages");
+    _check(msgs[3].sender_pid == requester, "sender of the request");
+
+    /* the request is replied to as any other */
+    _check(msg_reply(&msgs[3], &reply) == 1, "reply to the request");
+    _check(_sent[1] && (_reply == REPLY_VALUE), "requester got the reply");
+}
+
+static void _test_empty_queue(void)
+{
+    msg_t msgs[2 * QUEUE_SIZE];
+
+    /* the sender only runs while the batch blocks */
+    _create(2, THREAD_PRIORITY_MAIN + 1, _sender);
+    _check(!_sent[2], "sender of lower priority not run yet");
+    _check(msg_receive_batch(msgs, ARRAY_SIZE(msgs)) == 1,
+           "blocking batch returns a single message");
+    _check(msgs[0].content.value == SENDER_VALUE + 2, "message of the sender");
+}
+
+int main(void)
+{
+    _main_pid = thread_getpid();
+    msg_init_queue(_queue, QUEUE_SIZE);
+
+    puts("[START]");
+
+    _test_fifo();
+    _test_blocked_senders();
+    _test_empty_queue();
+
+    if (_failed) {
+        puts("[FAILED]");
+        return 1;
+    }
+
+    puts("[SUCCESS]");
+    return 0;
+}
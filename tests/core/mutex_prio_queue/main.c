@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the core_mutex_prio_queue module
+ *
+ * Many threads of partly equal priorities block on the same mutex, some of
+ * them are cancelled. The remaining ones must get the mutex by priority and
+ * in FIFO order among equal priorities.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "thread.h"
+
+#define THREAD_NUMOF            (12U)
+
+static char _stacks[THREAD_NUMOF][THREAD_STACKSIZE_SMALL];
+
+/* all higher than main's priority, so every thread blocks right away */
+static const uint8_t _prios[THREAD_NUMOF] = {
+    THREAD_PRIORITY_MAIN - 2, THREAD_PRIORITY_MAIN - 4,
+    THREAD_PRIORITY_MAIN - 2, THREAD_PRIORITY_MAIN - 6,
+    THREAD_PRIORITY_MAIN - 1, THREAD_PRIORITY_MAIN - 4,
+    THREAD_PRIORITY_MAIN - 5, THREAD_PRIORITY_MAIN - 1,
+    THREAD_PRIORITY_MAIN - 6, THREAD_PRIORITY_MAIN - 3,
+    THREAD_PRIORITY_MAIN - 2, THREAD_PRIORITY_MAIN - 5,
+};
+
+/* head, middle and tail of a priority group */
+static const bool _cancel[THREAD_NUMOF] = {
+    [2] = true, [4] = true, [11] = true,
+};
+
+static mutex_t _lock = MUTEX_INIT_LOCKED;
+static mutex_cancel_t _mc[THREAD_NUMOF];
+static unsigned _order[THREAD_NUMOF];
+static unsigned _numof_locked;
+static unsigned _numof_cancelled;
+
+static void *_locker(void *arg)
+{
+    unsigned idx = (uintptr_t)arg;
+
+    _mc[idx] = mutex_cancel_init(&_lock);
+    if (mutex_lock_cancelable(&_mc[idx]) == -ECANCELED) {
+        _numof_cancelled++;
+        return NULL;
+    }
+
+    _order[_numof_locked++] = idx;
+    mutex_unlock(&_lock);
+
+    return NULL;
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < THREAD_NUMOF; i++) {
+        thread_create(_stacks[i], sizeof(_stacks[i]), _prios[i], 0,
+                      _locker, (void *)(uintptr_t)i, "locker");
+    }
+
+    for (unsigned i = 0; i < THREAD_NUMOF; i++) {
+        if (_cancel[i]) {
+            mutex_cancel(&_mc[i]);
+        }
+    }
+
+    /* hands the mutex to every remaining waiter in turn */
+    mutex_unlock(&_lock);
+
+    unsigned expected = 0;
+    for (unsigned prio = 0; prio < SCHED_PRIO_LEVELS; prio++) {
+        for (unsigned i = 0; i < THREAD_NUMOF; i++) {
+            if ((_prios[i] != prio) || _cancel[i]) {
+                continue;
+            }
+            printf("expect T%u (prio %u), got T%u\n", i, prio,
+                   _order[expected]);
+            if (_order[expected++] != i) {
+                puts("FAILURE: wrong order");
+                return 1;
+            }
+        }
+    }
+
+    if ((expected != _numof_locked) || (_numof_cancelled != 3)) {
+        puts("FAILURE: wrong number of threads");
+        return 1;
+    }
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,186 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the reader-writer lock
+ *
+ * All helper threads have a higher priority than main, so they run (and
+ * possibly block) right away when created or woken up.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "rwlock.h"
+#include "thread.h"
+
+#define PRIO_LOW        (THREAD_PRIORITY_MAIN - 1)
+#define PRIO_HIGH       (THREAD_PRIORITY_MAIN - 2)
+
+static char _stacks[3][THREAD_STACKSIZE_SMALL];
+static rwlock_t _lock = RWLOCK_INIT;
+static char _order[4];
+static unsigned _numof_locked;
+
+static void *_reader(void *arg)
+{
+    rwlock_rdlock(&_lock);
+    _order[_numof_locked++] = (char)(uintptr_t)arg;
+    rwlock_rdunlock(&_lock);
+
+    return NULL;
+}
+
+static void *_writer(void *arg)
+{
+    rwlock_wrlock(&_lock);
+    _order[_numof_locked++] = (char)(uintptr_t)arg;
+    rwlock_wrunlock(&_lock);
+
+    return NULL;
+}
+
+static void _create(unsigned idx, uint8_t prio, thread_task_func_t func,
+                    char tag)
+{
+    thread_create(_stacks[idx], sizeof(_stacks[idx]), prio, 0, func,
+                  (void *)(uintptr_t)tag, "helper");
+}
+
+static int _test_shared_readers(void)
+{
+    puts("readers share the lock");
+    _numof_locked = 0;
+
+    rwlock_rdlock(&_lock);
+    _create(0, PRIO_HIGH, _reader, 'r');
+    if (_numof_locked != 1) {
+        puts("FAILURE: reader blocked by reader");
+        return 1;
+    }
+    if (rwlock_trywrlock(&_lock)) {
+        puts("FAILURE: writer got lock held by reader");
+        return 1;
+    }
+    rwlock_rdunlock(&_lock);
+
+    return 0;
+}
+
+static int _test_writer_preference(void)
+{
+    puts("waiting writers take precedence over new readers");
+    _numof_locked = 0;
+
+    /* main inherits the priority of the blocked writers, so the reader
+     * only runs and blocks once main releases the lock */
+    rwlock_rdlock(&_lock);
+    _create(0, PRIO_LOW, _writer, 'w');
+    _create(1, PRIO_HIGH, _writer, 'W');
+    _create(2, PRIO_HIGH, _reader, 'r');
+    if (_numof_locked != 0) {
+        puts("FAILURE: reader or writer did not block");
+        return 1;
+    }
+    if (rwlock_tryrdlock(&_lock)) {
+        puts("FAILURE: reader overtook waiting writer");
+        return 1;
+    }
+
+    /* hands the lock to both writers in priority order, then to the reader */
+    rwlock_rdunlock(&_lock);
+
+    printf("order: %.3s\n", _order);
+    if ((_numof_locked != 3) || (_order[0] != 'W') || (_order[1] != 'w') ||
+        (_order[2] != 'r')) {
+        puts("FAILURE: wrong order");
+        return 1;
+    }
+
+    return 0;
+}
+
+static int _test_priority_inheritance(void)
+{
+    puts("writer inherits priority of blocked threads");
+    _numof_locked = 0;
+
+    thread_t *me = thread_get_active();
+
+    rwlock_wrlock(&_lock);
+    _create(0, PRIO_LOW, _reader, 'r');
+    if (me->priority != PRIO_LOW) {
+        puts("FAILURE: priority not inherited from reader");
+        return 1;
+    }
+    _create(1, PRIO_HIGH, _writer, 'W');
+    if (me->priority != PRIO_HIGH) {
+        puts("FAILURE: priority not inherited from writer");
+        return 1;
+    }
+    rwlock_wrunlock(&_lock);
+
+    if (me->priority != THREAD_PRIORITY_MAIN) {
+        puts("FAILURE: priority not restored");
+        return 1;
+    }
+    printf("order: %.2s\n", _order);
+    if ((_numof_locked != 2) || (_order[0] != 'W') || (_order[1] != 'r')) {
+        puts("FAILURE: wrong order");
+        return 1;
+    }
+
+    return 0;
+}
+
+static int _test_reader_priority_inheritance(void)
+{
+    puts("readers inherit priority of blocked writer");
+    _numof_locked = 0;
+
+    thread_t *me = thread_get_active();
+
+    rwlock_rdlock(&_lock);
+    _create(0, PRIO_HIGH, _writer, 'W');
+    if (me->priority != PRIO_HIGH) {
+        puts("FAILURE: priority not inherited from writer");
+        return 1;
+    }
+    _create(1, PRIO_LOW, _reader, 'r');
+    if (me->priority != PRIO_HIGH) {
+        puts("FAILURE: priority lowered by blocked reader");
+        return 1;
+    }
+    rwlock_rdunlock(&_lock);
+
+    if (me->priority != THREAD_PRIORITY_MAIN) {
+        puts("FAILURE: priority not restored");
+        return 1;
+    }
+    printf("order: %.2s\n", _order);
+    if ((_numof_locked != 2) || (_order[0] != 'W') || (_order[1] != 'r')) {
+        puts("FAILURE: wrong order");
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    if (_test_shared_readers() || _test_writer_preference() ||
+        _test_priority_inheritance() || _test_reader_priority_inheritance()) {
+        return 1;
+    }
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for soft IRQs
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "mutex.h"
+#include "softirq.h"
+#include "ztimer.h"
+
+typedef struct {
+    softirq_t softirq;
+    char tag;
+} tagged_softirq_t;
+
+static tagged_softirq_t _high = { .tag = 'H' };
+static tagged_softirq_t _medium = { .tag = 'M' };
+static tagged_softirq_t _low1 = { .tag = 'l' };
+static tagged_softirq_t _low2 = { .tag = 'L' };
+static tagged_softirq_t _cancelled = { .tag = 'C' };
+
+static mutex_t _done = MUTEX_INIT_LOCKED;
+static char _order[8];
+static unsigned _numof_run;
+static unsigned _numof_in_isr;
+
+static void _handler(softirq_t *softirq)
+{
+    tagged_softirq_t *ts = container_of(softirq, tagged_softirq_t, softirq);
+
+    if (_numof_run < sizeof(_order) - 1) {
+        _order[_numof_run] = ts->tag;
+    }
+    _numof_run++;
+    if (irq_is_in()) {
+        _numof_in_isr++;
+    }
+    if (ts == &_low2) {
+        mutex_unlock(&_done);
+    }
+}
+
+static void _timer_cb(void *arg)
+{
+    (void)arg;
+
+    /* raised in reverse order of their priority classes */
+    softirq_raise(&_low1.softirq, SOFTIRQ_PRIO_LOWEST);
+    softirq_raise(&_cancelled.softirq, SOFTIRQ_PRIO_LOWEST);
+    softirq_raise(&_low2.softirq, SOFTIRQ_PRIO_LOWEST);
+    softirq_raise(&_medium.softirq, SOFTIRQ_PRIO_MEDIUM);
+    softirq_raise(&_high.softirq, SOFTIRQ_PRIO_HIGHEST);
+    /* pending already, must run only once */
+    softirq_raise(&_low1.softirq, SOFTIRQ_PRIO_LOWEST);
+    if (!softirq_cancel(&_cancelled.softirq)) {
+        puts("FAILURE: could not cancel soft IRQ");
+    }
+}
+
+int main(void)
+{
+    tagged_softirq_t *all[] = { &_high, &_medium, &_low1, &_low2, &_cancelled };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(all); i++) {
+        softirq_init(&all[i]->softirq, _handler);
+    }
+
+    puts("raising from thread context");
+    softirq_raise(&_high.softirq, SOFTIRQ_PRIO_HIGHEST);
+    if (_numof_run != 1) {
+        puts("FAILURE: soft IRQ did not run before softirq_raise() returned");
+        return 1;
+    }
+
+    puts("raising from ISR");
+    _numof_run = 0;
+    _numof_in_isr = 0;
+    ztimer_t timer = { .callback = _timer_cb };
+    ztimer_set(ZTIMER_MSEC, &timer, 10);
+    mutex_lock(&_done);
+
+    printf("order: %s\n", _order);
+    if (strcmp(_order, "HMlL") || (_numof_run != 4)) {
+        puts("FAILURE: wrong order");
+        return 1;
+    }
+    if (_numof_in_isr != _numof_run) {
+        puts("FAILURE: soft IRQ did not run in interrupt context");
+        return 1;
+    }
+
+    puts("SUCCESS");
+
+    return 0;
+}
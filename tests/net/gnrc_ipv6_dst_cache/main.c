@@ -0,0 +1,223 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests that changes of the NIB invalidate the next hops in the
+ *              destination cache of GNRC IPv6
+ *
+ * Every datagram is sent with `gnrc_tx_sync`, so the link-layer destination
+ * of the frame is known once @ref sock_udp_send() returns.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/ethernet.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/netdev_test.h"
+#include "net/sock/udp.h"
+
+#define PORT                (12345U)
+
+static const uint8_t _l2addr_a[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x0a };
+static const uint8_t _l2addr_b[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x0b };
+static const uint8_t _l2addr_c[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x0c };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static sock_udp_t _sock;
+static ipv6_addr_t _router_a;
+static ipv6_addr_t _router_b;
+static ipv6_addr_t _prefix;
+/* link-layer destination of the last frame sent */
+static uint8_t _last_dst[ETHERNET_ADDR_LEN];
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    const ethernet_hdr_t *hdr = iolist->iol_base;
+
+    (void)dev;
+    memcpy(_last_dst, hdr->dst, sizeof(_last_dst));
+    return iolist_size(iolist);
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    static const uint8_t addr[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+
+    (void)dev;
+    (void)max_len;
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+/* sends a datagram to 2001:db8:1::<dst> and returns the link-layer
+ * destination the frame was sent to, all zeros if none was sent */
+static const uint8_t *_send_to(uint8_t dst)
+{
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = PORT };
+    uint8_t buf[8] = { 0 };
+
+    memcpy(remote.addr.ipv6, &_prefix, sizeof(_prefix));
+    remote.addr.ipv6[15] = dst;
+    memset(_last_dst, 0, sizeof(_last_dst));
+    sock_udp_send(&_sock, buf, sizeof(buf), &remote);
+    return _last_dst;
+}
+
+static void set_up(void)
+{
+    gnrc_ipv6_nib_ft_del(NULL, 0);
+    gnrc_ipv6_nib_ft_del(&_prefix, 48);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_nc_set(&_router_a, _netif.pid,
+                                                  _l2addr_a,
+                                                  sizeof(_l2addr_a)));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_nc_set(&_router_b, _netif.pid,
+                                                  _l2addr_b,
+                                                  sizeof(_l2addr_b)));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(NULL, 0, &_router_a,
+                                                  _netif.pid, 0));
+}
+
+static void test_cached(void)
+{
+    for (unsigned i = 0; i < 4; i++) {
+        /* more destinations than cache entries */
+        TEST_ASSERT_EQUAL_INT(0, memcmp(_l2addr_a, _send_to(i % 3),
+                                        sizeof(_l2addr_a)));
+    }
+}
+
+static void test_default_route_changed(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_l2addr_a, _send_to(1),
+                                    sizeof(_l2addr_a)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_l2addr_a, _send_to(1),
+                                    sizeof(_l2addr_a)));
+
+    gnrc_ipv6_nib_ft_del(NULL, 0);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(NULL, 0, &_router_b,
+                                                  _netif.pid, 0));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_l2addr_b, _send_to(1),
+                                    sizeof(_l2addr_b)));
+}
+
+static void test_route_added_and_removed(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_l2addr_a, _send_to(1),
+                                    sizeof(_l2addr_a)));
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&_prefix, 48, &_router_b,
+                                                  _netif.pid, 0));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_l2addr_b, _send_to(1),
+                                    sizeof(_l2addr_b)));
+
+    gnrc_ipv6_nib_ft_del(&_prefix, 48);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_l2addr_a, _send_to(1),
+                                    sizeof(_l2addr_a)));
+}
+
+static void test_neighbor_changed(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_l2addr_a, _send_to(1),
+                                    sizeof(_l2addr_a)));
+
+    /* the router got a new link-layer address */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_nc_set(&_router_a, _netif.pid,
+                                                  _l2addr_c,
+                                                  sizeof(_l2addr_c)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_l2addr_c, _send_to(1),
+                                    sizeof(_l2addr_c)));
+
+    /* restore for the other tests */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_nc_set(&_router_a, _netif.pid,
+                                                  _l2addr_a,
+                                                  sizeof(_l2addr_a)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_l2addr_a, _send_to(1),
+                                    sizeof(_l2addr_a)));
+}
+
+static Test *tests_gnrc_ipv6_dst_cache(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_cached),
+        new_TestFixture(test_default_route_changed),
+        new_TestFixture(test_route_added_and_removed),
+        new_TestFixture(test_neighbor_changed),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_ipv6_dst_cache_tests, set_up, NULL, fixtures);
+
+    return (Test *)&gnrc_ipv6_dst_cache_tests;
+}
+
+static int _setup(void)
+{
+    sock_udp_ep_t local = { .family = AF_INET6, .port = PORT };
+    ipv6_addr_t addr;
+
+    netdev_test_setup(&_netdev, 0);
+    netdev_test_set_send_cb(&_netdev, _send);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    if (gnrc_netif_ethernet_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                   GNRC_NETIF_PRIO, "test_eth",
+                                   &_netdev.netdev.netdev) < 0) {
+        return -1;
+    }
+    /* a global address to send from */
+    ipv6_addr_from_str(&addr, "2001:db8::1");
+    if (gnrc_netif_ipv6_addr_add(&_netif, &addr, 64,
+                                 GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) < 0) {
+        return -1;
+    }
+    ipv6_addr_from_str(&_router_a, "fe80::a");
+    ipv6_addr_from_str(&_router_b, "fe80::b");
+    ipv6_addr_from_str(&_prefix, "2001:db8:1::");
+
+    return sock_udp_create(&_sock, &local, NULL, 0);
+}
+
+int main(void)
+{
+    if (_setup() < 0) {
+        puts("FAILURE: setup");
+        return 1;
+    }
+
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_ipv6_dst_cache());
+    TESTS_END();
+
+    return 0;
+}
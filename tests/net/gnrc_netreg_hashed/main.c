@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the hashed index of the GNRC network protocol registry
+ *
+ * The generic registry tests are in `tests/unittests/tests-netreg`, this
+ * only covers the entries of the hashed protocol types.
+ *
+ * @}
+ */
+
+#include "container.h"
+#include "embUnit.h"
+#include "msg.h"
+#include "net/gnrc/netreg.h"
+#include "thread.h"
+
+#define PORT_NUMOF          (3 * CONFIG_GNRC_NETREG_HASHED_BUCKETS)
+
+static gnrc_netreg_entry_t _entries[PORT_NUMOF];
+static gnrc_netreg_entry_t _dup;
+static gnrc_netreg_entry_t _all;
+static msg_t _msg_queue[2];
+
+static void set_up(void)
+{
+    gnrc_netreg_init();
+}
+
+static void _register_ports(gnrc_nettype_t type)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_entries); i++) {
+        gnrc_netreg_entry_init_pid(&_entries[i], 1000 + i, thread_getpid());
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(type, &_entries[i]));
+    }
+}
+
+static void _test_lookup(gnrc_nettype_t type)
+{
+    _register_ports(type);
+    gnrc_netreg_acquire_shared();
+    for (unsigned i = 0; i < ARRAY_SIZE(_entries); i++) {
+        gnrc_netreg_entry_t *res = gnrc_netreg_lookup(type, 1000 + i);
+
+        TEST_ASSERT(res == &_entries[i]);
+        TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    }
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(type, 1000 + PORT_NUMOF));
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(type, GNRC_NETREG_DEMUX_CTX_ALL));
+    gnrc_netreg_release_shared();
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_num(GNRC_NETTYPE_UNDEF, 1000));
+}
+
+static void test_lookup__udp(void)
+{
+    _test_lookup(GNRC_NETTYPE_UDP);
+}
+
+static void test_lookup__tcp(void)
+{
+    _test_lookup(GNRC_NETTYPE_TCP);
+}
+
+static void test_lookup__same_port(void)
+{
+    gnrc_netreg_entry_t *res;
+
+    _register_ports(GNRC_NETTYPE_UDP);
+    gnrc_netreg_entry_init_pid(&_dup, 1000, thread_getpid());
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_UDP, &_dup));
+    TEST_ASSERT_EQUAL_INT(2, gnrc_netreg_num(GNRC_NETTYPE_UDP, 1000));
+
+    gnrc_netreg_acquire_shared();
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_UDP, 1000)));
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_getnext(res)));
+    TEST_ASSERT_EQUAL_INT(1000, res->demux_ctx);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    gnrc_netreg_release_shared();
+}
+
+static void test_lookup__all(void)
+{
+    _register_ports(GNRC_NETTYPE_UDP);
+    gnrc_netreg_entry_init_pid(&_all, GNRC_NETREG_DEMUX_CTX_ALL,
+                               thread_getpid());
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_UDP, &_all));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_UDP,
+                                             GNRC_NETREG_DEMUX_CTX_ALL));
+    gnrc_netreg_acquire_shared();
+    TEST_ASSERT(gnrc_netreg_lookup(GNRC_NETTYPE_UDP,
+                                   GNRC_NETREG_DEMUX_CTX_ALL) == &_all);
+    gnrc_netreg_release_shared();
+}
+
+static void test_unregister(void)
+{
+    _register_ports(GNRC_NETTYPE_UDP);
+    for (unsigned i = 0; i < ARRAY_SIZE(_entries); i += 2) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &_entries[i]);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_entries); i++) {
+        TEST_ASSERT_EQUAL_INT(i & 1, gnrc_netreg_num(GNRC_NETTYPE_UDP, 1000 + i));
+    }
+}
+
+static Test *tests_gnrc_netreg_hashed(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_lookup__udp),
+        new_TestFixture(test_lookup__tcp),
+        new_TestFixture(test_lookup__same_port),
+        new_TestFixture(test_lookup__all),
+        new_TestFixture(test_unregister),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_netreg_hashed_tests, set_up, NULL, fixtures);
+
+    return (Test *)&gnrc_netreg_hashed_tests;
+}
+
+int main(void)
+{
+    /* only threads with a message queue may register */
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_netreg_hashed());
+    TESTS_END();
+
+    return 0;
+}
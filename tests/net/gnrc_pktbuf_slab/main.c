@@ -0,0 +1,216 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Freie Universität Berlin
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the slab backend of the GNRC packet buffer
+ *
+ * The generic packet buffer tests are in `tests/unittests/tests-pktbuf`, this
+ * only covers the properties specific to `gnrc_pktbuf_slab`.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "container.h"
+#include "embUnit.h"
+#include "net/gnrc/pktbuf.h"
+
+#define TEST_STRING "Lorem ipsum dolor sit amet, consectetur adipiscing elit"
+#define MEDIUM_DATA_SIZE    (CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE + 1)
+
+static uint8_t _data[CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE];
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+    for (unsigned i = 0; i < sizeof(_data); i++) {
+        _data[i] = i;
+    }
+}
+
+static void test_add__too_large(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL,
+                                     CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE + 1,
+                                     GNRC_NETTYPE_TEST));
+    pkt = gnrc_pktbuf_add(NULL, _data, CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE,
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data, pkt->data, pkt->size));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_add__fallback_to_larger_class(void)
+{
+    gnrc_pktsnip_t *pkts[CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF +
+                         CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(pkts); i++) {
+        pkts[i] = gnrc_pktbuf_add(NULL, _data, MEDIUM_DATA_SIZE,
+                                  GNRC_NETTYPE_TEST);
+        TEST_ASSERT_NOT_NULL(pkts[i]);
+    }
+    /* the medium data still does not fit into the small blocks */
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, _data, MEDIUM_DATA_SIZE,
+                                     GNRC_NETTYPE_TEST));
+    TEST_ASSERT_NOT_NULL(pkts[0] = gnrc_pktbuf_add(pkts[0], _data,
+                                                   CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE,
+                                                   GNRC_NETTYPE_TEST));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    for (unsigned i = 0; i < ARRAY_SIZE(pkts); i++) {
+        gnrc_pktbuf_release(pkts[i]);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_add__reuse_last_released(void)
+{
+    gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, TEST_STRING, sizeof(TEST_STRING),
+                                           GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *pkt2 = gnrc_pktbuf_add(NULL, TEST_STRING, sizeof(TEST_STRING),
+                                           GNRC_NETTYPE_TEST);
+    void *data1;
+
+    TEST_ASSERT_NOT_NULL(pkt1);
+    TEST_ASSERT_NOT_NULL(pkt2);
+    data1 = pkt1->data;
+    gnrc_pktbuf_release(pkt1);
+    pkt1 = gnrc_pktbuf_add(NULL, TEST_STRING, sizeof(TEST_STRING),
+                           GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt1);
+    TEST_ASSERT(data1 == pkt1->data);
+    gnrc_pktbuf_release(pkt1);
+    gnrc_pktbuf_release(pkt2);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_mark__shares_block(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _data, MEDIUM_DATA_SIZE,
+                                          GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *hdr;
+    uint8_t *data;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    hdr = gnrc_pktbuf_mark(pkt, 16, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT(hdr == pkt->next);
+    TEST_ASSERT(data == hdr->data);
+    TEST_ASSERT(data + 16 == pkt->data);
+    TEST_ASSERT_EQUAL_INT(MEDIUM_DATA_SIZE - 16, pkt->size);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+
+    /* the block stays allocated until both parts are released */
+    pkt->next = NULL;
+    gnrc_pktbuf_release(hdr);
+    TEST_ASSERT(!gnrc_pktbuf_is_empty());
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_data[16], pkt->data, pkt->size));
+    TEST_ASSERT_NOT_NULL(hdr = gnrc_pktbuf_add(NULL, _data, MEDIUM_DATA_SIZE,
+                                               GNRC_NETTYPE_TEST));
+    TEST_ASSERT(data != hdr->data);
+    gnrc_pktbuf_release(hdr);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_realloc_data__in_place(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _data, MEDIUM_DATA_SIZE,
+                                          GNRC_NETTYPE_TEST);
+    void *data;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 8));
+    TEST_ASSERT(data == pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt,
+                                                      CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE));
+    TEST_ASSERT(data == pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data, pkt->data, 8));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt,
+                                                      CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE + 1));
+    TEST_ASSERT(data != pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data, pkt->data, 8));
+    TEST_ASSERT_EQUAL_INT(ENOMEM, gnrc_pktbuf_realloc_data(pkt,
+                                                           CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE + 1));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_realloc_data__shared_block(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _data, MEDIUM_DATA_SIZE,
+                                          GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *hdr;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    hdr = gnrc_pktbuf_mark(pkt, 16, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(hdr);
+    /* growing the header in place would overwrite the payload */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(hdr, 32));
+    TEST_ASSERT(((uint8_t *)hdr->data + hdr->size) <= (uint8_t *)pkt->data ||
+                ((uint8_t *)pkt->data + pkt->size) <= (uint8_t *)hdr->data);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data, hdr->data, 16));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_data[16], pkt->data, pkt->size));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_merge(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, &_data[16], 48, GNRC_NETTYPE_TEST);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    pkt = gnrc_pktbuf_add(pkt, _data, 16, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_merge(pkt));
+    TEST_ASSERT_NULL(pkt->next);
+    TEST_ASSERT_EQUAL_INT(64, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data, pkt->data, pkt->size));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static Test *tests_gnrc_pktbuf_slab(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_add__too_large),
+        new_TestFixture(test_add__fallback_to_larger_class),
+        new_TestFixture(test_add__reuse_last_released),
+        new_TestFixture(test_mark__shares_block),
+        new_TestFixture(test_realloc_data__in_place),
+        new_TestFixture(test_realloc_data__shared_block),
+        new_TestFixture(test_merge),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_pktbuf_slab_tests, set_up, NULL, fixtures);
+
+    return (Test *)&gnrc_pktbuf_slab_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_pktbuf_slab());
+    TESTS_END();
+
+    return 0;
+}
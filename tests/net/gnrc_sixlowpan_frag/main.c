@@ -30,6 +30,9 @@
 #define TEST_TAG                (0x690e)
 #define TEST_PAGE               (0)
 #define TEST_RECEIVE_TIMEOUT    (100U)
+/* rounds of interleaved datagrams from CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE
+ * senders each, every round with new senders */
+#define TEST_INTERLEAVED_ROUNDS (32U)
 #define TEST_GC_TIMEOUT         (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US + TEST_RECEIVE_TIMEOUT)
 
 /* test date taken from an experimental run (uncompressed ICMPv6 echo reply with
@@ -380,6 +383,141 @@ static void test_rbuf_add__success_complete(void)
     _check_pktbuf(NULL);
 }
 
+/* fragments of the test datagram in the order they are fed by the tests with
+ * many senders */
+static const struct {
+    uint8_t *data;
+    size_t len;
+    size_t offset;
+} _interleaved_frags[] = {
+    { _fragment2, sizeof(_fragment2), TEST_FRAGMENT2_OFFSET },
+    { _fragment4, sizeof(_fragment4), TEST_FRAGMENT4_OFFSET },
+    { _fragment1, sizeof(_fragment1), TEST_FRAGMENT1_OFFSET },
+    { _fragment3, sizeof(_fragment3), TEST_FRAGMENT3_OFFSET },
+};
+
+/* adds fragment f of the datagram of sender to the reassembly buffer, stores
+ * the result of gnrc_sixlowpan_frag_rb_dispatch_when_complete() in res */
+static void _sender_add(unsigned sender, unsigned f, int *res)
+{
+    uint8_t src[] = TEST_NETIF_HDR_SRC;
+    uint16_t tag = TEST_TAG + (sender % 3);
+    gnrc_sixlowpan_frag_rb_t *entry;
+    gnrc_pktsnip_t *pkt;
+
+    src[sizeof(src) - 1] = sender;
+    gnrc_netif_hdr_set_src_addr(&_test_netif_hdr.hdr, src, sizeof(src));
+    _set_fragment_tag(_interleaved_frags[f].data, tag);
+    pkt = gnrc_pktbuf_add(NULL, _interleaved_frags[f].data,
+                          _interleaved_frags[f].len, GNRC_NETTYPE_SIXLOWPAN);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_NOT_NULL((entry = gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt, _interleaved_frags[f].offset, TEST_PAGE
+        )));
+    TEST_ASSERT_EQUAL_INT(tag, entry->super.tag);
+    TEST_ASSERT_MESSAGE(memcmp(entry->super.src, src, sizeof(src)) == 0,
+                        "Fragment added to entry of other sender");
+    *res = gnrc_sixlowpan_frag_rb_dispatch_when_complete(entry,
+                                                         &_test_netif_hdr.hdr);
+}
+
+static void _receive_datagram(void)
+{
+    msg_t msg = { .type = 0U };
+    gnrc_pktsnip_t *datagram;
+
+    TEST_ASSERT_MESSAGE(
+            xtimer_msg_receive_timeout(&msg, TEST_RECEIVE_TIMEOUT) >= 0,
+            "Receiving reassembled datagram timed out"
+        );
+    TEST_ASSERT_EQUAL_INT(GNRC_NETAPI_MSG_TYPE_RCV, msg.type);
+    datagram = msg.content.ptr;
+    TEST_ASSERT_NOT_NULL(datagram);
+    TEST_ASSERT_EQUAL_INT(TEST_DATAGRAM_SIZE, datagram->size);
+    TEST_ASSERT_MESSAGE(memcmp(_datagram, datagram->data,
+                               TEST_DATAGRAM_SIZE) == 0,
+                        "Reassembled datagram does not contain expected data");
+    gnrc_pktbuf_release(datagram);
+}
+
+static void test_rbuf_add__interleaved_senders(void)
+{
+    gnrc_netreg_entry_t reg = GNRC_NETREG_ENTRY_INIT_PID(
+            GNRC_NETREG_DEMUX_CTX_ALL,
+            thread_getpid()
+        );
+
+    gnrc_netreg_register(TEST_DATAGRAM_NETTYPE, &reg);
+    for (unsigned round = 0; round < TEST_INTERLEAVED_ROUNDS; round++) {
+        /* feed the fragments of all senders one after another, so every
+         * datagram completes only with the last fragment of each sender */
+        for (unsigned f = 0; f < ARRAY_SIZE(_interleaved_frags); f++) {
+            for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+                unsigned sender = (round * CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE) + i;
+                int res = -1;
+
+                _sender_add(sender, f, &res);
+                if (f < (ARRAY_SIZE(_interleaved_frags) - 1)) {
+                    TEST_ASSERT_EQUAL_INT(0, res);
+                }
+                else {
+                    TEST_ASSERT(0 < res);
+                    _receive_datagram();
+                }
+            }
+        }
+        TEST_ASSERT_NULL(_first_non_empty_rbuf());
+    }
+    gnrc_netreg_unregister(TEST_DATAGRAM_NETTYPE, &reg);
+    TEST_ASSERT(gnrc_sixlowpan_frag_rb_ints_empty());
+    _check_pktbuf(NULL);
+}
+
+static void test_rbuf_add__evicted_senders(void)
+{
+    const unsigned last = ARRAY_SIZE(_interleaved_frags) - 1;
+    gnrc_netreg_entry_t reg = GNRC_NETREG_ENTRY_INIT_PID(
+            GNRC_NETREG_DEMUX_CTX_ALL,
+            thread_getpid()
+        );
+    int res = -1;
+
+    gnrc_netreg_register(TEST_DATAGRAM_NETTYPE, &reg);
+    /* fill the reassembly buffer with incomplete datagrams */
+    for (unsigned f = 0; f < last; f++) {
+        for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+            _sender_add(i, f, &res);
+            TEST_ASSERT_EQUAL_INT(0, res);
+        }
+    }
+    /* make sure all of them are older than the datagrams to come */
+    xtimer_usleep(1000);
+    /* the datagrams of as many new senders evict them one by one and
+     * complete */
+    for (unsigned f = 0; f <= last; f++) {
+        for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+            _sender_add(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE + i, f, &res);
+            if (f < last) {
+                TEST_ASSERT_EQUAL_INT(0, res);
+            }
+            else {
+                TEST_ASSERT(0 < res);
+                _receive_datagram();
+            }
+        }
+    }
+    TEST_ASSERT_NULL(_first_non_empty_rbuf());
+    /* the evicted datagrams start over with their last fragment */
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        _sender_add(i, last, &res);
+        TEST_ASSERT_EQUAL_INT(0, res);
+    }
+    gnrc_netreg_unregister(TEST_DATAGRAM_NETTYPE, &reg);
+    gnrc_sixlowpan_frag_rb_reset();
+    TEST_ASSERT(gnrc_sixlowpan_frag_rb_ints_empty());
+    _check_pktbuf(NULL);
+}
+
 static void test_rbuf_add__full_rbuf(void)
 {
     gnrc_pktsnip_t *pkt;
@@ -643,6 +781,8 @@ static void run_unittests(void)
         new_TestFixture(test_rbuf_add__success_subsequent_fragment),
         new_TestFixture(test_rbuf_add__success_duplicate_fragments),
         new_TestFixture(test_rbuf_add__success_complete),
+        new_TestFixture(test_rbuf_add__interleaved_senders),
+        new_TestFixture(test_rbuf_add__evicted_senders),
         new_TestFixture(test_rbuf_add__full_rbuf),
         new_TestFixture(test_rbuf_add__too_big_fragment),
         new_TestFixture(test_rbuf_add__overlap_lhs),
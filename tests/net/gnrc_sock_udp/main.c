@@ -20,6 +20,7 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include "net/gnrc/pktbuf.h"
 #include "net/sock/udp.h"
 #include "test_utils/expect.h"
 #include "xtimer.h"
@@ -515,6 +516,35 @@ static void test_sock_udp_recv_buf__success(void)
     expect(_check_net());
 }
 
+static void test_gnrc_sock_udp_recv_pkt__success(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_ep_t result;
+    gnrc_pktsnip_t *pkt = NULL;
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(sizeof("ABCD") == gnrc_sock_udp_recv_pkt(&_sock, &pkt,
+                                                    SOCK_NO_TIMEOUT, &result,
+                                                    NULL));
+    expect(pkt != NULL);
+    expect(sizeof("ABCD") == pkt->size);
+    expect(0 == memcmp("ABCD", pkt->data, sizeof("ABCD")));
+    expect(GNRC_NETTYPE_UDP == pkt->next->type);
+    expect(AF_INET6 == result.family);
+    expect(memcmp(&result.addr, &src_addr, sizeof(result.addr)) == 0);
+    expect(_TEST_PORT_REMOTE == result.port);
+    /* the packet is lent until it is released */
+    expect(!gnrc_pktbuf_is_empty());
+    gnrc_pktbuf_release(pkt);
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
@@ -852,6 +882,7 @@ int main(void)
     CALL(test_sock_udp_recv__non_blocking());
     CALL(test_sock_udp_recv__aux());
     CALL(test_sock_udp_recv_buf__success());
+    CALL(test_gnrc_sock_udp_recv_pkt__success());
     _prepare_send_checks();
     CALL(test_sock_udp_send__EAFNOSUPPORT());
     CALL(test_sock_udp_send__EINVAL_addr());